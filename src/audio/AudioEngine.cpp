@@ -0,0 +1,232 @@
+#include "audio/AudioEngine.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+namespace GreedySnake
+{
+
+namespace
+{
+const float PI = 3.14159265f;
+
+// How often the mixer thread looks for queued effects
+const auto MIXER_INTERVAL = std::chrono::milliseconds(1);
+
+// Shape of one synthesized effect: a tone gliding between two frequencies
+struct ToneShape
+{
+    float startFrequency;
+    float endFrequency;
+    float durationSeconds;
+    bool square; // Square wave instead of sine
+    float volume; // 0..1
+};
+
+ToneShape getToneShape(SoundEffect effect)
+{
+    switch (effect)
+    {
+    case SoundEffect::EAT:
+        return {660.0f, 990.0f, 0.08f, false, 0.6f};
+    case SoundEffect::TURN:
+        return {320.0f, 280.0f, 0.03f, true, 0.25f};
+    case SoundEffect::DEATH:
+        return {420.0f, 70.0f, 0.5f, true, 0.5f};
+    case SoundEffect::MENU_MOVE:
+        return {520.0f, 520.0f, 0.04f, false, 0.35f};
+    case SoundEffect::MENU_SELECT:
+        return {520.0f, 780.0f, 0.1f, false, 0.45f};
+    case SoundEffect::COUNT:
+        break;
+    }
+    return {0.0f, 0.0f, 0.0f, false, 0.0f};
+}
+} // namespace
+
+AudioEngine::AudioEngine()
+    : voiceStartOrder{},
+      nextStartOrder(0),
+      enabled(false),
+      running(false),
+      droppedCount(0),
+      stolenCount(0)
+{
+}
+
+AudioEngine::~AudioEngine()
+{
+    shutdown();
+}
+
+bool AudioEngine::initialize()
+{
+    if (running)
+    {
+        return true;
+    }
+
+    for (size_t effect = 0; effect < EFFECT_COUNT; ++effect)
+    {
+        const std::vector<int16_t> samples = generateSamples(static_cast<SoundEffect>(effect));
+        if (!buffers[effect].loadFromSamples(samples.data(), samples.size(), 1, SAMPLE_RATE))
+        {
+            std::cerr << "Failed to create sound buffer " << effect << std::endl;
+            return false;
+        }
+
+        // Bind once so starting a voice later is only a play() call
+        for (size_t voice = 0; voice < VOICES_PER_EFFECT; ++voice)
+        {
+            voices[effect * VOICES_PER_EFFECT + voice].setBuffer(buffers[effect]);
+        }
+    }
+
+    running = true;
+    mixerThread = std::thread(&AudioEngine::mixerLoop, this);
+    return true;
+}
+
+void AudioEngine::shutdown()
+{
+    if (!running)
+    {
+        return;
+    }
+
+    running = false;
+    if (mixerThread.joinable())
+    {
+        mixerThread.join();
+    }
+    for (sf::Sound& voice : voices)
+    {
+        voice.stop();
+    }
+}
+
+void AudioEngine::play(SoundEffect effect)
+{
+    if (!enabled || effect == SoundEffect::COUNT)
+    {
+        return;
+    }
+
+    if (!queue.push(effect))
+    {
+        droppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void AudioEngine::setEnabled(bool enabled)
+{
+    this->enabled = enabled;
+}
+
+bool AudioEngine::isEnabled() const
+{
+    return enabled;
+}
+
+size_t AudioEngine::getPendingCount() const
+{
+    return queue.size();
+}
+
+uint64_t AudioEngine::getDroppedCount() const
+{
+    return droppedCount.load(std::memory_order_relaxed);
+}
+
+uint64_t AudioEngine::getStolenCount() const
+{
+    return stolenCount.load(std::memory_order_relaxed);
+}
+
+std::vector<int16_t> AudioEngine::generateSamples(SoundEffect effect)
+{
+    const ToneShape shape = getToneShape(effect);
+    const size_t count = static_cast<size_t>(shape.durationSeconds * SAMPLE_RATE);
+    std::vector<int16_t> samples(count);
+
+    // Short linear attack and release avoid clicks at the ends
+    const size_t fade = std::min<size_t>(count / 4, SAMPLE_RATE / 200);
+    float phase = 0.0f;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float progress = static_cast<float>(i) / count;
+        const float frequency =
+            shape.startFrequency + (shape.endFrequency - shape.startFrequency) * progress;
+        phase += 2.0f * PI * frequency / SAMPLE_RATE;
+        if (phase > 2.0f * PI)
+        {
+            phase -= 2.0f * PI;
+        }
+
+        float value = std::sin(phase);
+        if (shape.square)
+        {
+            value = value >= 0.0f ? 1.0f : -1.0f;
+        }
+
+        float envelope = 1.0f;
+        if (i < fade)
+        {
+            envelope = static_cast<float>(i) / fade;
+        }
+        else if (count - i <= fade)
+        {
+            envelope = static_cast<float>(count - i) / fade;
+        }
+        // Fade the tail out so longer effects don't end abruptly
+        envelope *= 1.0f - 0.5f * progress;
+
+        samples[i] = static_cast<int16_t>(value * envelope * shape.volume * 32767.0f);
+    }
+    return samples;
+}
+
+void AudioEngine::mixerLoop()
+{
+    while (running)
+    {
+        SoundEffect effect = SoundEffect::COUNT;
+        while (queue.pop(effect))
+        {
+            startVoice(effect);
+        }
+        std::this_thread::sleep_for(MIXER_INTERVAL);
+    }
+}
+
+void AudioEngine::startVoice(SoundEffect effect)
+{
+    const size_t first = static_cast<size_t>(effect) * VOICES_PER_EFFECT;
+
+    // Prefer an idle voice; otherwise restart the one that has played longest
+    size_t chosen = first;
+    bool idleFound = false;
+    for (size_t voice = first; voice < first + VOICES_PER_EFFECT; ++voice)
+    {
+        if (voices[voice].getStatus() != sf::SoundSource::Playing)
+        {
+            chosen = voice;
+            idleFound = true;
+            break;
+        }
+        if (voiceStartOrder[voice] < voiceStartOrder[chosen])
+        {
+            chosen = voice;
+        }
+    }
+
+    if (!idleFound)
+    {
+        stolenCount.fetch_add(1, std::memory_order_relaxed);
+        voices[chosen].stop();
+    }
+    voiceStartOrder[chosen] = ++nextStartOrder;
+    voices[chosen].play();
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "utils/SpscQueue.h"
+#include <SFML/Audio.hpp>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Sound effects the game can trigger
+ */
+enum class SoundEffect : uint8_t
+{
+    EAT,
+    TURN,
+    DEATH,
+    MENU_MOVE,
+    MENU_SELECT,
+    COUNT
+};
+
+/**
+ * @brief Plays procedurally generated sound effects with a fixed voice pool
+ *
+ * All sample buffers are generated in initialize() and each voice is bound
+ * to its effect's buffer once, so triggering a sound never allocates or
+ * touches the disk. play() only pushes the effect onto a lock-free
+ * single-producer queue; a mixer thread starts the voices, so the calling
+ * (tick) thread never waits on the audio device. When all voices of an
+ * effect are busy the one that started first is restarted (voice stealing).
+ */
+class AudioEngine
+{
+  public:
+    static constexpr size_t EFFECT_COUNT = static_cast<size_t>(SoundEffect::COUNT);
+    static constexpr size_t VOICES_PER_EFFECT = 3;
+    static constexpr size_t QUEUE_SIZE = 64;
+    static constexpr unsigned SAMPLE_RATE = 44100;
+
+    /**
+     * @brief Constructor; nothing plays until initialize()
+     */
+    AudioEngine();
+
+    /**
+     * @brief Destructor stops the mixer thread
+     */
+    ~AudioEngine();
+
+    AudioEngine(const AudioEngine&) = delete;
+    AudioEngine& operator=(const AudioEngine&) = delete;
+
+    /**
+     * @brief Generate the sound buffers and start the mixer thread
+     * @return True if all buffers were created
+     */
+    bool initialize();
+
+    /**
+     * @brief Stop the mixer thread and all voices
+     */
+    void shutdown();
+
+    /**
+     * @brief Queue a sound effect
+     *
+     * Allocation-free and wait-free. Must always be called from the same
+     * thread (the simulation thread). Effects are dropped while sound is
+     * disabled or the queue is full.
+     *
+     * @param effect Effect to play
+     */
+    void play(SoundEffect effect);
+
+    /**
+     * @brief Enable or disable playback (follows the sound setting)
+     * @param enabled True to play effects
+     */
+    void setEnabled(bool enabled);
+
+    /**
+     * @brief Check if playback is enabled
+     * @return True if effects are played
+     */
+    [[nodiscard]] bool isEnabled() const;
+
+    /**
+     * @brief Get the number of effects waiting for the mixer thread
+     * @return Queued effect count
+     */
+    [[nodiscard]] size_t getPendingCount() const;
+
+    /**
+     * @brief Get the number of effects dropped because the queue was full
+     * @return Dropped effect count
+     */
+    [[nodiscard]] uint64_t getDroppedCount() const;
+
+    /**
+     * @brief Get the number of voices restarted for a newer effect
+     * @return Stolen voice count
+     */
+    [[nodiscard]] uint64_t getStolenCount() const;
+
+    /**
+     * @brief Generate the samples of an effect
+     * @param effect Effect to synthesize
+     * @return Mono 16-bit samples at SAMPLE_RATE
+     */
+    static std::vector<int16_t> generateSamples(SoundEffect effect);
+
+  private:
+    std::array<sf::SoundBuffer, EFFECT_COUNT> buffers;
+    std::array<sf::Sound, EFFECT_COUNT * VOICES_PER_EFFECT> voices;
+    std::array<uint64_t, EFFECT_COUNT * VOICES_PER_EFFECT> voiceStartOrder;
+    uint64_t nextStartOrder;
+
+    // Effects queued by the game thread for the mixer thread
+    SpscQueue<SoundEffect, QUEUE_SIZE> queue;
+
+    std::atomic<bool> enabled;
+    std::atomic<bool> running;
+    std::atomic<uint64_t> droppedCount;
+    std::atomic<uint64_t> stolenCount;
+    std::thread mixerThread;
+
+    // Mixer thread entry point: starts the voices for queued effects
+    void mixerLoop();
+
+    // Start a voice for an effect, stealing the oldest one if all are busy
+    void startVoice(SoundEffect effect);
+};
+
+} // namespace GreedySnake
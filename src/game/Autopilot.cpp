@@ -0,0 +1,112 @@
+#include "game/Autopilot.h"
+#include <climits>
+#include <cstdlib>
+
+namespace GreedySnake
+{
+
+namespace
+{
+// Cell one step away in a direction
+Position stepFrom(const Position& position, Direction direction)
+{
+    switch (direction)
+    {
+    case Direction::UP:
+        return Position(position.x, position.y - 1);
+    case Direction::DOWN:
+        return Position(position.x, position.y + 1);
+    case Direction::LEFT:
+        return Position(position.x - 1, position.y);
+    case Direction::RIGHT:
+    default:
+        return Position(position.x + 1, position.y);
+    }
+}
+
+// WASD key that turns the snake in a direction
+int keyFor(Direction direction)
+{
+    switch (direction)
+    {
+    case Direction::UP:
+        return 'w';
+    case Direction::DOWN:
+        return 's';
+    case Direction::LEFT:
+        return 'a';
+    case Direction::RIGHT:
+    default:
+        return 'd';
+    }
+}
+
+// Manhattan distance to the closest food entity
+int distanceToFood(const Game& game, const Position& from)
+{
+    const EntityStore& entities = game.getEntities();
+    const std::vector<Position>& positions = entities.getPositions();
+    const std::vector<EntityKind>& kinds = entities.getKinds();
+
+    int best = INT_MAX;
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+        if (kinds[i] == EntityKind::FOOD)
+        {
+            const int distance =
+                std::abs(positions[i].x - from.x) + std::abs(positions[i].y - from.y);
+            best = distance < best ? distance : best;
+        }
+    }
+    return best;
+}
+} // namespace
+
+Direction Autopilot::chooseDirection(const Game& game)
+{
+    const Snake& snake = game.getSnake();
+    const Direction current = snake.getCurrentDirection();
+    const Position head = snake.getHead();
+
+    // Try the current direction first so ties keep the snake going straight
+    const Direction candidates[] = {current, Direction::UP, Direction::DOWN, Direction::LEFT,
+                                    Direction::RIGHT};
+
+    Direction best = current;
+    int bestDistance = INT_MAX;
+    bool foundSafe = false;
+    for (Direction candidate : candidates)
+    {
+        if (candidate == getOppositeDirection(current))
+        {
+            continue;
+        }
+
+        const Position next = stepFrom(head, candidate);
+        const CellType cell = game.getBoard().getCellType(next);
+        if (cell == CellType::WALL || cell == CellType::SNAKE)
+        {
+            continue;
+        }
+
+        const int distance = distanceToFood(game, next);
+        if (!foundSafe || distance < bestDistance)
+        {
+            best = candidate;
+            bestDistance = distance;
+            foundSafe = true;
+        }
+    }
+    return best;
+}
+
+void Autopilot::steer(Game& game)
+{
+    const Direction direction = chooseDirection(game);
+    if (direction != game.getSnake().getCurrentDirection())
+    {
+        game.processKeyPress(keyFor(direction));
+    }
+}
+
+} // namespace GreedySnake
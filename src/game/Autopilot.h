@@ -0,0 +1,33 @@
+#pragma once
+
+#include "game/Game.h"
+#include "utils/Direction.h"
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Greedy steering for unattended games
+ *
+ * Turns toward the nearest food while avoiding walls and the snake's own
+ * body one step ahead. It is not a good player; it keeps spectator tiles
+ * moving without anyone at the keyboard.
+ */
+class Autopilot
+{
+  public:
+    /**
+     * @brief Pick the next direction for a game's snake
+     * @param game Game to look at
+     * @return The safe direction closest to food, or the current direction if none is safe
+     */
+    [[nodiscard]] static Direction chooseDirection(const Game& game);
+
+    /**
+     * @brief Queue the chosen direction as a key press
+     * @param game Game to steer
+     */
+    static void steer(Game& game);
+};
+
+} // namespace GreedySnake
@@ -30,7 +30,29 @@ bool Board::setCellType(const Position& position, CellType cellType)
     {
         return false;
     }
-    grid[position.y][position.x] = cellType;
+    CellType& cell = grid[position.y][position.x];
+    if (cell == cellType)
+    {
+        return true;
+    }
+
+    const size_t slot = static_cast<size_t>(position.y) * width + position.x;
+    if (cell == CellType::EMPTY)
+    {
+        // Move the last empty cell into the hole
+        const size_t index = emptySlots[slot];
+        const Position last = emptyCells.back();
+        emptyCells[index] = last;
+        emptySlots[static_cast<size_t>(last.y) * width + last.x] = index;
+        emptyCells.pop_back();
+        emptySlots[slot] = NOT_EMPTY;
+    }
+    else if (cellType == CellType::EMPTY)
+    {
+        emptySlots[slot] = emptyCells.size();
+        emptyCells.push_back(position);
+    }
+    cell = cellType;
     return true;
 }
 
@@ -44,6 +66,19 @@ int Board::getHeight() const
     return height;
 }
 
+void Board::resize(int width, int height)
+{
+    if (width == this->width && height == this->height)
+    {
+        return;
+    }
+
+    this->width = width;
+    this->height = height;
+    grid.assign(height, std::vector<CellType>(width, CellType::EMPTY));
+    indexEmptyCells();
+}
+
 void Board::reset()
 {
     // Set all cells to EMPTY
@@ -67,6 +102,36 @@ void Board::reset()
         grid[y][0] = CellType::WALL;         // Left border
         grid[y][width - 1] = CellType::WALL; // Right border
     }
+
+    indexEmptyCells();
+}
+
+size_t Board::getEmptyCellCount() const
+{
+    return emptyCells.size();
+}
+
+Position Board::getEmptyCell(size_t index) const
+{
+    return emptyCells[index];
+}
+
+void Board::indexEmptyCells()
+{
+    // Storage is kept across resets of the same size
+    emptyCells.clear();
+    emptySlots.assign(static_cast<size_t>(width) * height, NOT_EMPTY);
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            if (grid[y][x] == CellType::EMPTY)
+            {
+                emptySlots[static_cast<size_t>(y) * width + x] = emptyCells.size();
+                emptyCells.emplace_back(x, y);
+            }
+        }
+    }
 }
 
 } // namespace GreedySnake
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "game/CellType.h"
 #include "utils/Position.h"
+#include <cstddef>
 #include <vector>
 
 namespace GreedySnake
@@ -60,10 +61,46 @@ class Board
      */
     void reset();
 
+    /**
+     * @brief Change the board dimensions
+     * Keeps the existing cell storage when the size is unchanged; call reset()
+     * afterwards to lay out the walls
+     * @param width New width of the board
+     * @param height New height of the board
+     */
+    void resize(int width, int height);
+
+    /**
+     * @brief Get the number of EMPTY cells
+     * @return Empty cell count
+     */
+    [[nodiscard]] size_t getEmptyCellCount() const;
+
+    /**
+     * @brief Get one of the EMPTY cells
+     *
+     * The empty cells are kept in a packed list that setCellType() updates in
+     * O(1), so picking a random free cell never scans the grid. The order of
+     * the list changes as cells are filled and freed.
+     *
+     * @param index Index below getEmptyCellCount()
+     * @return Position of the empty cell
+     */
+    [[nodiscard]] Position getEmptyCell(size_t index) const;
+
   private:
+    static constexpr size_t NOT_EMPTY = static_cast<size_t>(-1);
+
     int width;
     int height;
     std::vector<std::vector<CellType>> grid;
+    std::vector<Position> emptyCells;
+    std::vector<size_t> emptySlots; // Per cell (row-major): index into emptyCells or NOT_EMPTY
+
+    /**
+     * @brief Rebuild the empty cell list from the grid
+     */
+    void indexEmptyCells();
 };
 
 } // namespace GreedySnake
\ No newline at end of file
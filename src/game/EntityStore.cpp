@@ -0,0 +1,160 @@
+#include "game/EntityStore.h"
+#include <algorithm>
+
+namespace GreedySnake
+{
+
+EntityStore::EntityStore(size_t reserveCount)
+{
+    ids.reserve(reserveCount);
+    positions.reserve(reserveCount);
+    kinds.reserve(reserveCount);
+    values.reserve(reserveCount);
+    expiries.reserve(reserveCount);
+    slotIndices.reserve(reserveCount);
+    slotGenerations.reserve(reserveCount);
+    freeSlots.reserve(reserveCount);
+}
+
+EntityStore::EntityId EntityStore::create(EntityKind kind,
+                                          const Position& position,
+                                          int value,
+                                          uint64_t expiresAt)
+{
+    uint32_t slot = 0;
+    if (!freeSlots.empty())
+    {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(slotIndices.size());
+        slotIndices.push_back(NONE);
+        slotGenerations.push_back(0);
+    }
+
+    // Ids pack the slot (plus one, so no id is zero) with the slot's generation
+    const EntityId id = (static_cast<EntityId>(slotGenerations[slot]) << SLOT_BITS) | (slot + 1);
+    slotIndices[slot] = static_cast<uint32_t>(ids.size());
+
+    ids.push_back(id);
+    positions.push_back(position);
+    kinds.push_back(kind);
+    values.push_back(value);
+    expiries.push_back(expiresAt);
+    return id;
+}
+
+bool EntityStore::destroy(EntityId id)
+{
+    const uint32_t slot = slotOf(id);
+    if (slot == NONE)
+    {
+        return false;
+    }
+    destroyAt(slotIndices[slot]);
+    return true;
+}
+
+void EntityStore::destroyAt(size_t index)
+{
+    const uint32_t slot = static_cast<uint32_t>(ids[index] & SLOT_MASK) - 1;
+    const size_t last = ids.size() - 1;
+
+    // Fill the hole with the last entity so the arrays stay packed
+    if (index != last)
+    {
+        ids[index] = ids[last];
+        positions[index] = positions[last];
+        kinds[index] = kinds[last];
+        values[index] = values[last];
+        expiries[index] = expiries[last];
+        slotIndices[static_cast<uint32_t>(ids[index] & SLOT_MASK) - 1] =
+            static_cast<uint32_t>(index);
+    }
+    ids.pop_back();
+    positions.pop_back();
+    kinds.pop_back();
+    values.pop_back();
+    expiries.pop_back();
+
+    slotIndices[slot] = NONE;
+    ++slotGenerations[slot];
+    freeSlots.push_back(slot);
+}
+
+void EntityStore::clear()
+{
+    while (!ids.empty())
+    {
+        destroyAt(ids.size() - 1);
+    }
+}
+
+bool EntityStore::contains(EntityId id) const
+{
+    return slotOf(id) != NONE;
+}
+
+size_t EntityStore::indexOf(EntityId id) const
+{
+    const uint32_t slot = slotOf(id);
+    return slot == NONE ? ids.size() : slotIndices[slot];
+}
+
+size_t EntityStore::size() const
+{
+    return ids.size();
+}
+
+size_t EntityStore::countKind(EntityKind kind) const
+{
+    return static_cast<size_t>(std::count(kinds.begin(), kinds.end(), kind));
+}
+
+void EntityStore::setPosition(size_t index, const Position& position)
+{
+    positions[index] = position;
+}
+
+const std::vector<EntityStore::EntityId>& EntityStore::getIds() const
+{
+    return ids;
+}
+
+const std::vector<Position>& EntityStore::getPositions() const
+{
+    return positions;
+}
+
+const std::vector<EntityKind>& EntityStore::getKinds() const
+{
+    return kinds;
+}
+
+const std::vector<int>& EntityStore::getValues() const
+{
+    return values;
+}
+
+const std::vector<uint64_t>& EntityStore::getExpiries() const
+{
+    return expiries;
+}
+
+uint32_t EntityStore::slotOf(EntityId id) const
+{
+    const uint32_t slot = static_cast<uint32_t>(id & SLOT_MASK) - 1;
+    if (id == INVALID_ENTITY || slot >= slotIndices.size() || slotIndices[slot] == NONE)
+    {
+        return NONE;
+    }
+    if ((id >> SLOT_BITS) != slotGenerations[slot])
+    {
+        return NONE;
+    }
+    return slot;
+}
+
+} // namespace GreedySnake
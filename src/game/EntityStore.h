@@ -0,0 +1,135 @@
+#pragma once
+
+#include "utils/Position.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief What an entity on the board is
+ */
+enum class EntityKind : uint8_t
+{
+    FOOD,    // Eaten by the snake for its value; the snake grows
+    OBSTACLE // Blocks its cell like a wall
+};
+
+/**
+ * @brief Struct-of-arrays storage for the entities on a board
+ *
+ * Each component lives in its own array and the live entities are packed at
+ * indices 0..size()-1 of all of them, so systems that need one or two
+ * components walk contiguous memory. Removing an entity moves the last one
+ * into its place; ids stay valid across such moves through a sparse
+ * id-to-index table, and ids of removed entities become stale.
+ */
+class EntityStore
+{
+  public:
+    using EntityId = uint64_t;
+
+    static constexpr EntityId INVALID_ENTITY = 0;
+    static constexpr uint64_t NO_EXPIRY = 0;
+
+    /**
+     * @brief Constructor
+     * @param reserveCount Entities to reserve room for up front
+     */
+    explicit EntityStore(size_t reserveCount = 64);
+
+    /**
+     * @brief Add an entity
+     * @param kind What the entity is
+     * @param position Board cell of the entity
+     * @param value Points or strength, depending on the kind
+     * @param expiresAt Game tick at which the entity disappears, NO_EXPIRY to keep it
+     * @return Id of the new entity
+     */
+    EntityId create(EntityKind kind, const Position& position, int value, uint64_t expiresAt);
+
+    /**
+     * @brief Remove an entity by id
+     * @param id Entity to remove
+     * @return False if the id is stale or invalid
+     */
+    bool destroy(EntityId id);
+
+    /**
+     * @brief Remove the entity at a dense index; the last entity moves into its place
+     * @param index Index below size()
+     */
+    void destroyAt(size_t index);
+
+    /**
+     * @brief Remove all entities, invalidating their ids
+     */
+    void clear();
+
+    /**
+     * @brief Check whether an id refers to a live entity
+     * @param id Entity id
+     * @return True if the entity exists
+     */
+    [[nodiscard]] bool contains(EntityId id) const;
+
+    /**
+     * @brief Get the dense index of an entity
+     * @param id Entity id
+     * @return Index into the component arrays, or size() if the id is stale
+     */
+    [[nodiscard]] size_t indexOf(EntityId id) const;
+
+    /**
+     * @brief Get the number of live entities
+     * @return Entity count
+     */
+    [[nodiscard]] size_t size() const;
+
+    /**
+     * @brief Count the live entities of one kind
+     * @param kind Kind to count
+     * @return Number of entities of that kind
+     */
+    [[nodiscard]] size_t countKind(EntityKind kind) const;
+
+    /**
+     * @brief Move an entity to another cell
+     * @param index Dense index of the entity
+     * @param position New board cell
+     */
+    void setPosition(size_t index, const Position& position);
+
+    // Component arrays, all indexed by the same dense index
+    [[nodiscard]] const std::vector<EntityId>& getIds() const;
+    [[nodiscard]] const std::vector<Position>& getPositions() const;
+    [[nodiscard]] const std::vector<EntityKind>& getKinds() const;
+    [[nodiscard]] const std::vector<int>& getValues() const;
+    [[nodiscard]] const std::vector<uint64_t>& getExpiries() const;
+
+  private:
+    static constexpr uint32_t NONE = 0xFFFFFFFF;
+    static constexpr uint32_t SLOT_BITS = 32;
+    static constexpr EntityId SLOT_MASK = (EntityId(1) << SLOT_BITS) - 1;
+
+    // Dense components
+    std::vector<EntityId> ids;
+    std::vector<Position> positions;
+    std::vector<EntityKind> kinds;
+    std::vector<int> values;
+    std::vector<uint64_t> expiries;
+
+    // Sparse table: id slot -> dense index (NONE while free), and each slot's generation.
+    // Free slots are reused last-in first-out, so one slot may be recycled on every
+    // tick; 32 generation bits keep stale ids from matching for years of play.
+    std::vector<uint32_t> slotIndices;
+    std::vector<uint32_t> slotGenerations;
+    std::vector<uint32_t> freeSlots;
+
+    // Split an id into its slot, or NONE if it doesn't name a live entity
+    [[nodiscard]] uint32_t slotOf(EntityId id) const;
+};
+
+} // namespace GreedySnake
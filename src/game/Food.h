@@ -1,8 +1,8 @@
 #pragma once
 
 #include "game/Board.h"
-#include "game/Snake.h"
 #include "utils/Position.h"
+#include <random>
 
 namespace GreedySnake
 {
@@ -21,12 +21,13 @@ class Food
 
     /**
      * @brief Generate a new random position for food
-     * Ensures food isn't placed on the snake or walls
+     * Picks uniformly among the board's EMPTY cells in O(1), so the snake
+     * must be marked on the board. The board is not rescanned however many
+     * food items are placed one after another.
      * @param board Reference to the game board
-     * @param snake Reference to the snake
      * @return True if a valid position was found, false otherwise
      */
-    bool generatePosition(const Board& board, const Snake& snake);
+    bool generatePosition(const Board& board);
 
     /**
      * @brief Get current position of food
@@ -43,6 +44,7 @@ class Food
   private:
     Position position;
     int value;
+    std::mt19937 generator; // Seeded once; reseeding per placement is slow
 };
 
 } // namespace GreedySnake
\ No newline at end of file
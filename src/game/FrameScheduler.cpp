@@ -0,0 +1,154 @@
+#include "game/FrameScheduler.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace GreedySnake
+{
+
+namespace
+{
+
+FrameScheduler::Clock::duration toDuration(float seconds)
+{
+    // Round up so a deadline derived from a remaining time is never early
+    return std::chrono::duration_cast<FrameScheduler::Clock::duration>(
+        std::chrono::duration<double, std::micro>(std::ceil(seconds * 1.0e6)));
+}
+
+} // namespace
+
+FrameScheduler::FrameScheduler(float refreshRate, float spinThreshold)
+    : frameInterval(toDuration(1.0f / std::max(refreshRate, 1.0f))),
+      spinThreshold(toDuration(spinThreshold)),
+      started(false),
+      frameTimes{},
+      sampleIndex(0),
+      sampleCount(0),
+      lastWakeLateness(0.0f)
+{
+}
+
+void FrameScheduler::setRefreshRate(float refreshRate)
+{
+    frameInterval = toDuration(1.0f / std::max(refreshRate, 1.0f));
+}
+
+float FrameScheduler::getFrameInterval() const
+{
+    return std::chrono::duration<float>(frameInterval).count();
+}
+
+FrameScheduler::Clock::time_point FrameScheduler::getNextDeadline(Clock::time_point now,
+                                                                  float timeUntilTick) const
+{
+    Clock::time_point deadline = started ? nextRefresh : now;
+
+    // Wake up early for a tick that is due before the next refresh
+    if (timeUntilTick >= 0.0f)
+    {
+        deadline = std::min(deadline, now + toDuration(timeUntilTick));
+    }
+
+    return deadline;
+}
+
+void FrameScheduler::waitUntil(Clock::time_point deadline) const
+{
+    // Coarse sleep until shortly before the deadline; the OS may oversleep
+    auto now = Clock::now();
+    if (deadline - now > spinThreshold)
+    {
+        std::this_thread::sleep_for(deadline - now - spinThreshold);
+    }
+
+    // Spin for the remainder to hit the deadline precisely
+    while (Clock::now() < deadline)
+    {
+        std::this_thread::yield();
+    }
+}
+
+float FrameScheduler::waitForNextFrame(float timeUntilTick)
+{
+    Clock::time_point deadline = getNextDeadline(Clock::now(), timeUntilTick);
+    waitUntil(deadline);
+
+    Clock::time_point frameStart = Clock::now();
+    lastWakeLateness = std::chrono::duration<float>(frameStart - deadline).count();
+
+    float deltaTime = 0.0f;
+    if (started)
+    {
+        deltaTime = std::chrono::duration<float>(frameStart - lastFrameStart).count();
+        recordFrameTime(deltaTime);
+    }
+
+    // Keep the refresh phase locked to its own grid unless we fell a whole frame behind
+    if (!started || frameStart - nextRefresh > frameInterval)
+    {
+        nextRefresh = frameStart + frameInterval;
+    }
+    else if (deadline >= nextRefresh)
+    {
+        nextRefresh += frameInterval;
+    }
+
+    lastFrameStart = frameStart;
+    started = true;
+    return deltaTime;
+}
+
+float FrameScheduler::getAverageFrameTime() const
+{
+    if (sampleCount == 0)
+    {
+        return 0.0f;
+    }
+
+    float sum = 0.0f;
+    for (std::size_t i = 0; i < sampleCount; ++i)
+    {
+        sum += frameTimes[i];
+    }
+    return sum / static_cast<float>(sampleCount);
+}
+
+float FrameScheduler::getFrameTimeJitter() const
+{
+    if (sampleCount < 2)
+    {
+        return 0.0f;
+    }
+
+    float mean = getAverageFrameTime();
+    float variance = 0.0f;
+    for (std::size_t i = 0; i < sampleCount; ++i)
+    {
+        float diff = frameTimes[i] - mean;
+        variance += diff * diff;
+    }
+    return std::sqrt(variance / static_cast<float>(sampleCount));
+}
+
+float FrameScheduler::getLastWakeLateness() const
+{
+    return lastWakeLateness;
+}
+
+void FrameScheduler::reset()
+{
+    started = false;
+    sampleIndex = 0;
+    sampleCount = 0;
+    lastWakeLateness = 0.0f;
+}
+
+void FrameScheduler::recordFrameTime(float frameTime)
+{
+    frameTimes[sampleIndex] = frameTime;
+    sampleIndex = (sampleIndex + 1) % SAMPLE_COUNT;
+    sampleCount = std::min(sampleCount + 1, SAMPLE_COUNT);
+}
+
+} // namespace GreedySnake
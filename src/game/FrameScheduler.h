@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Paces the main loop against the display refresh and the game tick
+ *
+ * The scheduler replaces fixed sleeps and driver frame limits with a single
+ * deadline: the earlier of the next display refresh and the next game tick.
+ * It waits for that deadline with a coarse sleep followed by a short spin, so
+ * input sampled right after the wait is as fresh as possible for the tick.
+ */
+class FrameScheduler
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Constructor
+     * @param refreshRate Display refresh rate in frames per second
+     * @param spinThreshold Time in seconds before a deadline to stop sleeping and start spinning
+     */
+    explicit FrameScheduler(float refreshRate = 60.0f, float spinThreshold = 0.002f);
+
+    /**
+     * @brief Set the display refresh rate
+     * @param refreshRate Frames per second (values below 1 are clamped to 1)
+     */
+    void setRefreshRate(float refreshRate);
+
+    /**
+     * @brief Get the time between two display refreshes
+     * @return Frame interval in seconds
+     */
+    [[nodiscard]] float getFrameInterval() const;
+
+    /**
+     * @brief Compute the next wake-up deadline
+     * @param now Current time
+     * @param timeUntilTick Seconds until the next game tick, negative if no tick is pending
+     * @return The earlier of the next refresh deadline and the tick deadline
+     */
+    [[nodiscard]] Clock::time_point getNextDeadline(Clock::time_point now,
+                                                    float timeUntilTick) const;
+
+    /**
+     * @brief Block until the given deadline (coarse sleep followed by a spin)
+     * @param deadline Time point to wait for
+     */
+    void waitUntil(Clock::time_point deadline) const;
+
+    /**
+     * @brief Wait for the next frame and record its timing
+     * @param timeUntilTick Seconds until the next game tick, negative if no tick is pending
+     * @return Seconds elapsed since the previous frame started
+     */
+    float waitForNextFrame(float timeUntilTick);
+
+    /**
+     * @brief Get the average measured frame time over the recent sample window
+     * @return Average frame time in seconds (0 if no frames were measured)
+     */
+    [[nodiscard]] float getAverageFrameTime() const;
+
+    /**
+     * @brief Get the measured frame-time jitter over the recent sample window
+     * @return Standard deviation of the frame times in seconds
+     */
+    [[nodiscard]] float getFrameTimeJitter() const;
+
+    /**
+     * @brief Get how late the last wake-up was relative to its deadline
+     * @return Wake-up lateness in seconds
+     */
+    [[nodiscard]] float getLastWakeLateness() const;
+
+    /**
+     * @brief Forget the frame phase and all timing samples
+     */
+    void reset();
+
+  private:
+    static constexpr std::size_t SAMPLE_COUNT = 120;
+
+    Clock::duration frameInterval;
+    Clock::duration spinThreshold;
+    Clock::time_point lastFrameStart;
+    Clock::time_point nextRefresh;
+    bool started;
+
+    // Ring buffer of recent frame times in seconds
+    std::array<float, SAMPLE_COUNT> frameTimes;
+    std::size_t sampleIndex;
+    std::size_t sampleCount;
+    float lastWakeLateness;
+
+    void recordFrameTime(float frameTime);
+};
+
+} // namespace GreedySnake
@@ -1,10 +1,19 @@
 #include "game/Game.h"
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
 namespace GreedySnake
 {
 
+namespace
+{
+// Timers available to scheduleTimer() on top of the entity lifetimes. The wheel is sized for
+// one lifetime per board cell up to TimerWheel::MAX_CAPACITY; past that, a spawn that finds
+// the wheel full fails like one on an occupied cell
+const size_t USER_TIMER_CAPACITY = 256;
+} // namespace
+
 Game::Game(int boardWidth, int boardHeight, int initialSnakeLength)
     : board(boardWidth, boardHeight),
       snake(Position(boardWidth / 2, boardHeight / 2), initialSnakeLength, Direction::RIGHT),
@@ -13,14 +22,27 @@ Game::Game(int boardWidth, int boardHeight, int initialSnakeLength)
       gameOver(false),
       paused(false),
       score(0),
-      gameSpeed(5)
+      gameSpeed(5),
+      turnTaken(false),
+      tickCount(0),
+      lastMoveTurned(false),
+      foodCount(1),
+      foodOnBoard(0)
 {
+    reserveEvents();
 }
 
 void Game::initialize()
 {
     // Initialize the game components
+    const size_t cellCount = static_cast<size_t>(board.getWidth()) * board.getHeight();
+    events.clear();
+    timers.resize(cellCount + USER_TIMER_CAPACITY);
+    entities.clear();
+    foodOnBoard = 0;
     board.reset();
+    cellEntities.assign(cellCount, EntityStore::INVALID_ENTITY);
+    cellTimers.assign(cellCount, CellTimer{this, TimerWheel::INVALID_TIMER});
     snake.reset();
     inputHandler.reset();
 
@@ -28,13 +50,17 @@ void Game::initialize()
     initializeSnake();
 
     // Generate initial food
-    generateFood();
+    reserveEvents();
+    refillFood();
 
     // Reset game state
     isRunning = true;
     gameOver = false;
     paused = false;
     score = 0;
+    turnTaken = false;
+    tickCount = 0;
+    lastMoveTurned = false;
 }
 
 void Game::run()
@@ -79,42 +105,70 @@ bool Game::update()
         return false;
     }
 
-    // Clear the board (keep walls)
-    for (int y = 0; y < board.getHeight(); ++y)
+    events.clear();
+
+    // Move snake; the tail cell is freed unless the snake is growing
+    const size_t lengthBefore = snake.getBody().size();
+    const Position oldTail = snake.getBody().back();
+    Position newHead = snake.move();
+    if (snake.getBody().size() == lengthBefore)
     {
-        for (int x = 0; x < board.getWidth(); ++x)
-        {
-            // Skip border cells
-            if (x == 0 || y == 0 || x == board.getWidth() - 1 || y == board.getHeight() - 1)
-            {
-                continue;
-            }
-            board.setCellType(Position(x, y), CellType::EMPTY);
-        }
+        board.setCellType(oldTail, CellType::EMPTY);
+        emit(GameEvent::Type::TAIL_VACATED, oldTail);
     }
+    emit(GameEvent::Type::HEAD_MOVED, newHead);
 
-    // Move snake
-    Position newHead = snake.move();
+    // Remember which input this move consumed, for latency measurements
+    ++tickCount;
+    lastMoveTurned = turnTaken;
+    if (turnTaken)
+    {
+        lastTurnPressedAt = turnPressedAt;
+    }
+
+    // The next move may turn again; a turn queued during this tick is taken now
+    turnTaken = false;
+    applyQueuedTurn();
 
     // Check for collisions
     checkCollisions();
 
-    // Update board with new snake position
-    for (const auto& pos : snake.getBody())
+    // The rest of the body is already on the board; only the head is new
+    board.setCellType(newHead, CellType::SNAKE);
+
+    // Timed effects, entity lifetimes included, see the board after this move
+    if (!gameOver)
     {
-        board.setCellType(pos, CellType::SNAKE);
+        timers.advance();
     }
 
-    // Make sure food is on the board
-    board.setCellType(food.getPosition(), CellType::FOOD);
+    if (gameOver)
+    {
+        emit(GameEvent::Type::DIED, newHead, score);
+    }
 
     return !gameOver;
 }
 
 void Game::handleInput()
 {
-    Direction dir = inputHandler.getInput();
-    snake.changeDirection(dir);
+    applyQueuedTurn();
+}
+
+void Game::applyQueuedTurn()
+{
+    if (turnTaken)
+    {
+        return;
+    }
+
+    InputHandler::DirectionEvent turn{};
+    if (inputHandler.takeTurn(snake.getCurrentDirection(), turn))
+    {
+        snake.changeDirection(turn.direction);
+        turnTaken = true;
+        turnPressedAt = turn.timestamp;
+    }
 }
 
 void Game::checkCollisions()
@@ -135,25 +189,168 @@ void Game::checkCollisions()
         return;
     }
 
-    // Check for food collision
-    if (head == food.getPosition())
+    // Check for food collision through the cell index; obstacles are walls on the board
+    const size_t index = entities.indexOf(cellEntities[cellIndex(head)]);
+    if (index < entities.size() && entities.getKinds()[index] == EntityKind::FOOD)
+    {
+        eatFoodAt(index);
+    }
+}
+
+void Game::eatFoodAt(size_t index)
+{
+    const Position position = entities.getPositions()[index];
+    const int value = entities.getValues()[index];
+    removeEntityAt(index);
+
+    // Eat food; the cell stays taken by the head
+    snake.grow();
+    score += value;
+    emit(GameEvent::Type::FOOD_EATEN, position, value);
+
+    // Eaten food comes back somewhere else
+    replaceFood();
+}
+
+void Game::replaceFood()
+{
+    if (!refillFood() && foodOnBoard == 0)
     {
-        // Eat food
-        snake.grow();
-        score += food.getValue();
+        // No more space for food, game won!
+        gameOver = true;
+    }
+}
 
-        // Generate new food
+bool Game::refillFood()
+{
+    while (foodOnBoard < foodCount)
+    {
         if (!generateFood())
         {
-            // No more space for food, game won!
-            gameOver = true;
+            return false;
         }
     }
+    return true;
+}
+
+void Game::removeEntityAt(size_t index)
+{
+    const size_t cell = cellIndex(entities.getPositions()[index]);
+    cellEntities[cell] = EntityStore::INVALID_ENTITY;
+    if (cellTimers[cell].timer != TimerWheel::INVALID_TIMER)
+    {
+        timers.cancel(cellTimers[cell].timer);
+        cellTimers[cell].timer = TimerWheel::INVALID_TIMER;
+    }
+    if (entities.getKinds()[index] == EntityKind::FOOD)
+    {
+        --foodOnBoard;
+    }
+    entities.destroyAt(index);
+}
+
+size_t Game::cellIndex(const Position& position) const
+{
+    return static_cast<size_t>(position.y) * board.getWidth() + position.x;
+}
+
+void Game::onEntityExpired(void* context, TimerWheel::TimerId)
+{
+    // The context is the cell's timer record; its offset in the table is the cell
+    auto* cellTimer = static_cast<CellTimer*>(context);
+    Game* game = cellTimer->game;
+    cellTimer->timer = TimerWheel::INVALID_TIMER;
+    game->expireEntity(static_cast<size_t>(cellTimer - game->cellTimers.data()));
+}
+
+void Game::expireEntity(size_t cell)
+{
+    const size_t index = entities.indexOf(cellEntities[cell]);
+    if (index >= entities.size())
+    {
+        return;
+    }
+
+    const Position position = entities.getPositions()[index];
+    const EntityKind kind = entities.getKinds()[index];
+    removeEntityAt(index);
+    board.setCellType(position, CellType::EMPTY);
+    emit(GameEvent::Type::ENTITY_EXPIRED, position, static_cast<int>(kind));
+
+    // Expired food is replaced like eaten food
+    if (kind == EntityKind::FOOD)
+    {
+        replaceFood();
+    }
 }
 
 bool Game::generateFood()
 {
-    return food.generatePosition(board, snake);
+    if (!food.generatePosition(board))
+    {
+        return false;
+    }
+
+    return spawnEntity(EntityKind::FOOD, food.getPosition(), food.getValue()) !=
+           EntityStore::INVALID_ENTITY;
+}
+
+void Game::setFoodCount(int count)
+{
+    foodCount = std::max(count, 0);
+    reserveEvents();
+}
+
+int Game::getFoodCount() const
+{
+    return foodCount;
+}
+
+EntityStore::EntityId Game::spawnEntity(EntityKind kind,
+                                        const Position& position,
+                                        int value,
+                                        uint64_t lifetimeTicks)
+{
+    // The snake is marked on the board, so an EMPTY cell is free
+    if (board.getCellType(position) != CellType::EMPTY)
+    {
+        return EntityStore::INVALID_ENTITY;
+    }
+
+    // Lifetimes run on the timer wheel, so only the entities that expire cost anything
+    const size_t cell = cellIndex(position);
+    uint64_t expiresAt = EntityStore::NO_EXPIRY;
+    if (lifetimeTicks > 0)
+    {
+        cellTimers[cell].timer = timers.schedule(lifetimeTicks, &Game::onEntityExpired,
+                                                 &cellTimers[cell]);
+        if (cellTimers[cell].timer == TimerWheel::INVALID_TIMER)
+        {
+            return EntityStore::INVALID_ENTITY;
+        }
+        expiresAt = tickCount + lifetimeTicks;
+    }
+
+    const EntityStore::EntityId id = entities.create(kind, position, value, expiresAt);
+    cellEntities[cell] = id;
+    reserveEvents();
+    if (kind == EntityKind::FOOD)
+    {
+        ++foodOnBoard;
+        board.setCellType(position, CellType::FOOD);
+        emit(GameEvent::Type::FOOD_SPAWNED, position, value);
+    }
+    else
+    {
+        board.setCellType(position, CellType::WALL);
+        emit(GameEvent::Type::OBSTACLE_PLACED, position);
+    }
+    return id;
+}
+
+const EntityStore& Game::getEntities() const
+{
+    return entities;
 }
 
 bool Game::isGameOver() const
@@ -181,6 +378,28 @@ const Food& Game::getFood() const
     return food;
 }
 
+const std::vector<GameEvent>& Game::getEvents() const
+{
+    return events;
+}
+
+TimerWheel::TimerId Game::scheduleTimer(uint64_t delayTicks,
+                                        TimerWheel::Callback callback,
+                                        void* context)
+{
+    return timers.schedule(delayTicks, callback, context);
+}
+
+bool Game::cancelTimer(TimerWheel::TimerId id)
+{
+    return timers.cancel(id);
+}
+
+const TimerWheel& Game::getTimers() const
+{
+    return timers;
+}
+
 void Game::pause()
 {
     paused = true;
@@ -196,13 +415,33 @@ bool Game::isPaused() const
     return paused;
 }
 
-void Game::processKeyPress(int keyCode)
+const InputHandler& Game::getInputHandler() const
+{
+    return inputHandler;
+}
+
+uint64_t Game::getTickCount() const
+{
+    return tickCount;
+}
+
+bool Game::wasLastMoveTurn() const
+{
+    return lastMoveTurned;
+}
+
+InputHandler::Clock::time_point Game::getLastTurnPressTime() const
+{
+    return lastTurnPressedAt;
+}
+
+void Game::processKeyPress(int keyCode, InputHandler::Clock::time_point timestamp)
 {
     // Forward the key press to our input handler
-    inputHandler.processKeyPress(keyCode);
+    inputHandler.processKeyPress(keyCode, timestamp);
 
-    // Apply the new direction to the snake immediately
-    snake.changeDirection(inputHandler.getInput());
+    // Turn right away if the snake hasn't turned since its last move
+    applyQueuedTurn();
 
     // Process special key presses for game control (like pause)
     if (keyCode == 'p')
@@ -227,6 +466,29 @@ void Game::reset()
     initialize();
 }
 
+void Game::resize(int boardWidth, int boardHeight)
+{
+    board.resize(boardWidth, boardHeight);
+    snake.setInitialPosition(Position(boardWidth / 2, boardHeight / 2));
+}
+
+void Game::reserveEvents()
+{
+    // Worst tick: tail, head, eaten and died, plus every entity expiring and each lost
+    // food being replaced, plus a raised food count being filled
+    const size_t worstTick = 4 + 2 * entities.size() + static_cast<size_t>(foodCount);
+    if (events.capacity() < worstTick)
+    {
+        // Grow ahead so bulk spawning doesn't reallocate on every entity
+        events.reserve(worstTick * 2);
+    }
+}
+
+void Game::emit(GameEvent::Type type, const Position& position, int value)
+{
+    events.push_back(GameEvent{type, position, value});
+}
+
 void Game::initializeSnake()
 {
     // Place snake on board
@@ -1,9 +1,14 @@
 #pragma once
 
 #include "game/Board.h"
+#include "game/EntityStore.h"
 #include "game/Food.h"
+#include "game/GameEvent.h"
 #include "game/Snake.h"
+#include "game/TimerWheel.h"
 #include "input/InputHandler.h"
+#include <cstdint>
+#include <vector>
 
 namespace GreedySnake
 {
@@ -22,6 +27,10 @@ class Game
      */
     Game(int boardWidth = 20, int boardHeight = 20, int initialSnakeLength = 3);
 
+    // Lifetime timers point back into the game
+    Game(const Game&) = delete;
+    Game& operator=(const Game&) = delete;
+
     /**
      * @brief Initialize game state and components
      */
@@ -40,6 +49,8 @@ class Game
 
     /**
      * @brief Process player input
+     *
+     * Applies the next queued turn unless one was already taken this tick.
      */
     void handleInput();
 
@@ -49,11 +60,31 @@ class Game
     void checkCollisions();
 
     /**
-     * @brief Generate new food at random position
+     * @brief Place one more food on a random empty cell
+     *
+     * The food is worth Food::getValue() points. Emits FOOD_SPAWNED when the
+     * food is placed.
+     *
      * @return True if food was successfully generated
      */
     bool generateFood();
 
+    /**
+     * @brief Set how many food items the board holds
+     *
+     * initialize() places this many and every eaten or expired item tops the
+     * board back up, as far as there is room.
+     *
+     * @param count Food items on the board (at least 0)
+     */
+    void setFoodCount(int count);
+
+    /**
+     * @brief Get how many food items the board holds
+     * @return Food count
+     */
+    [[nodiscard]] int getFoodCount() const;
+
     /**
      * @brief Check if game is over
      * @return True if game is over
@@ -79,11 +110,80 @@ class Game
     [[nodiscard]] const Snake& getSnake() const;
 
     /**
-     * @brief Get the food
+     * @brief Get the food generator: the value of new food and the last position placed
      * @return Reference to the food
      */
     [[nodiscard]] const Food& getFood() const;
 
+    /**
+     * @brief Place an entity on an empty cell
+     *
+     * Food counts towards the food count while it lasts; obstacles block
+     * their cell like a wall. Emits FOOD_SPAWNED or OBSTACLE_PLACED. A
+     * lifetime is a timer on the game's wheel, cancelled if the entity goes
+     * earlier.
+     *
+     * @param kind What to place
+     * @param position Board cell, which must be empty
+     * @param value Points for food
+     * @param lifetimeTicks Moves until the entity disappears, 0 to keep it
+     * @return Id of the entity, or EntityStore::INVALID_ENTITY if the cell is taken
+     */
+    EntityStore::EntityId spawnEntity(EntityKind kind,
+                                      const Position& position,
+                                      int value = 1,
+                                      uint64_t lifetimeTicks = 0);
+
+    /**
+     * @brief Get the food, obstacles and other entities on the board
+     * @return Reference to the entity store
+     */
+    [[nodiscard]] const EntityStore& getEntities() const;
+
+    /**
+     * @brief Get the changes made by the last update()
+     *
+     * The buffer is reused: it is cleared at the start of every update()
+     * and by initialize(), which leaves only the initial FOOD_SPAWNED events.
+     * Consumers that need the full state after a reset read it from the
+     * board and snake.
+     *
+     * @return Events in the order they happened
+     */
+    [[nodiscard]] const std::vector<GameEvent>& getEvents() const;
+
+    /**
+     * @brief Run a callback after a number of game ticks
+     *
+     * Timers fire from update(), after the move and its collisions, and only
+     * count ticks, so replaying the same inputs fires them at the same moves.
+     * initialize() cancels all timers.
+     *
+     * @param delayTicks Ticks from now; 0 fires on the next update()
+     * @param callback Function to call
+     * @param context Passed to the callback
+     * @return Handle for cancelTimer(), or TimerWheel::INVALID_TIMER if too many are pending
+     */
+    TimerWheel::TimerId scheduleTimer(uint64_t delayTicks,
+                                      TimerWheel::Callback callback,
+                                      void* context);
+
+    /**
+     * @brief Cancel a timer before it fires
+     * @param id Handle returned by scheduleTimer()
+     * @return True if the timer was pending
+     */
+    bool cancelTimer(TimerWheel::TimerId id);
+
+    /**
+     * @brief Get the game's timers
+     *
+     * Entity lifetimes run on the same wheel and count as pending timers.
+     *
+     * @return Reference to the timer wheel
+     */
+    [[nodiscard]] const TimerWheel& getTimers() const;
+
     /**
      * @brief Pause the game
      */
@@ -102,15 +202,56 @@ class Game
 
     /**
      * @brief Process a key press
+     *
+     * The first turn since the last move is applied right away; further
+     * turns wait in the input queue and are taken one per tick.
+     *
      * @param keyCode The key code of the pressed key
+     * @param timestamp When the key was pressed
+     */
+    void processKeyPress(int keyCode,
+                         InputHandler::Clock::time_point timestamp = InputHandler::Clock::now());
+
+    /**
+     * @brief Get the input handler (queued turns and input counters)
+     * @return Reference to the input handler
      */
-    void processKeyPress(int keyCode);
+    [[nodiscard]] const InputHandler& getInputHandler() const;
+
+    /**
+     * @brief Get the number of moves since the game started
+     * @return Tick count
+     */
+    [[nodiscard]] uint64_t getTickCount() const;
+
+    /**
+     * @brief Check if the last move went in a newly turned direction
+     * @return True if the last update() consumed a turn
+     */
+    [[nodiscard]] bool wasLastMoveTurn() const;
+
+    /**
+     * @brief Get when the key of the last consumed turn was pressed
+     * @return Timestamp of the turn's input event (valid if wasLastMoveTurn())
+     */
+    [[nodiscard]] InputHandler::Clock::time_point getLastTurnPressTime() const;
 
     /**
      * @brief Reset game to initial state
      */
     void reset();
 
+    /**
+     * @brief Change the board size for the next initialize()
+     *
+     * Board and snake storage is kept when the size is unchanged, so a
+     * restarted game does not allocate.
+     *
+     * @param boardWidth New board width
+     * @param boardHeight New board height
+     */
+    void resize(int boardWidth, int boardHeight);
+
   private:
     Board board;
     Snake snake;
@@ -121,11 +262,84 @@ class Game
     bool paused;
     int score;
     int gameSpeed;
+    bool turnTaken; // A turn was applied since the last move
+    InputHandler::Clock::time_point turnPressedAt; // Key press of the applied turn
+    uint64_t tickCount;
+    bool lastMoveTurned;
+    InputHandler::Clock::time_point lastTurnPressedAt;
+    std::vector<GameEvent> events;
+    TimerWheel timers;
+    EntityStore entities;
+    std::vector<EntityStore::EntityId> cellEntities; // Per cell (row-major), for O(1) lookups
+
+    // Lifetime timer of the entity in a cell; timers get the record as context
+    struct CellTimer
+    {
+        Game* game;
+        TimerWheel::TimerId timer;
+    };
+    std::vector<CellTimer> cellTimers;
+    int foodCount;
+    int foodOnBoard;
 
     /**
      * @brief Initialize the snake position
      */
     void initializeSnake();
+
+    /**
+     * @brief Apply the next valid queued turn, at most one per tick
+     */
+    void applyQueuedTurn();
+
+    /**
+     * @brief Eat the food at a dense entity index
+     */
+    void eatFoodAt(size_t index);
+
+    /**
+     * @brief Top the board up after food left it; ends the game if none is left
+     */
+    void replaceFood();
+
+    /**
+     * @brief Place food until the board holds the food count
+     * @return False if the board ran out of room first
+     */
+    bool refillFood();
+
+    /**
+     * @brief Take the entity at a dense index off the board
+     */
+    void removeEntityAt(size_t index);
+
+    /**
+     * @brief Get a cell's slot in cellEntities
+     */
+    [[nodiscard]] size_t cellIndex(const Position& position) const;
+
+    /**
+     * @brief Timer callback ending the lifetime of the entity in a cell
+     */
+    static void onEntityExpired(void* context, TimerWheel::TimerId id);
+
+    /**
+     * @brief Remove the entity in a cell because its lifetime ended
+     */
+    void expireEntity(size_t cell);
+
+    /**
+     * @brief Make room for the events of the worst possible tick
+     *
+     * Called whenever entities are added or the food count may have grown,
+     * so emitting only allocates when the board holds more than ever before.
+     */
+    void reserveEvents();
+
+    /**
+     * @brief Append an event to this tick's stream
+     */
+    void emit(GameEvent::Type type, const Position& position, int value = 0);
 };
 
 } // namespace GreedySnake
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "game/GameApp.h"
 #include "menu/MainMenuState.h"
+#include "renderer/NcursesRenderer.h"
 #include "renderer/SFMLRenderer.h"
 #include <chrono>
 #include <iostream>
@@ -8,8 +9,23 @@
 namespace GreedySnake
 {
 
+namespace
+{
+// How often the main thread polls window events while the simulation runs on its own thread
+const std::chrono::milliseconds INPUT_POLL_INTERVAL(1);
+} // namespace
+
 GameApp::GameApp(int windowWidth, int windowHeight, const std::string& windowTitle)
-    : windowWidth(windowWidth), windowHeight(windowHeight), windowTitle(windowTitle)
+    : windowWidth(windowWidth),
+      windowHeight(windowHeight),
+      windowTitle(windowTitle),
+      snapshotRenderer(snapshotBuffer),
+      renderThreadEnabled(false),
+      renderThreadActive(false),
+      simulationThreadEnabled(false),
+      simulationRunning(false),
+      simulationStopRequested(false),
+      rendererType(RendererType::SFML)
 {
 }
 
@@ -20,23 +36,70 @@ GameApp::~GameApp()
     {
         renderer->shutdown();
     }
+    audio.shutdown();
 }
 
 bool GameApp::initialize()
 {
     try
     {
-        // Initialize settings (load from file or use defaults)
-        settings = std::make_unique<GameSettings>();
-        settings->loadFromFile(); // Try to load from default location
+        // Load settings in the background; nothing needs them before a game starts
+        StartupTimer* timer = &startupTimer;
+        pendingSettings = std::async(std::launch::async, [timer]() {
+            const auto begin = StartupTimer::Clock::now();
+            auto loaded = std::make_unique<GameSettings>();
+            loaded->loadFromFile(); // Try to load from default location
+            timer->recordPhase("settings", begin);
+            return loaded;
+        });
 
         // Create the renderer
-        renderer = std::make_unique<SFMLRenderer>(windowWidth, windowHeight, windowTitle);
+        SFMLRenderer* sfmlRenderer = nullptr;
+        if (rendererType == RendererType::NCURSES)
+        {
+            renderer = std::make_unique<NcursesRenderer>();
+
+            // Terminals gain nothing from redrawing faster than this
+            frameScheduler.setRefreshRate(30.0f);
+        }
+        else
+        {
+            auto windowRenderer =
+                std::make_unique<SFMLRenderer>(windowWidth, windowHeight, windowTitle);
+            windowRenderer->setAtlasPath(atlasPath);
+            windowRenderer->setStartupTimer(&startupTimer);
+            windowRenderer->setLatencyTracker(&latencyTracker);
+            sfmlRenderer = windowRenderer.get();
+            renderer = std::move(windowRenderer);
+        }
+        const auto rendererBegin = StartupTimer::Clock::now();
         if (!renderer->initialize())
         {
             std::cerr << "Failed to initialize renderer!" << std::endl;
             return false;
         }
+        startupTimer.recordPhase("renderer", rendererBegin);
+
+        // Sound is optional; stays muted until the settings enable it
+        const auto audioBegin = StartupTimer::Clock::now();
+        if (!audio.initialize())
+        {
+            std::cerr << "Failed to initialize audio, continuing without sound" << std::endl;
+        }
+        startupTimer.recordPhase("audio", audioBegin);
+
+        // Start recording once the window exists
+        if (!capturePath.empty())
+        {
+            const bool isVideo = capturePath.size() >= 4 &&
+                                 capturePath.compare(capturePath.size() - 4, 4, ".y4m") == 0;
+            const auto format =
+                isVideo ? FrameRecorder::Format::Y4M : FrameRecorder::Format::PNG_SEQUENCE;
+            if (sfmlRenderer == nullptr || !sfmlRenderer->startCapture(capturePath, format))
+            {
+                std::cerr << "Failed to start recording to " << capturePath << std::endl;
+            }
+        }
 
         // Create state manager with this app as owner
         stateManager = std::make_unique<GameStateManager>(this);
@@ -61,28 +124,29 @@ int GameApp::run()
         return 1;
     }
 
-    // Time tracking for game updates
-    auto lastFrameTime = std::chrono::steady_clock::now();
+    frameScheduler.reset();
 
-    // Main game loop
-    while (renderer->isWindowOpen() && stateManager->hasActiveState())
-    {
-        // Calculate delta time
-        auto currentTime = std::chrono::steady_clock::now();
-        float deltaTime = std::chrono::duration<float>(currentTime - lastFrameTime).count();
-        lastFrameTime = currentTime;
+    // Hand drawing over to the renderer's own thread if requested
+    renderThreadActive = renderThreadEnabled && renderer->startRenderThread(snapshotBuffer);
 
-        // Process input events
-        processInput();
-
-        // Update game state
-        update(deltaTime);
+    if (renderThreadActive && simulationThreadEnabled)
+    {
+        runSimulationThread();
+    }
+    else
+    {
+        runGameLoop();
+    }
 
-        // Render the current frame
-        render();
+    if (renderThreadActive)
+    {
+        renderer->stopRenderThread();
+        renderThreadActive = false;
+    }
 
-        // Limit CPU usage
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    if (latencyTracker.getTotalSampleCount() > 0)
+    {
+        std::cout << latencyTracker.formatReport() << std::endl;
     }
 
     return 0;
@@ -90,35 +154,170 @@ int GameApp::run()
 
 GameSettings* GameApp::getSettings()
 {
+    if (!settings && pendingSettings.valid())
+    {
+        settings = pendingSettings.get();
+    }
     return settings.get();
 }
 
+LatencyTracker& GameApp::getLatencyTracker()
+{
+    return latencyTracker;
+}
+
+void GameApp::setLatencyOverlayEnabled(bool enabled)
+{
+    latencyTracker.setOverlayEnabled(enabled);
+}
+
+AudioEngine& GameApp::getAudio()
+{
+    return audio;
+}
+
 GameStateManager* GameApp::getStateManager()
 {
     return stateManager.get();
 }
 
+const FrameScheduler& GameApp::getFrameScheduler() const
+{
+    return frameScheduler;
+}
+
+const StartupTimer& GameApp::getStartupTimer() const
+{
+    return startupTimer;
+}
+
+void GameApp::setRenderThreadEnabled(bool enabled)
+{
+    renderThreadEnabled = enabled;
+}
+
+void GameApp::setSimulationThreadEnabled(bool enabled)
+{
+    simulationThreadEnabled = enabled;
+}
+
+void GameApp::setRendererType(RendererType type)
+{
+    rendererType = type;
+}
+
+void GameApp::setCapturePath(const std::string& path)
+{
+    capturePath = path;
+}
+
+void GameApp::setAtlasPath(const std::string& path)
+{
+    atlasPath = path;
+}
+
 void GameApp::processInput()
 {
-    // Process window events and translate to our Input enum
-    // This will depend on the renderer implementation
-    // For SFML, we'll need to handle events and translate them
+    // Drain every event of this frame so fast key sequences aren't held back a frame
+    frameInputs.clear();
+    if (renderer->handleEvents(frameInputs) && !frameInputs.empty())
+    {
+        stateManager->processInput(frameInputs);
+    }
+}
+
+void GameApp::runGameLoop()
+{
+    while (renderer->isWindowOpen() && stateManager->hasActiveState())
+    {
+        // Wait for the next refresh or game tick, whichever comes first
+        float deltaTime = frameScheduler.waitForNextFrame(stateManager->getTimeUntilTick());
+
+        // Sample input right after waking so the tick sees the freshest events
+        processInput();
+
+        // Update game state
+        update(deltaTime);
+
+        // Render the current frame
+        render();
+
+        // Renderers that can't show a frame before the loop have shown one now
+        if (!startupTimer.hasFirstFrame())
+        {
+            startupTimer.markFirstFrame();
+        }
+    }
+}
+
+void GameApp::runSimulationThread()
+{
+    simulationStopRequested = false;
+    simulationRunning = true;
+    std::thread simulation(&GameApp::simulationLoop, this);
+
+    // SFML only delivers window events to the thread that created the window
+    InputBatch polled;
+    while (renderer->isWindowOpen() && simulationRunning)
+    {
+        polled.clear();
+        renderer->handleEvents(polled);
+        for (const InputEvent& event : polled)
+        {
+            // A full queue means the simulation has stalled; drop like a full InputBatch
+            inputQueue.push(event);
+        }
+        std::this_thread::sleep_for(INPUT_POLL_INTERVAL);
+    }
 
-    // Example of translating SFML events to our Input type
-    // and forwarding them to the state manager
-    Input input = Input::NONE;
+    simulationStopRequested = true;
+    simulation.join();
+}
 
-    if (renderer->handleEvents(input))
+void GameApp::simulationLoop()
+{
+    while (!simulationStopRequested && stateManager->hasActiveState())
     {
-        if (input != Input::NONE)
+        float deltaTime = frameScheduler.waitForNextFrame(stateManager->getTimeUntilTick());
+
+        // Everything the main thread queued since the last frame, in arrival order
+        frameInputs.clear();
+        InputEvent event{};
+        while (inputQueue.pop(event))
+        {
+            frameInputs.add(event.input, event.timestamp);
+        }
+        if (!frameInputs.empty())
         {
-            stateManager->processInput(input);
+            stateManager->processInput(frameInputs);
+        }
+
+        update(deltaTime);
+        render();
+
+        if (!startupTimer.hasFirstFrame())
+        {
+            startupTimer.markFirstFrame();
         }
     }
+    simulationRunning = false;
 }
 
 void GameApp::update(float deltaTime)
 {
+    // Pick up the background-loaded settings without blocking the loop
+    if (!settings && pendingSettings.valid() &&
+        pendingSettings.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        settings = pendingSettings.get();
+    }
+
+    // Follow the sound setting, including changes saved from the settings menu
+    if (settings)
+    {
+        audio.setEnabled(settings->isSoundEnabled());
+    }
+
     if (stateManager->hasActiveState())
     {
         stateManager->update(deltaTime);
@@ -127,9 +326,25 @@ void GameApp::update(float deltaTime)
 
 void GameApp::render()
 {
-    if (stateManager->hasActiveState())
+    if (!stateManager->hasActiveState())
+    {
+        return;
+    }
+
+    // In threaded mode this only publishes a snapshot; the render thread draws it
+    if (renderThreadActive)
+    {
+        stateManager->render(snapshotRenderer);
+    }
+    else
     {
         stateManager->render(*renderer);
+
+        // The SFML renderer reports its own window.display(); others present on return
+        if (rendererType != RendererType::SFML)
+        {
+            latencyTracker.markPresented();
+        }
     }
 }
 
@@ -1,9 +1,18 @@
 #ifndef GREEDYSNAKE_GAMEAPP_H
 #define GREEDYSNAKE_GAMEAPP_H
 
+#include "audio/AudioEngine.h"
+#include "game/FrameScheduler.h"
+#include "game/LatencyTracker.h"
+#include "game/StartupTimer.h"
 #include "menu/GameStateManager.h"
+#include "renderer/RenderSnapshot.h"
 #include "renderer/Renderer.h"
+#include "renderer/SnapshotRenderer.h"
 #include "settings/GameSettings.h"
+#include "utils/SpscQueue.h"
+#include <atomic>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -19,6 +28,15 @@ namespace GreedySnake
 class GameApp
 {
   public:
+    /**
+     * @brief Available rendering backends
+     */
+    enum class RendererType
+    {
+        SFML,   // Graphical window
+        NCURSES // Text-mode terminal, no display server needed
+    };
+
     /**
      * @brief Constructor
      * @param windowWidth The width of the game window
@@ -46,6 +64,10 @@ class GameApp
 
     /**
      * @brief Get access to the game settings
+     *
+     * Settings are loaded in the background during initialize(); the first
+     * call waits for them if they are not ready yet.
+     *
      * @return Pointer to the game settings
      */
     GameSettings* getSettings();
@@ -56,6 +78,91 @@ class GameApp
      */
     GameStateManager* getStateManager();
 
+    /**
+     * @brief Get the sound effect engine
+     * @return Reference to the audio engine (muted while sound is disabled)
+     */
+    AudioEngine& getAudio();
+
+    /**
+     * @brief Get the frame scheduler pacing the main loop
+     * @return Reference to the frame scheduler (for frame-time statistics)
+     */
+    [[nodiscard]] const FrameScheduler& getFrameScheduler() const;
+
+    /**
+     * @brief Get the startup phase timings and time-to-first-frame
+     * @return Reference to the startup timer (counting from construction)
+     */
+    [[nodiscard]] const StartupTimer& getStartupTimer() const;
+
+    /**
+     * @brief Get the input-to-display latency measurements
+     *
+     * The percentiles are logged when run() returns.
+     *
+     * @return Reference to the latency tracker
+     */
+    LatencyTracker& getLatencyTracker();
+
+    /**
+     * @brief Show input latency percentiles over the game board
+     * @param enabled True to draw the debug overlay
+     */
+    void setLatencyOverlayEnabled(bool enabled);
+
+    /**
+     * @brief Enable or disable drawing on a dedicated render thread
+     *
+     * When enabled, the simulation publishes snapshots into a triple buffer and
+     * the renderer draws them on its own thread. Falls back to single-threaded
+     * rendering if the renderer does not support it. Takes effect on run().
+     *
+     * @param enabled True to render on a separate thread
+     */
+    void setRenderThreadEnabled(bool enabled);
+
+    /**
+     * @brief Enable or disable running the simulation on its own thread
+     *
+     * Needs the render thread. The main thread then only polls window events
+     * and queues them for the simulation thread, which updates the states and
+     * publishes snapshots; neither side takes a lock. Falls back to the
+     * single game loop if the render thread is not running. Takes effect on run().
+     *
+     * @param enabled True to simulate on a separate thread
+     */
+    void setSimulationThreadEnabled(bool enabled);
+
+    /**
+     * @brief Choose the rendering backend
+     *
+     * Must be called before initialize(). Defaults to RendererType::SFML.
+     *
+     * @param type Renderer to create
+     */
+    void setRendererType(RendererType type);
+
+    /**
+     * @brief Record the displayed frames to disk
+     *
+     * Must be called before initialize(). Paths ending in ".y4m" produce an
+     * uncompressed video; any other path is used as the file name prefix of a
+     * PNG sequence. Only supported by the SFML renderer.
+     *
+     * @param path Output path, empty to disable recording
+     */
+    void setCapturePath(const std::string& path);
+
+    /**
+     * @brief Draw the game sprites from a themed atlas image
+     *
+     * Must be called before initialize(). Only supported by the SFML renderer.
+     *
+     * @param path Atlas image, empty to use the generated sprites
+     */
+    void setAtlasPath(const std::string& path);
+
   private:
     // Game window configuration
     int windowWidth;
@@ -65,11 +172,42 @@ class GameApp
     // Core components
     std::unique_ptr<Renderer> renderer;
     std::unique_ptr<GameSettings> settings;
+    std::future<std::unique_ptr<GameSettings>> pendingSettings;
     std::unique_ptr<GameStateManager> stateManager;
+    FrameScheduler frameScheduler;
+    StartupTimer startupTimer;
+    LatencyTracker latencyTracker;
+    AudioEngine audio;
+    InputBatch frameInputs; // Inputs read this frame, reused to avoid allocation
+
+    // Threaded rendering: states render into snapshots consumed by the renderer's thread
+    RenderSnapshotBuffer snapshotBuffer;
+    SnapshotRenderer snapshotRenderer;
+    bool renderThreadEnabled;
+    bool renderThreadActive;
+
+    // Threaded simulation: inputs polled on the main thread, consumed by the simulation thread
+    static constexpr size_t INPUT_QUEUE_SIZE = 64;
+    SpscQueue<InputEvent, INPUT_QUEUE_SIZE> inputQueue;
+    bool simulationThreadEnabled;
+    std::atomic<bool> simulationRunning;
+    std::atomic<bool> simulationStopRequested;
+    RendererType rendererType;
+    std::string capturePath;
+    std::string atlasPath;
 
     // Process input events
     void processInput();
 
+    // Main game loop: input, update and render on the calling thread
+    void runGameLoop();
+
+    // Poll input on this thread while the states run on a simulation thread
+    void runSimulationThread();
+
+    // Simulation thread entry point: consume queued inputs, update and publish snapshots
+    void simulationLoop();
+
     // Update game state
     void update(float deltaTime);
 
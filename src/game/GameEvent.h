@@ -0,0 +1,33 @@
+#pragma once
+
+#include "utils/Position.h"
+#include <cstdint>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief A change to the game made by a single update
+ *
+ * Game::update() records these in order so consumers can apply the tick's
+ * changes without diffing the board or the snake.
+ */
+struct GameEvent
+{
+    enum class Type : uint8_t
+    {
+        HEAD_MOVED,      // The snake's head entered position
+        TAIL_VACATED,    // The snake's tail left position (not emitted while growing)
+        FOOD_EATEN,      // Food at position was eaten; value is the points scored
+        FOOD_SPAWNED,    // New food was placed at position; value is its points
+        OBSTACLE_PLACED, // An obstacle now blocks position
+        ENTITY_EXPIRED,  // The entity at position ran out of time; value is its EntityKind
+        DIED             // The game ended with the head at position; value is the final score
+    };
+
+    Type type;
+    Position position;
+    int value;
+};
+
+} // namespace GreedySnake
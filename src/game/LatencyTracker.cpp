@@ -0,0 +1,203 @@
+#include "game/LatencyTracker.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+namespace GreedySnake
+{
+
+namespace
+{
+// Inputs waiting for a frame; more than this means frames aren't being presented
+const size_t MAX_PENDING = 64;
+
+float millisecondsBetween(LatencyTracker::Clock::time_point from,
+                          LatencyTracker::Clock::time_point to)
+{
+    return std::chrono::duration<float, std::milli>(to - from).count();
+}
+} // namespace
+
+LatencyTracker::LatencyTracker() : nextSample(0), totalSamples(0), overlayEnabled(false)
+{
+    pending.reserve(MAX_PENDING);
+    samples.reserve(MAX_SAMPLES);
+}
+
+void LatencyTracker::recordConsumed(Clock::time_point pressedAt,
+                                    uint64_t tick,
+                                    Clock::time_point consumedAt)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pending.size() < MAX_PENDING)
+    {
+        pending.push_back(Pending{pressedAt, consumedAt, tick});
+    }
+}
+
+void LatencyTracker::markPresented(Clock::time_point presentedAt)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    completeLocked(UINT64_MAX, presentedAt);
+}
+
+void LatencyTracker::markPresented(uint64_t frameTick, Clock::time_point presentedAt)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    completeLocked(frameTick, presentedAt);
+}
+
+void LatencyTracker::discardPending()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    pending.clear();
+}
+
+void LatencyTracker::completeLocked(uint64_t frameTick, Clock::time_point presentedAt)
+{
+    // Inputs of later ticks move to the front and wait for a newer frame
+    size_t kept = 0;
+    for (const Pending& input : pending)
+    {
+        if (input.tick > frameTick)
+        {
+            pending[kept++] = input;
+            continue;
+        }
+
+        const Sample sample{input.tick,
+                            millisecondsBetween(input.pressedAt, input.consumedAt),
+                            millisecondsBetween(input.pressedAt, presentedAt)};
+        if (samples.size() < MAX_SAMPLES)
+        {
+            samples.push_back(sample);
+        }
+        else
+        {
+            samples[nextSample] = sample;
+        }
+        nextSample = (nextSample + 1) % MAX_SAMPLES;
+        ++totalSamples;
+    }
+    pending.erase(pending.begin() + kept, pending.end());
+}
+
+size_t LatencyTracker::getSampleCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return samples.size();
+}
+
+uint64_t LatencyTracker::getTotalSampleCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return totalSamples;
+}
+
+float LatencyTracker::getPercentile(Stage stage, float percentile) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return percentileLocked(stage, percentile);
+}
+
+std::vector<LatencyTracker::Sample> LatencyTracker::getSamples() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (samples.size() < MAX_SAMPLES)
+    {
+        return samples;
+    }
+
+    // Full ring: the oldest sample is the next one to be overwritten
+    std::vector<Sample> ordered(samples.begin() + nextSample, samples.end());
+    ordered.insert(ordered.end(), samples.begin(), samples.begin() + nextSample);
+    return ordered;
+}
+
+std::string LatencyTracker::formatSummary() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (samples.empty())
+    {
+        return "Latency: no turns yet";
+    }
+
+    std::ostringstream summary;
+    summary << std::fixed << std::setprecision(1) << "Latency p50 "
+            << percentileLocked(Stage::INPUT_TO_DISPLAY, 50.0f) << " p95 "
+            << percentileLocked(Stage::INPUT_TO_DISPLAY, 95.0f) << " p99 "
+            << percentileLocked(Stage::INPUT_TO_DISPLAY, 99.0f) << " ms (" << samples.size()
+            << ")";
+    return summary.str();
+}
+
+std::string LatencyTracker::formatReport() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ostringstream report;
+    report << "Input latency over " << samples.size() << " turns";
+    if (samples.empty())
+    {
+        return report.str();
+    }
+
+    report << std::fixed << std::setprecision(2);
+    const std::pair<Stage, const char*> stages[] = {
+        {Stage::INPUT_TO_TICK, "input to tick"},
+        {Stage::INPUT_TO_DISPLAY, "input to display"},
+    };
+    for (const auto& [stage, name] : stages)
+    {
+        report << "\n  " << name << ": p50 " << percentileLocked(stage, 50.0f) << " ms, p95 "
+               << percentileLocked(stage, 95.0f) << " ms, p99 " << percentileLocked(stage, 99.0f)
+               << " ms, max " << percentileLocked(stage, 100.0f) << " ms";
+    }
+    return report.str();
+}
+
+void LatencyTracker::setOverlayEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    overlayEnabled = enabled;
+}
+
+bool LatencyTracker::isOverlayEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return overlayEnabled;
+}
+
+void LatencyTracker::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    pending.clear();
+    samples.clear();
+    nextSample = 0;
+    totalSamples = 0;
+}
+
+float LatencyTracker::percentileLocked(Stage stage, float percentile) const
+{
+    if (samples.empty())
+    {
+        return -1.0f;
+    }
+
+    std::vector<float> values;
+    values.reserve(samples.size());
+    for (const Sample& sample : samples)
+    {
+        values.push_back(stage == Stage::INPUT_TO_TICK ? sample.inputToTick
+                                                       : sample.inputToDisplay);
+    }
+
+    // Nearest-rank percentile
+    const float clamped = std::clamp(percentile, 0.0f, 100.0f);
+    const size_t rank = static_cast<size_t>(std::ceil(clamped / 100.0f * values.size()));
+    const size_t index = rank == 0 ? 0 : rank - 1;
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Measures how long a turn key takes to reach the screen
+ *
+ * Each sample follows one turn through three points: the key press (the
+ * timestamp of its window event), the game tick whose move consumed it, and
+ * the first presented frame after that tick. Frames may be presented on a
+ * render thread, so all methods are thread-safe. The most recent
+ * MAX_SAMPLES samples are kept for percentiles.
+ */
+class LatencyTracker
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t MAX_SAMPLES = 4096;
+
+    /**
+     * @brief Which part of the path to report
+     */
+    enum class Stage
+    {
+        INPUT_TO_TICK,   // Key press to the tick that moved the snake
+        INPUT_TO_DISPLAY // Key press to the frame that showed the move
+    };
+
+    /**
+     * @brief One turn that made it to the screen
+     */
+    struct Sample
+    {
+        uint64_t tick;        // Game tick that consumed the input
+        float inputToTick;    // Milliseconds
+        float inputToDisplay; // Milliseconds
+    };
+
+    /**
+     * @brief Constructor
+     */
+    LatencyTracker();
+
+    /**
+     * @brief Record that a tick consumed an input
+     *
+     * The sample completes at the first presented frame showing that tick.
+     *
+     * @param pressedAt Timestamp of the input event
+     * @param tick Number of the tick whose move used the input
+     * @param consumedAt When the tick ran
+     */
+    void recordConsumed(Clock::time_point pressedAt,
+                        uint64_t tick,
+                        Clock::time_point consumedAt = Clock::now());
+
+    /**
+     * @brief Record that a frame of the latest game state was presented
+     *
+     * For renderers that draw the current state on the calling thread, so
+     * every pending input is on screen.
+     *
+     * @param presentedAt When the frame was presented
+     */
+    void markPresented(Clock::time_point presentedAt = Clock::now());
+
+    /**
+     * @brief Record that a frame showing a given tick was presented
+     *
+     * A render thread may present a frame captured before the tick that
+     * consumed an input; such inputs stay pending for a later frame.
+     *
+     * @param frameTick Game tick the frame shows
+     * @param presentedAt When the frame was presented (after window.display() returned)
+     */
+    void markPresented(uint64_t frameTick, Clock::time_point presentedAt = Clock::now());
+
+    /**
+     * @brief Forget the inputs not presented yet, e.g. when a new game restarts the ticks
+     */
+    void discardPending();
+
+    /**
+     * @brief Get the number of completed samples kept
+     * @return Sample count, at most MAX_SAMPLES
+     */
+    [[nodiscard]] size_t getSampleCount() const;
+
+    /**
+     * @brief Get the total number of samples completed since the last reset
+     * @return Completed sample count
+     */
+    [[nodiscard]] uint64_t getTotalSampleCount() const;
+
+    /**
+     * @brief Get a latency percentile over the kept samples
+     * @param stage Which latency to report
+     * @param percentile Percentile in [0, 100]
+     * @return Milliseconds, or a negative value without samples
+     */
+    [[nodiscard]] float getPercentile(Stage stage, float percentile) const;
+
+    /**
+     * @brief Get the kept samples, oldest first
+     * @return Copy of the samples
+     */
+    [[nodiscard]] std::vector<Sample> getSamples() const;
+
+    /**
+     * @brief Format a one-line summary for the debug overlay
+     * @return Input-to-display p50/p95/p99 and the sample count
+     */
+    [[nodiscard]] std::string formatSummary() const;
+
+    /**
+     * @brief Format the percentiles of both stages for the log
+     * @return Multi-line report
+     */
+    [[nodiscard]] std::string formatReport() const;
+
+    /**
+     * @brief Show the summary over the game board
+     * @param enabled True to draw the overlay
+     */
+    void setOverlayEnabled(bool enabled);
+
+    /**
+     * @brief Check if the overlay is enabled
+     * @return True if the summary is drawn over the game board
+     */
+    [[nodiscard]] bool isOverlayEnabled() const;
+
+    /**
+     * @brief Forget all samples and pending inputs
+     */
+    void reset();
+
+  private:
+    // An input consumed by a tick that has not been presented yet
+    struct Pending
+    {
+        Clock::time_point pressedAt;
+        Clock::time_point consumedAt;
+        uint64_t tick;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<Pending> pending;
+    std::vector<Sample> samples; // Ring buffer once MAX_SAMPLES are kept
+    size_t nextSample;
+    uint64_t totalSamples;
+    bool overlayEnabled;
+
+    // Complete the pending inputs consumed by ticks up to frameTick; the mutex must be held
+    void completeLocked(uint64_t frameTick, Clock::time_point presentedAt);
+
+    // Percentile of one stage; the mutex must be held
+    [[nodiscard]] float percentileLocked(Stage stage, float percentile) const;
+};
+
+} // namespace GreedySnake
@@ -16,6 +16,10 @@ Snake::Snake(const Position& initialPosition, int initialLength, Direction initi
 
 Position Snake::move()
 {
+    // Remember where the ends were so renderers can interpolate the move
+    previousHead = getHead();
+    previousTail = body.empty() ? previousHead : body.back();
+
     // Determine the new head position based on current direction
     Position newHead = getHead();
 
@@ -108,6 +112,11 @@ bool Snake::containsPosition(const Position& position) const
     return std::find(body.begin(), body.end(), position) != body.end();
 }
 
+void Snake::setInitialPosition(const Position& position)
+{
+    initialPosition = position;
+}
+
 void Snake::reset()
 {
     // Clear the body
@@ -146,6 +155,10 @@ void Snake::reset()
     // Reset direction and growth flag
     currentDirection = initialDirection;
     hasGrown = false;
+
+    // No move has happened yet
+    previousHead = body.front();
+    previousTail = body.back();
 }
 
 Direction Snake::getCurrentDirection() const
@@ -153,4 +166,14 @@ Direction Snake::getCurrentDirection() const
     return currentDirection;
 }
 
+Position Snake::getPreviousHead() const
+{
+    return previousHead;
+}
+
+Position Snake::getPreviousTail() const
+{
+    return previousTail;
+}
+
 } // namespace GreedySnake
\ No newline at end of file
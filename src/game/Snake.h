@@ -74,14 +74,34 @@ class Snake
      */
     void reset();
 
+    /**
+     * @brief Set where the head starts; takes effect on the next reset()
+     * @param position New starting position of the head
+     */
+    void setInitialPosition(const Position& position);
+
     /**
      * @brief Get the current direction of the snake
      * @return Current direction
      */
     [[nodiscard]] Direction getCurrentDirection() const;
 
+    /**
+     * @brief Get the head position before the last move
+     * @return Previous head position (equals the head if the snake has not moved yet)
+     */
+    [[nodiscard]] Position getPreviousHead() const;
+
+    /**
+     * @brief Get the tail position before the last move
+     * @return Previous tail position (equals the tail if the snake grew or has not moved yet)
+     */
+    [[nodiscard]] Position getPreviousTail() const;
+
   private:
     std::vector<Position> body;
+    Position previousHead;
+    Position previousTail;
     Direction currentDirection;
     bool hasGrown;
     Position initialPosition;
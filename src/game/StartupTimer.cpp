@@ -0,0 +1,83 @@
+#include "game/StartupTimer.h"
+#include <iostream>
+
+namespace GreedySnake
+{
+
+StartupTimer::StartupTimer()
+    : startupBegin(Clock::now()), timeToFirstFrame(-1.0f), loggingEnabled(true)
+{
+}
+
+void StartupTimer::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    startupBegin = Clock::now();
+    phases.clear();
+    timeToFirstFrame = -1.0f;
+}
+
+void StartupTimer::setLoggingEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    loggingEnabled = enabled;
+}
+
+void StartupTimer::recordPhase(const std::string& name, Clock::time_point begin)
+{
+    const Clock::time_point end = Clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const Phase phase{name,
+                      millisecondsSinceStart(begin),
+                      std::chrono::duration<float, std::milli>(end - begin).count()};
+    phases.push_back(phase);
+
+    if (loggingEnabled)
+    {
+        std::cout << "Startup: " << name << " took " << phase.duration << " ms (done at "
+                  << millisecondsSinceStart(end) << " ms)" << std::endl;
+    }
+}
+
+void StartupTimer::markFirstFrame()
+{
+    const Clock::time_point now = Clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (timeToFirstFrame >= 0.0f)
+    {
+        return;
+    }
+
+    timeToFirstFrame = millisecondsSinceStart(now);
+    if (loggingEnabled)
+    {
+        std::cout << "Startup: time to first frame " << timeToFirstFrame << " ms" << std::endl;
+    }
+}
+
+bool StartupTimer::hasFirstFrame() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return timeToFirstFrame >= 0.0f;
+}
+
+float StartupTimer::getTimeToFirstFrame() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return timeToFirstFrame;
+}
+
+std::vector<StartupTimer::Phase> StartupTimer::getPhases() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return phases;
+}
+
+float StartupTimer::millisecondsSinceStart(Clock::time_point time) const
+{
+    return std::chrono::duration<float, std::milli>(time - startupBegin).count();
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Records how long each startup phase takes and when the first frame appears
+ *
+ * Phases may run on loader threads, so recording is thread-safe. Every phase
+ * is logged as it completes; time-to-first-frame is kept as a separate
+ * metric because it is what the player actually waits for.
+ */
+class StartupTimer
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief One completed startup phase
+     */
+    struct Phase
+    {
+        std::string name;
+        float startTime; // Milliseconds since startup began
+        float duration;  // Milliseconds
+    };
+
+    /**
+     * @brief Constructor; startup begins now
+     */
+    StartupTimer();
+
+    /**
+     * @brief Start over: forget all phases and the first frame
+     */
+    void reset();
+
+    /**
+     * @brief Print each phase as it is recorded
+     * @param enabled True to log to std::cout (default)
+     */
+    void setLoggingEnabled(bool enabled);
+
+    /**
+     * @brief Record a phase that ends now
+     * @param name Phase name
+     * @param begin When the phase started
+     */
+    void recordPhase(const std::string& name, Clock::time_point begin);
+
+    /**
+     * @brief Record that the first frame was shown; later calls are ignored
+     */
+    void markFirstFrame();
+
+    /**
+     * @brief Check whether the first frame was shown
+     * @return True once markFirstFrame() was called
+     */
+    [[nodiscard]] bool hasFirstFrame() const;
+
+    /**
+     * @brief Get the time from startup to the first frame
+     * @return Milliseconds, or a negative value if no frame was shown yet
+     */
+    [[nodiscard]] float getTimeToFirstFrame() const;
+
+    /**
+     * @brief Get the phases recorded so far
+     * @return Phases in the order they completed
+     */
+    [[nodiscard]] std::vector<Phase> getPhases() const;
+
+  private:
+    mutable std::mutex mutex;
+    Clock::time_point startupBegin;
+    std::vector<Phase> phases;
+    float timeToFirstFrame;
+    bool loggingEnabled;
+
+    // Milliseconds from startup to a time point
+    [[nodiscard]] float millisecondsSinceStart(Clock::time_point time) const;
+};
+
+} // namespace GreedySnake
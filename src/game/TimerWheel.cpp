@@ -0,0 +1,215 @@
+#include "game/TimerWheel.h"
+#include <algorithm>
+
+namespace GreedySnake
+{
+
+namespace
+{
+const uint64_t LEVEL_MASK = TimerWheel::SLOTS_PER_LEVEL - 1;
+const TimerWheel::TimerId INDEX_MASK = 0xFFFFFFFF;
+
+// Handles pack the pool index (plus one, so no handle is zero) with the slot's generation
+TimerWheel::TimerId makeId(uint32_t index, uint32_t generation)
+{
+    return (static_cast<TimerWheel::TimerId>(generation) << 32) | (index + 1);
+}
+} // namespace
+
+TimerWheel::TimerWheel(size_t capacity)
+    : timers(std::min(capacity, MAX_CAPACITY)), freeHead(NONE), currentTick(0), pendingCount(0)
+{
+    clear();
+}
+
+TimerWheel::TimerId TimerWheel::schedule(uint64_t delay, Callback callback, void* context)
+{
+    if (freeHead == NONE || callback == nullptr)
+    {
+        return INVALID_TIMER;
+    }
+
+    const uint32_t index = freeHead;
+    Timer& timer = timers[index];
+    freeHead = timer.next;
+
+    timer.expiry = currentTick + std::min(std::max<uint64_t>(delay, 1), MAX_DELAY);
+    timer.callback = callback;
+    timer.context = context;
+    insert(index);
+    ++pendingCount;
+    return makeId(index, timer.generation);
+}
+
+bool TimerWheel::cancel(TimerId id)
+{
+    const uint32_t index = static_cast<uint32_t>(id & INDEX_MASK) - 1;
+    if (id == INVALID_TIMER || index >= timers.size())
+    {
+        return false;
+    }
+
+    Timer& timer = timers[index];
+    if (timer.slot == NONE || makeId(index, timer.generation) != id)
+    {
+        return false;
+    }
+
+    unlink(index);
+    release(index);
+    return true;
+}
+
+void TimerWheel::advance()
+{
+    ++currentTick;
+
+    // Coarser levels first: their timers may land in a finer slot that is also due now
+    for (size_t level = LEVEL_COUNT - 1; level > 0; --level)
+    {
+        if ((currentTick & ((uint64_t(1) << (LEVEL_BITS * level)) - 1)) == 0)
+        {
+            cascade(level);
+        }
+    }
+
+    // Take timers off the front one by one so callbacks can cancel the rest safely
+    const uint32_t slot = static_cast<uint32_t>(currentTick & LEVEL_MASK);
+    while (slotHeads[slot] != NONE)
+    {
+        const uint32_t index = slotHeads[slot];
+        const Callback callback = timers[index].callback;
+        void* const context = timers[index].context;
+        const TimerId id = makeId(index, timers[index].generation);
+
+        unlink(index);
+        release(index);
+        callback(context, id);
+    }
+}
+
+void TimerWheel::clear()
+{
+    slotHeads.fill(NONE);
+    slotTails.fill(NONE);
+
+    // Chain the whole pool into the free list, keeping generations so old handles stay stale
+    freeHead = timers.empty() ? NONE : 0;
+    for (size_t i = 0; i < timers.size(); ++i)
+    {
+        Timer& timer = timers[i];
+        if (timer.slot != NONE)
+        {
+            ++timer.generation;
+        }
+        timer.slot = NONE;
+        timer.previous = NONE;
+        timer.next = i + 1 < timers.size() ? static_cast<uint32_t>(i + 1) : NONE;
+    }
+
+    currentTick = 0;
+    pendingCount = 0;
+}
+
+void TimerWheel::resize(size_t capacity)
+{
+    // Kept nodes keep their generations, so their old handles stay stale
+    timers.resize(std::min(capacity, MAX_CAPACITY));
+    clear();
+}
+
+uint64_t TimerWheel::getCurrentTick() const
+{
+    return currentTick;
+}
+
+size_t TimerWheel::getPendingCount() const
+{
+    return pendingCount;
+}
+
+size_t TimerWheel::getCapacity() const
+{
+    return timers.size();
+}
+
+void TimerWheel::insert(uint32_t index)
+{
+    Timer& timer = timers[index];
+
+    // The coarsest level needed for the remaining delay; its slot comes from the expiry
+    const uint64_t remaining = timer.expiry - currentTick;
+    size_t level = 0;
+    while (level + 1 < LEVEL_COUNT && remaining >= (uint64_t(1) << (LEVEL_BITS * (level + 1))))
+    {
+        ++level;
+    }
+    const uint32_t slot = static_cast<uint32_t>(
+        level * SLOTS_PER_LEVEL + ((timer.expiry >> (LEVEL_BITS * level)) & LEVEL_MASK));
+
+    timer.slot = slot;
+    timer.next = NONE;
+    timer.previous = slotTails[slot];
+    if (slotTails[slot] != NONE)
+    {
+        timers[slotTails[slot]].next = index;
+    }
+    else
+    {
+        slotHeads[slot] = index;
+    }
+    slotTails[slot] = index;
+}
+
+void TimerWheel::unlink(uint32_t index)
+{
+    Timer& timer = timers[index];
+    if (timer.previous != NONE)
+    {
+        timers[timer.previous].next = timer.next;
+    }
+    else
+    {
+        slotHeads[timer.slot] = timer.next;
+    }
+    if (timer.next != NONE)
+    {
+        timers[timer.next].previous = timer.previous;
+    }
+    else
+    {
+        slotTails[timer.slot] = timer.previous;
+    }
+}
+
+void TimerWheel::release(uint32_t index)
+{
+    Timer& timer = timers[index];
+    timer.slot = NONE;
+    timer.previous = NONE;
+    timer.callback = nullptr;
+    timer.context = nullptr;
+    ++timer.generation;
+    timer.next = freeHead;
+    freeHead = index;
+    --pendingCount;
+}
+
+void TimerWheel::cascade(size_t level)
+{
+    const uint32_t slot = static_cast<uint32_t>(
+        level * SLOTS_PER_LEVEL + ((currentTick >> (LEVEL_BITS * level)) & LEVEL_MASK));
+
+    // Detach the list first; re-inserting puts every timer on a finer level
+    uint32_t index = slotHeads[slot];
+    slotHeads[slot] = NONE;
+    slotTails[slot] = NONE;
+    while (index != NONE)
+    {
+        const uint32_t next = timers[index].next;
+        insert(index);
+        index = next;
+    }
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Hierarchical timer wheel counting game ticks
+ *
+ * Four levels of 64 slots cover delays of up to MAX_DELAY ticks. A timer sits
+ * in the slot of the coarsest level its delay needs and moves down a level
+ * each time that level's slot comes around, so scheduling, cancelling and
+ * each advance() cost O(1) apart from the timers that actually fire or move.
+ *
+ * Timers live in a fixed pool allocated by the constructor; callbacks are a
+ * function pointer plus context, so scheduling never allocates. Time only
+ * moves in advance(), which keeps replays deterministic.
+ */
+class TimerWheel
+{
+  public:
+    /**
+     * @brief Handle of a scheduled timer; stale handles are rejected by cancel()
+     *
+     * The low 32 bits hold the pool index, the high 32 bits the node's generation,
+     * so a handle stays stale however often its node is reused.
+     */
+    using TimerId = uint64_t;
+
+    /**
+     * @brief Called when a timer fires
+     * @param context Pointer given to schedule()
+     * @param id Handle of the timer that fired
+     */
+    using Callback = void (*)(void* context, TimerId id);
+
+    static constexpr TimerId INVALID_TIMER = 0;
+    static constexpr size_t LEVEL_BITS = 6;
+    static constexpr size_t SLOTS_PER_LEVEL = size_t(1) << LEVEL_BITS;
+    static constexpr size_t LEVEL_COUNT = 4;
+    static constexpr uint64_t MAX_DELAY = (uint64_t(1) << (LEVEL_BITS * LEVEL_COUNT)) - 1;
+    static constexpr size_t MAX_CAPACITY = 0xFFFFFFFE;
+
+    /**
+     * @brief Constructor
+     * @param capacity Most timers pending at once (at most MAX_CAPACITY)
+     */
+    explicit TimerWheel(size_t capacity = 256);
+
+    /**
+     * @brief Schedule a callback
+     * @param delay Ticks from now; 0 fires on the next advance(), longer delays are
+     *              clamped to MAX_DELAY
+     * @param callback Function to call when the timer fires
+     * @param context Passed to the callback
+     * @return Handle for cancel(), or INVALID_TIMER if the pool is exhausted
+     */
+    TimerId schedule(uint64_t delay, Callback callback, void* context);
+
+    /**
+     * @brief Cancel a pending timer
+     * @param id Handle returned by schedule()
+     * @return True if the timer was pending and will not fire
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * @brief Move time forward by one tick and fire the timers due
+     *
+     * Timers due in the same tick fire in the order they were scheduled.
+     * Callbacks may schedule and cancel timers.
+     */
+    void advance();
+
+    /**
+     * @brief Cancel every timer and restart the tick count at zero
+     */
+    void clear();
+
+    /**
+     * @brief Cancel every timer, restart at tick zero and change the pool size
+     *
+     * Storage is kept when the size is unchanged, so a restarted game does
+     * not allocate.
+     *
+     * @param capacity Most timers pending at once (at most MAX_CAPACITY)
+     */
+    void resize(size_t capacity);
+
+    /**
+     * @brief Get the number of ticks advanced since construction or clear()
+     * @return Current tick
+     */
+    [[nodiscard]] uint64_t getCurrentTick() const;
+
+    /**
+     * @brief Get the number of pending timers
+     * @return Pending timer count
+     */
+    [[nodiscard]] size_t getPendingCount() const;
+
+    /**
+     * @brief Get the number of timers that can be pending at once
+     * @return Pool size
+     */
+    [[nodiscard]] size_t getCapacity() const;
+
+  private:
+    static constexpr uint32_t NONE = 0xFFFFFFFF;
+    static constexpr size_t SLOT_COUNT = SLOTS_PER_LEVEL * LEVEL_COUNT;
+
+    struct Timer
+    {
+        uint64_t expiry = 0;
+        Callback callback = nullptr;
+        void* context = nullptr;
+        uint32_t previous = NONE; // Neighbours in the slot list (next also links the free list)
+        uint32_t next = NONE;
+        uint32_t slot = NONE; // Slot holding the timer, NONE while free
+        uint32_t generation = 0;
+    };
+
+    std::vector<Timer> timers;
+    std::array<uint32_t, SLOT_COUNT> slotHeads;
+    std::array<uint32_t, SLOT_COUNT> slotTails;
+    uint32_t freeHead;
+    uint64_t currentTick;
+    size_t pendingCount;
+
+    // Put a timer at the end of the slot matching its expiry
+    void insert(uint32_t index);
+
+    // Take a timer out of its slot
+    void unlink(uint32_t index);
+
+    // Return a timer to the free pool, invalidating its handle
+    void release(uint32_t index);
+
+    // Move the timers of a level's current slot down to finer levels
+    void cascade(size_t level);
+};
+
+} // namespace GreedySnake
@@ -3,7 +3,14 @@
 namespace GreedySnake
 {
 
-InputHandler::InputHandler() : currentDirection(Direction::RIGHT), quitRequested(false)
+InputHandler::InputHandler()
+    : currentDirection(Direction::RIGHT),
+      quitRequested(false),
+      queue{},
+      queueStart(0),
+      queueCount(0),
+      droppedCount(0),
+      mergedCount(0)
 {
 }
 
@@ -17,21 +24,21 @@ bool InputHandler::isQuitRequested() const
     return quitRequested;
 }
 
-void InputHandler::processKeyPress(int keyCode)
+void InputHandler::processKeyPress(int keyCode, Clock::time_point timestamp)
 {
     switch (keyCode)
     {
     case SNAKE_KEY_UP:
-        currentDirection = Direction::UP;
+        queueDirection(Direction::UP, timestamp);
         break;
     case SNAKE_KEY_DOWN:
-        currentDirection = Direction::DOWN;
+        queueDirection(Direction::DOWN, timestamp);
         break;
     case SNAKE_KEY_LEFT:
-        currentDirection = Direction::LEFT;
+        queueDirection(Direction::LEFT, timestamp);
         break;
     case SNAKE_KEY_RIGHT:
-        currentDirection = Direction::RIGHT;
+        queueDirection(Direction::RIGHT, timestamp);
         break;
     case SNAKE_KEY_QUIT:
         quitRequested = true;
@@ -42,10 +49,75 @@ void InputHandler::processKeyPress(int keyCode)
     }
 }
 
+bool InputHandler::takeTurn(Direction heading, DirectionEvent& turn)
+{
+    while (queueCount > 0)
+    {
+        const DirectionEvent event = queue[queueStart];
+        queueStart = (queueStart + 1) % QUEUE_SIZE;
+        --queueCount;
+
+        if (event.direction == heading)
+        {
+            ++mergedCount;
+        }
+        else if (event.direction == getOppositeDirection(heading))
+        {
+            ++droppedCount;
+        }
+        else
+        {
+            turn = event;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t InputHandler::getQueuedCount() const
+{
+    return queueCount;
+}
+
+uint64_t InputHandler::getDroppedCount() const
+{
+    return droppedCount;
+}
+
+uint64_t InputHandler::getMergedCount() const
+{
+    return mergedCount;
+}
+
 void InputHandler::reset()
 {
     currentDirection = Direction::RIGHT;
     quitRequested = false;
+    queueStart = 0;
+    queueCount = 0;
+    droppedCount = 0;
+    mergedCount = 0;
+}
+
+void InputHandler::queueDirection(Direction direction, Clock::time_point timestamp)
+{
+    currentDirection = direction;
+
+    // Holding or mashing a key adds nothing after its first press
+    if (queueCount > 0 && queue[(queueStart + queueCount - 1) % QUEUE_SIZE].direction == direction)
+    {
+        ++mergedCount;
+        return;
+    }
+
+    if (queueCount == QUEUE_SIZE)
+    {
+        ++droppedCount;
+        return;
+    }
+
+    queue[(queueStart + queueCount) % QUEUE_SIZE] = DirectionEvent{direction, timestamp};
+    ++queueCount;
 }
 
-} // namespace GreedySnake
\ No newline at end of file
+} // namespace GreedySnake
@@ -1,16 +1,40 @@
 #pragma once
 
 #include "utils/Direction.h"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 
 namespace GreedySnake
 {
 
 /**
  * @brief Handles player input for controlling the game
+ *
+ * Direction keys are queued with their timestamps in a small ring buffer
+ * so that several keys pressed within one tick (such as a quick UP, LEFT
+ * U-turn) are all turned into moves instead of only the last one counting.
  */
 class InputHandler
 {
   public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief A direction key waiting to be turned into a move
+     */
+    struct DirectionEvent
+    {
+        Direction direction;
+        Clock::time_point timestamp; // When the key was pressed
+    };
+
+    /**
+     * @brief Number of direction events that can wait between ticks
+     */
+    static constexpr size_t QUEUE_SIZE = 4;
+
     /**
      * @brief Constructor
      */
@@ -18,7 +42,7 @@ class InputHandler
 
     /**
      * @brief Gets the current input direction from player
-     * @return Direction to move the snake
+     * @return Most recently requested direction
      */
     Direction getInput();
 
@@ -31,8 +55,39 @@ class InputHandler
     /**
      * @brief Process a key press
      * @param keyCode The key code of the pressed key
+     * @param timestamp When the key was pressed
      */
-    void processKeyPress(int keyCode);
+    void processKeyPress(int keyCode, Clock::time_point timestamp = Clock::now());
+
+    /**
+     * @brief Take the next queued direction that is a valid turn
+     *
+     * Queued directions equal to the heading are discarded as merged and
+     * reversals are discarded as dropped, until a real turn is found.
+     *
+     * @param heading Direction the snake is currently moving in
+     * @param turn Set to the turn when one is found
+     * @return True if a turn was taken from the queue
+     */
+    bool takeTurn(Direction heading, DirectionEvent& turn);
+
+    /**
+     * @brief Get the number of direction events waiting
+     * @return Queued event count
+     */
+    [[nodiscard]] size_t getQueuedCount() const;
+
+    /**
+     * @brief Get the number of direction keys lost to a full queue or rejected as reversals
+     * @return Dropped input count
+     */
+    [[nodiscard]] uint64_t getDroppedCount() const;
+
+    /**
+     * @brief Get the number of direction keys that repeated the direction before them
+     * @return Merged input count
+     */
+    [[nodiscard]] uint64_t getMergedCount() const;
 
     /**
      * @brief Reset the input state
@@ -43,6 +98,16 @@ class InputHandler
     Direction currentDirection;
     bool quitRequested;
 
+    // Ring buffer of pending direction keys, oldest at queueStart
+    std::array<DirectionEvent, QUEUE_SIZE> queue;
+    size_t queueStart;
+    size_t queueCount;
+    uint64_t droppedCount;
+    uint64_t mergedCount;
+
+    // Queue a direction key, merging repeats and dropping it if the queue is full
+    void queueDirection(Direction direction, Clock::time_point timestamp);
+
     // Key codes (can be platform-specific)
     static const int SNAKE_KEY_UP = 119;    // W
     static const int SNAKE_KEY_DOWN = 115;  // S
@@ -51,4 +116,4 @@ class InputHandler
     static const int SNAKE_KEY_QUIT = 113;  // Q
 };
 
-} // namespace GreedySnake
\ No newline at end of file
+} // namespace GreedySnake
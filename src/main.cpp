@@ -1,23 +1,194 @@
+#include <algorithm>
 #include <chrono>
+#include <csignal>
 #include <cstdlib>
 #include <ctime>
+#include <iomanip>
 #include <iostream>
+#include <string>
 #include <thread>
+#include <vector>
 
+#include "game/Autopilot.h"
+#include "game/FrameScheduler.h"
 #include "game/GameApp.h"
+#include "renderer/SFMLRenderer.h"
+#include "server/ArcadeLoadTest.h"
+#include "server/ArcadeServer.h"
+#include "utils/QueueBenchmark.h"
 
 using namespace GreedySnake;
 
-int main()
+namespace
+{
+ArcadeServer* activeServer = nullptr;
+
+void stopServer(int)
+{
+    if (activeServer != nullptr)
+    {
+        activeServer->stop();
+    }
+}
+
+// Host terminal sessions until interrupted
+int runServer(const std::string& address)
+{
+    ArcadeServer server(address);
+    if (!server.start())
+    {
+        return 1;
+    }
+
+    activeServer = &server;
+    std::signal(SIGINT, stopServer);
+    std::signal(SIGTERM, stopServer);
+    server.run();
+    activeServer = nullptr;
+    return 0;
+}
+
+// Watch unattended games side by side in one window until it is closed
+int runSpectator(int gameCount)
+{
+    SFMLRenderer renderer(800, 600, "Greedy Snake - Spectator");
+    if (gameCount <= 0 || !renderer.initialize())
+    {
+        return 1;
+    }
+
+    std::vector<Game> games(static_cast<size_t>(gameCount));
+    std::vector<const Game*> tiles;
+    for (Game& game : games)
+    {
+        game.initialize();
+        tiles.push_back(&game);
+    }
+
+    // Frames follow the display; the games tick at the pace of a served session, 10 per second
+    FrameScheduler scheduler;
+    const float tickInterval = 0.1f;
+    const int maxCatchUpTicks = 5;
+    float sinceTick = 0.0f;
+
+    using Clock = std::chrono::steady_clock;
+    Clock::duration drawTime(0);
+    Clock::duration worstDrawTime(0);
+    uint64_t frames = 0;
+
+    Input input = Input::NONE;
+    while (renderer.handleEvents(input) && input != Input::QUIT && input != Input::BACK)
+    {
+        sinceTick += scheduler.waitForNextFrame(tickInterval - sinceTick);
+
+        // After a stall, catch up a few ticks and drop the rest
+        for (int ticks = 0; sinceTick >= tickInterval; ++ticks)
+        {
+            sinceTick = ticks < maxCatchUpTicks ? sinceTick - tickInterval : 0.0f;
+            for (Game& game : games)
+            {
+                if (game.isGameOver())
+                {
+                    game.reset();
+                }
+                Autopilot::steer(game);
+                game.update();
+            }
+        }
+
+        const Clock::time_point drawBegin = Clock::now();
+        renderer.renderSpectatorGrid(tiles);
+        const Clock::duration drawn = Clock::now() - drawBegin;
+        drawTime += drawn;
+        worstDrawTime = std::max(worstDrawTime, drawn);
+        ++frames;
+    }
+
+    if (frames > 0)
+    {
+        using Milliseconds = std::chrono::duration<double, std::milli>;
+        std::cout << std::fixed << std::setprecision(2) << "Spectator: " << gameCount
+                  << " boards, frame " << scheduler.getAverageFrameTime() * 1000.0f
+                  << " ms average (jitter " << scheduler.getFrameTimeJitter() * 1000.0f
+                  << " ms), drawing " << Milliseconds(drawTime).count() / frames
+                  << " ms average, " << Milliseconds(worstDrawTime).count() << " ms worst"
+                  << std::endl;
+    }
+    return 0;
+}
+} // namespace
+
+int main(int argc, char* argv[])
 {
     // Seed random number generator
     std::srand(static_cast<unsigned int>(std::time(nullptr)));
 
     try
     {
+        // Headless modes don't need a window
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (arg == "--serve" && i + 1 < argc)
+            {
+                return runServer(argv[i + 1]);
+            }
+            if (arg == "--load-test" && i + 2 < argc)
+            {
+                const float seconds = i + 3 < argc ? std::stof(argv[i + 3]) : 10.0f;
+                ArcadeLoadTest loadTest(argv[i + 1]);
+                return loadTest.run(std::stoi(argv[i + 2]), seconds) ? 0 : 1;
+            }
+            if (arg == "--queue-benchmark")
+            {
+                const uint64_t items = i + 1 < argc ? std::stoull(argv[i + 1]) : 10000000;
+                return QueueBenchmark::run(items) ? 0 : 1;
+            }
+        }
+
+        // Other modes that skip the menus
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::string(argv[i]) == "--spectate" && i + 1 < argc)
+            {
+                return runSpectator(std::stoi(argv[i + 1]));
+            }
+        }
+
         // Create and initialize the game application
         GameApp app(800, 600, "Greedy Snake - SFML Renderer");
 
+        // Parse command-line options
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            if (arg == "--render-thread")
+            {
+                app.setRenderThreadEnabled(true);
+            }
+            else if (arg == "--sim-thread")
+            {
+                app.setRenderThreadEnabled(true);
+                app.setSimulationThreadEnabled(true);
+            }
+            else if (arg == "--ncurses")
+            {
+                app.setRendererType(GameApp::RendererType::NCURSES);
+            }
+            else if (arg == "--record" && i + 1 < argc)
+            {
+                app.setCapturePath(argv[++i]);
+            }
+            else if (arg == "--atlas" && i + 1 < argc)
+            {
+                app.setAtlasPath(argv[++i]);
+            }
+            else if (arg == "--latency-overlay")
+            {
+                app.setLatencyOverlayEnabled(true);
+            }
+        }
+
         if (!app.initialize())
         {
             std::cerr << "Failed to initialize the game application!" << std::endl;
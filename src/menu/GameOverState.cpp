@@ -1,16 +1,17 @@
 #include "menu/GameOverState.h"
-#include "game/GameApp.h"
 #include "menu/GamePlayState.h"
 #include "menu/MainMenuState.h"
 #include "menu/TextMenuItem.h"
 #include "settings/GameSettings.h"
-#include <sstream>
+#include <string>
 
 namespace GreedySnake
 {
 
 GameOverState::GameOverState(GameStateManager* stateManager, int finalScore)
-    : stateManager(stateManager), finalScore(finalScore)
+    : stateManager(stateManager),
+      finalScore(finalScore),
+      title("Game Over! Score: " + std::to_string(finalScore))
 {
 }
 
@@ -18,6 +19,7 @@ void GameOverState::enter()
 {
     // Create menu items
     menu.clearItems();
+    menu.setAudio(stateManager->getAudio());
 
     // Play again option
     menu.addItem<TextMenuItem>("Play Again", [this]() { onPlayAgain(); });
@@ -52,11 +54,7 @@ void GameOverState::update(float deltaTime)
 
 void GameOverState::render(Renderer& renderer)
 {
-    // Create title with score
-    std::stringstream title;
-    title << "Game Over! Score: " << finalScore;
-
-    menu.render(renderer, title.str());
+    menu.render(renderer, title);
 }
 
 int GameOverState::getFinalScore() const
@@ -66,20 +64,8 @@ int GameOverState::getFinalScore() const
 
 void GameOverState::onPlayAgain()
 {
-    // Get the game settings from the GameApp
-    GameApp* app = dynamic_cast<GameApp*>(stateManager->getOwner());
-    if (app == nullptr)
-    {
-        // Fallback if we can't get the app context
-        GameSettings* settings = new GameSettings();
-        stateManager->changeState(std::make_unique<GamePlayState>(stateManager, settings));
-    }
-    else
-    {
-        // Use app's settings and create a new game play state
-        stateManager->changeState(
-            std::make_unique<GamePlayState>(stateManager, app->getSettings()));
-    }
+    // The finished game's state is retired by the change and entered again, reset in place
+    stateManager->changeToPooledState<GamePlayState>(stateManager, stateManager->getSettings());
 }
 
 void GameOverState::onMainMenu()
@@ -5,6 +5,7 @@
 #include "menu/GameStateManager.h"
 #include "menu/Menu.h"
 #include <memory>
+#include <string>
 
 namespace GreedySnake
 {
@@ -46,6 +47,7 @@ class GameOverState : public GameState
   private:
     GameStateManager* stateManager;
     int finalScore;
+    std::string title; // Formatted once; the score doesn't change
     Menu menu;
 
     // Callback methods for menu items
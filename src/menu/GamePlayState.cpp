@@ -1,23 +1,62 @@
 #include "menu/GamePlayState.h"
+#include "game/GameApp.h"
 #include "menu/GameOverState.h"
+#include "renderer/FrameLayout.h"
+#include "renderer/PixelBuffer.h"
+#include <algorithm>
 
 namespace GreedySnake
 {
 
+namespace
+{
+const uint32_t EAT_COLOR = PixelBuffer::packColor(255, 200, 0);
+const uint32_t DEATH_COLOR = PixelBuffer::packColor(0, 255, 0);
+const uint32_t OVERLAY_COLOR = PixelBuffer::packColor(255, 255, 0);
+const size_t EAT_PARTICLES = 24;
+const size_t DEATH_PARTICLES_PER_SEGMENT = 8;
+const float PARTICLE_SPEED = 4.0f;   // Cells per second
+const float PARTICLE_LIFETIME = 0.6f; // Seconds
+
+// How long the death burst plays before the game over screen
+const float DEATH_EFFECT_DURATION = 0.8f;
+
+// Frames may run this much over the refresh interval before effects are thinned out
+const float FRAME_TIME_TOLERANCE = 1.25f;
+} // namespace
+
 GamePlayState::GamePlayState(GameStateManager* stateManager, const GameSettings* settings)
     : stateManager(stateManager),
       settings(settings),
       game(settings->getBoardWidth(), settings->getBoardHeight(), 3), // Initial snake length = 3
       paused(false),
       lastUpdateTime(std::chrono::steady_clock::now()),
-      updateInterval(1.0f / static_cast<float>(settings->getGameSpeed()))
+      updateInterval(1.0f / static_cast<float>(settings->getGameSpeed())),
+      deathEffectRemaining(-1.0f),
+      audio(nullptr),
+      latency(nullptr),
+      latencyOverlaySamples(0),
+      prepared(false)
 {
 }
 
-void GamePlayState::enter()
+void GamePlayState::prepare()
 {
-    // Initialize game board and entities
+    // Initialize game board and entities; storage is kept if the board size is unchanged
+    game.resize(settings->getBoardWidth(), settings->getBoardHeight());
+    game.setFoodCount(settings->getFoodCount());
     game.initialize();
+    prepared = true;
+}
+
+void GamePlayState::enter()
+{
+    // Entered without the manager's preparation (e.g. directly)
+    if (!prepared)
+    {
+        prepare();
+    }
+    prepared = false;
 
     // Update game speed from settings
     updateInterval = 1.0f / static_cast<float>(settings->getGameSpeed());
@@ -27,6 +66,20 @@ void GamePlayState::enter()
 
     // Start in non-paused state
     paused = false;
+
+    // Thin out the effects once frames run late for the display's refresh rate
+    particles.clear();
+    deathEffectRemaining = -1.0f;
+    audio = stateManager->getAudio();
+    if (GameApp* app = stateManager->getOwner())
+    {
+        particles.setTargetFrameTime(app->getFrameScheduler().getFrameInterval() *
+                                     FRAME_TIME_TOLERANCE);
+        latency = &app->getLatencyTracker();
+
+        // Inputs of a previous game would wait for ticks this one restarts from zero
+        latency->discardPending();
+    }
 }
 
 void GamePlayState::exit()
@@ -34,21 +87,43 @@ void GamePlayState::exit()
     // Cleanup if needed
 }
 
+void GamePlayState::reset(GameStateManager* stateManager, const GameSettings* settings)
+{
+    this->stateManager = stateManager;
+    this->settings = settings;
+    prepared = false;
+}
+
+bool GamePlayState::isReusable() const
+{
+    return true;
+}
+
+bool GamePlayState::hasPreparation() const
+{
+    return true;
+}
+
 void GamePlayState::processInput(Input input)
+{
+    processInput(input, InputClock::now());
+}
+
+void GamePlayState::processInput(Input input, InputClock::time_point timestamp)
 {
     switch (input)
     {
     case Input::UP:
-        game.processKeyPress(119); // 'w'
+        steer(119, timestamp); // 'w'
         break;
     case Input::DOWN:
-        game.processKeyPress(115); // 's'
+        steer(115, timestamp); // 's'
         break;
     case Input::LEFT:
-        game.processKeyPress(97); // 'a'
+        steer(97, timestamp); // 'a'
         break;
     case Input::RIGHT:
-        game.processKeyPress(100); // 'd'
+        steer(100, timestamp); // 'd'
         break;
     case Input::PAUSE:
         togglePause();
@@ -74,9 +149,25 @@ void GamePlayState::processInput(Input input)
 
 void GamePlayState::update(float deltaTime)
 {
-    // Skip updates if paused or game over
-    if (paused || game.isGameOver())
+    // Skip updates if paused
+    if (paused)
+    {
+        return;
+    }
+
+    particles.update(deltaTime);
+
+    // Let the death burst play out before showing the game over screen
+    if (game.isGameOver())
     {
+        if (deathEffectRemaining >= 0.0f)
+        {
+            deathEffectRemaining -= deltaTime;
+            if (deathEffectRemaining < 0.0f)
+            {
+                handleGameOver();
+            }
+        }
         return;
     }
 
@@ -86,21 +177,130 @@ void GamePlayState::update(float deltaTime)
 
     if (elapsed >= updateInterval)
     {
-        game.update();
+        tick();
         lastUpdateTime = currentTime;
     }
+}
 
-    // Check for game over condition
-    if (game.isGameOver())
+void GamePlayState::tick()
+{
+    const Direction directionBefore = game.getSnake().getCurrentDirection();
+
+    game.update();
+
+    // Turns queued during the last tick are taken by the update
+    if (game.getSnake().getCurrentDirection() != directionBefore)
+    {
+        playSound(SoundEffect::TURN);
+    }
+
+    // This move shows a turn; the latency sample completes when its frame is presented
+    if (latency != nullptr && game.wasLastMoveTurn())
+    {
+        latency->recordConsumed(game.getLastTurnPressTime(), game.getTickCount());
+    }
+
+    for (const GameEvent& event : game.getEvents())
+    {
+        switch (event.type)
+        {
+        case GameEvent::Type::FOOD_EATEN:
+            playSound(SoundEffect::EAT);
+            particles.emitBurst(event.position.x + 0.5f,
+                                event.position.y + 0.5f,
+                                EAT_PARTICLES,
+                                EAT_COLOR,
+                                PARTICLE_SPEED,
+                                PARTICLE_LIFETIME);
+            break;
+        case GameEvent::Type::DIED:
+            // The whole snake bursts apart
+            for (const Position& segment : game.getSnake().getBody())
+            {
+                particles.emitBurst(segment.x + 0.5f,
+                                    segment.y + 0.5f,
+                                    DEATH_PARTICLES_PER_SEGMENT,
+                                    DEATH_COLOR,
+                                    PARTICLE_SPEED,
+                                    DEATH_EFFECT_DURATION);
+            }
+            deathEffectRemaining = DEATH_EFFECT_DURATION;
+            playSound(SoundEffect::DEATH);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void GamePlayState::steer(int keyCode, InputClock::time_point timestamp)
+{
+    // Direction keys take effect immediately; only an actual turn makes a sound
+    const Direction directionBefore = game.getSnake().getCurrentDirection();
+    game.processKeyPress(keyCode, timestamp);
+    if (game.getSnake().getCurrentDirection() != directionBefore)
+    {
+        playSound(SoundEffect::TURN);
+    }
+}
+
+void GamePlayState::playSound(SoundEffect effect)
+{
+    if (audio != nullptr)
     {
-        handleGameOver();
+        audio->play(effect);
     }
 }
 
 void GamePlayState::render(Renderer& renderer)
 {
-    // Render game board and entities
-    renderer.render(game);
+    // Lay out the board and entities, smoothing movement between ticks
+    frameSnapshot.captureGame(game, getInterpolationAlpha());
+    FrameLayout::layoutGame(frameSnapshot, frameCommands);
+    particles.appendCommands(frameCommands);
+    if (latency != nullptr && latency->isOverlayEnabled())
+    {
+        const uint64_t samples = latency->getTotalSampleCount();
+        if (latencyOverlay.empty() || samples != latencyOverlaySamples)
+        {
+            latencyOverlay = latency->formatSummary();
+            latencyOverlaySamples = samples;
+        }
+        frameCommands.addText(
+            latencyOverlay, TextStyle::HUD, TextAnchor::TOP_LEFT, 1.0f, OVERLAY_COLOR);
+    }
+    renderer.renderCommands(frameCommands);
+}
+
+float GamePlayState::getTimeUntilTick() const
+{
+    // No tick is pending while the game is frozen
+    if (paused || game.isGameOver())
+    {
+        return -1.0f;
+    }
+
+    auto elapsed =
+        std::chrono::duration<float>(std::chrono::steady_clock::now() - lastUpdateTime).count();
+    return std::max(updateInterval - elapsed, 0.0f);
+}
+
+float GamePlayState::getInterpolationAlpha() const
+{
+    // Show the current tick as is while the game is frozen
+    if (paused || game.isGameOver() || updateInterval <= 0.0f)
+    {
+        return 1.0f;
+    }
+
+    auto elapsed =
+        std::chrono::duration<float>(std::chrono::steady_clock::now() - lastUpdateTime).count();
+    return std::clamp(elapsed / updateInterval, 0.0f, 1.0f);
+}
+
+const ParticleSystem& GamePlayState::getParticles() const
+{
+    return particles;
 }
 
 bool GamePlayState::isPaused() const
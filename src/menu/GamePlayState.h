@@ -1,12 +1,18 @@
 #ifndef GREEDYSNAKE_GAMEPLAYSTATE_H
 #define GREEDYSNAKE_GAMEPLAYSTATE_H
 
+#include "audio/AudioEngine.h"
 #include "game/Game.h"
+#include "game/LatencyTracker.h"
 #include "menu/GameState.h"
 #include "menu/GameStateManager.h"
+#include "renderer/ParticleSystem.h"
+#include "renderer/RenderCommandBuffer.h"
+#include "renderer/RenderSnapshot.h"
 #include "settings/GameSettings.h"
 #include <chrono>
 #include <memory>
+#include <string>
 
 namespace GreedySnake
 {
@@ -36,8 +42,34 @@ class GamePlayState : public GameState
     void enter() override;
     void exit() override;
     void processInput(Input input) override;
+    void processInput(Input input, InputClock::time_point timestamp) override;
     void update(float deltaTime) override;
     void render(Renderer& renderer) override;
+    [[nodiscard]] float getTimeUntilTick() const override;
+
+    /**
+     * @brief Rebind a pooled state to the arguments it is reused with
+     * @param stateManager Pointer to the game state manager
+     * @param settings Pointer to the game settings, applied by the next prepare() and enter()
+     */
+    void reset(GameStateManager* stateManager, const GameSettings* settings);
+
+    /**
+     * @brief Gameplay states are pooled; enter() resets the game in place
+     * @return Always true
+     */
+    [[nodiscard]] bool isReusable() const override;
+
+    /**
+     * @brief Board setup runs on the manager's worker thread
+     * @return Always true
+     */
+    [[nodiscard]] bool hasPreparation() const override;
+
+    /**
+     * @brief Size the board from the settings and reset the game for enter()
+     */
+    void prepare() override;
 
     /**
      * @brief Check if the game is paused
@@ -57,6 +89,18 @@ class GamePlayState : public GameState
      */
     [[nodiscard]] int getScore() const;
 
+    /**
+     * @brief Get how far the game has progressed towards its next tick
+     * @return Interpolation factor between the previous (0) and current (1) tick
+     */
+    [[nodiscard]] float getInterpolationAlpha() const;
+
+    /**
+     * @brief Get the eat and death effects
+     * @return Reference to the particle system
+     */
+    [[nodiscard]] const ParticleSystem& getParticles() const;
+
   private:
     GameStateManager* stateManager;
     const GameSettings* settings;
@@ -68,6 +112,34 @@ class GamePlayState : public GameState
     std::chrono::time_point<std::chrono::steady_clock> lastUpdateTime;
     float updateInterval; // in seconds
 
+    // Reused every frame so laying out the board does not allocate
+    RenderSnapshot frameSnapshot;
+    RenderCommandBuffer frameCommands;
+
+    // Eat and death effects; the game over screen waits for the death burst
+    ParticleSystem particles;
+    float deathEffectRemaining; // Seconds until the game over screen, negative when not dying
+
+    // Sound effects, nullptr when the state has no owning application
+    AudioEngine* audio;
+
+    // Input latency measurements and their overlay text, refreshed when samples arrive
+    LatencyTracker* latency;
+    std::string latencyOverlay;
+    uint64_t latencyOverlaySamples;
+
+    // prepare() ran since the last enter()
+    bool prepared;
+
+    // Run one game tick and start the effects for what happened in it
+    void tick();
+
+    // Forward a direction key to the game, with a sound if the snake turns
+    void steer(int keyCode, InputClock::time_point timestamp);
+
+    // Queue a sound effect if audio is available
+    void playSound(SoundEffect effect);
+
     // Handle the game over condition
     void handleGameOver();
 
@@ -24,12 +24,31 @@ class GameState
     // Called when entering the state
     virtual void enter() = 0;
 
+    // Whether the state has setup worth running off the game loop in prepare()
+    [[nodiscard]] virtual bool hasPreparation() const
+    {
+        return false; // Default implementation: everything happens in enter()
+    }
+
+    // Expensive setup run on a worker thread before enter() while the manager shows a
+    // loading frame; may only touch this state's own data. States entered directly
+    // without it must still work, so enter() should prepare if this didn't run
+    virtual void prepare()
+    {
+    }
+
     // Called when exiting the state
     virtual void exit() = 0;
 
     // Process input specific to this state
     virtual void processInput(Input input) = 0;
 
+    // Process input read at the given time; states that track input timing override this
+    virtual void processInput(Input input, InputClock::time_point timestamp)
+    {
+        processInput(input);
+    }
+
     // Update logic specific to this state
     virtual void update(float deltaTime) = 0;
 
@@ -41,6 +60,19 @@ class GameState
     {
         return Status::Running; // Default implementation
     }
+
+    // Whether the manager may keep this state after it exits and enter it again later;
+    // reusable states must fully reset themselves in enter()
+    [[nodiscard]] virtual bool isReusable() const
+    {
+        return false; // Default implementation: destroyed on exit
+    }
+
+    // Seconds until this state needs its next fixed-rate update, negative if it has none
+    [[nodiscard]] virtual float getTimeUntilTick() const
+    {
+        return -1.0f; // Default implementation: no fixed tick
+    }
 };
 
 } // namespace GreedySnake
@@ -1,72 +1,209 @@
 #include "menu/GameStateManager.h"
+#include "game/GameApp.h"
+#include "renderer/FrameLayout.h"
+#include <chrono>
 
 namespace GreedySnake
 {
 
+GameStateManager::GameStateManager(GameApp* owner)
+    : owner(owner), dispatching(false), pendingTime(0.0f)
+{
+    FrameLayout::layoutMenu("Loading...", {}, 0, "", loadingCommands);
+}
+
 void GameStateManager::changeState(std::unique_ptr<GameState> newState)
 {
+    // One transition at a time
+    finishTransition();
+
     // Pop all states
-    while (!stateStack.empty())
-    {
-        stateStack.top()->exit();
-        stateStack.pop();
-    }
+    clearStates();
 
     // Push and enter the new state
     if (newState)
     {
-        newState->enter();
-        stateStack.push(std::move(newState));
+        beginTransition(std::move(newState));
     }
 }
 
 void GameStateManager::pushState(std::unique_ptr<GameState> newState)
 {
+    finishTransition();
+
     // Enter the new state and push it onto the stack
     if (newState)
     {
-        newState->enter();
-        stateStack.push(std::move(newState));
+        beginTransition(std::move(newState));
+    }
+}
+
+void GameStateManager::beginTransition(std::unique_ptr<GameState> newState)
+{
+    pendingState = std::move(newState);
+    if (!pendingState->hasPreparation())
+    {
+        completeTransition();
+        return;
+    }
+
+    pendingTime = 0.0f;
+    pendingPreparation = std::async(std::launch::async, &GameState::prepare, pendingState.get());
+}
+
+void GameStateManager::finishTransition()
+{
+    if (pendingState)
+    {
+        completeTransition();
     }
 }
 
+void GameStateManager::completeTransition()
+{
+    // Rethrows anything the preparation threw
+    if (pendingPreparation.valid())
+    {
+        pendingPreparation.get();
+    }
+
+    std::unique_ptr<GameState> state = std::move(pendingState);
+    state->enter();
+    stateStack.push(std::move(state));
+}
+
 void GameStateManager::popState()
 {
     // If there's a state on the stack, exit and pop it
     if (!stateStack.empty())
     {
-        stateStack.top()->exit();
-        stateStack.pop();
+        retireTopState();
     }
 }
 
+void GameStateManager::clearStates()
+{
+    while (!stateStack.empty())
+    {
+        retireTopState();
+    }
+}
+
+void GameStateManager::retireTopState()
+{
+    std::unique_ptr<GameState> state = std::move(stateStack.top());
+    stateStack.pop();
+    state->exit();
+
+    if (state->isReusable() && statePool.size() < MAX_POOLED_STATES)
+    {
+        statePool.push_back(std::move(state));
+    }
+    else if (dispatching)
+    {
+        // The state may be the one still running; keep it alive until it returns
+        retiredStates.push_back(std::move(state));
+    }
+}
+
+void GameStateManager::endDispatch()
+{
+    dispatching = false;
+    retiredStates.clear();
+}
+
 bool GameStateManager::hasActiveState() const
 {
-    return !stateStack.empty();
+    return !stateStack.empty() || pendingState != nullptr;
 }
 
 void GameStateManager::processInput(Input input)
 {
-    if (!stateStack.empty())
+    if (!stateStack.empty() && !pendingState)
     {
+        dispatching = true;
         stateStack.top()->processInput(input);
+        endDispatch();
     }
 }
 
+void GameStateManager::processInput(const InputBatch& inputs)
+{
+    dispatching = true;
+    for (const InputEvent& event : inputs)
+    {
+        // An input may have closed the last state or started a transition
+        if (stateStack.empty() || pendingState)
+        {
+            break;
+        }
+        stateStack.top()->processInput(event.input, event.timestamp);
+    }
+    endDispatch();
+}
+
 void GameStateManager::update(float deltaTime)
 {
+    if (pendingState)
+    {
+        pendingTime += deltaTime;
+        if (pendingPreparation.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return;
+        }
+        completeTransition();
+    }
+
     if (!stateStack.empty())
     {
+        dispatching = true;
         stateStack.top()->update(deltaTime);
+        endDispatch();
     }
 }
 
 void GameStateManager::render(Renderer& renderer)
 {
+    // Skipping the frame keeps the last one on screen; slow preparations get a loading frame
+    if (pendingState)
+    {
+        if (pendingTime >= LOADING_FRAME_DELAY)
+        {
+            renderer.renderCommands(loadingCommands);
+        }
+        return;
+    }
+
     if (!stateStack.empty())
     {
         stateStack.top()->render(renderer);
     }
 }
 
-} // namespace GreedySnake
\ No newline at end of file
+float GameStateManager::getTimeUntilTick() const
+{
+    if (stateStack.empty() || pendingState)
+    {
+        return -1.0f;
+    }
+    return stateStack.top()->getTimeUntilTick();
+}
+
+GameSettings* GameStateManager::getSettings()
+{
+    if (owner != nullptr)
+    {
+        if (GameSettings* settings = owner->getSettings())
+        {
+            return settings;
+        }
+    }
+    return &defaultSettings;
+}
+
+AudioEngine* GameStateManager::getAudio() const
+{
+    return owner != nullptr ? &owner->getAudio() : nullptr;
+}
+
+} // namespace GreedySnake
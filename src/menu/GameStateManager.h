@@ -3,48 +3,95 @@
 
 #include "menu/GameState.h"
 #include "menu/Input.h"
+#include "renderer/RenderCommandBuffer.h"
+#include "settings/GameSettings.h"
+#include <future>
 #include <memory>
 #include <stack>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace GreedySnake
 {
 
-// Forward declaration
+// Forward declarations
+class AudioEngine;
 class GameApp;
 
 // The central controller for managing different game states
 class GameStateManager
 {
   public:
-    GameStateManager() : owner(nullptr)
-    {
-    }
-    explicit GameStateManager(GameApp* owner) : owner(owner)
+    GameStateManager() : GameStateManager(nullptr)
     {
     }
+    explicit GameStateManager(GameApp* owner);
     ~GameStateManager() = default;
 
-    // Change to a new state, replacing the current one
+    // Change to a new state, replacing the current one. A state with a preparation is
+    // prepared on a worker thread first and entered by a later update()
     void changeState(std::unique_ptr<GameState> newState);
 
-    // Add a new state on top of the current one
+    // Add a new state on top of the current one, preparing it first like changeState()
     void pushState(std::unique_ptr<GameState> newState);
 
     // Remove the current state and return to the previous one
     void popState();
 
-    // Check if there's an active state
+    // Replace all states with a T, reusing a retired one if available. args construct a
+    // new T or are passed to T::reset(args...) on the reused one, so T needs both. They are
+    // copied first: they may refer into the state being replaced
+    template <typename T, typename... Args> void changeToPooledState(Args&&... args)
+    {
+        std::tuple<std::decay_t<Args>...> saved(std::forward<Args>(args)...);
+        clearStates();
+        pushState(std::apply(
+            [this](auto&... values) { return this->template obtainState<T>(std::move(values)...); },
+            saved));
+    }
+
+    // Push a T on top of the current state, reusing a retired one if available
+    // (args go to the constructor or T::reset() as for changeToPooledState)
+    template <typename T, typename... Args> void pushPooledState(Args&&... args)
+    {
+        pushState(obtainState<T>(std::forward<Args>(args)...));
+    }
+
+    // Get the number of retired states kept for reuse
+    [[nodiscard]] size_t getPooledStateCount() const
+    {
+        return statePool.size();
+    }
+
+    // Check if there's an active state (or one being prepared)
     [[nodiscard]] bool hasActiveState() const;
 
+    // Check if a state is being prepared; the other states are frozen until it is entered
+    [[nodiscard]] bool isTransitionPending() const
+    {
+        return pendingState != nullptr;
+    }
+
+    // Enter the state being prepared, blocking until its preparation is done
+    void finishTransition();
+
     // Forward input events to the current state
     void processInput(Input input);
 
+    // Forward a frame's inputs in order; each goes to whichever state is current by then
+    void processInput(const InputBatch& inputs);
+
     // Update logic for the current state
     void update(float deltaTime);
 
     // Render the current state
     void render(Renderer& renderer);
 
+    // Seconds until the current state needs its next tick, negative if it has none
+    [[nodiscard]] float getTimeUntilTick() const;
+
     // Get the owner application object
     [[nodiscard]] GameApp* getOwner() const
     {
@@ -57,9 +104,65 @@ class GameStateManager
         this->owner = owner;
     }
 
+    // Get the owner's audio engine, nullptr without an owner
+    [[nodiscard]] AudioEngine* getAudio() const;
+
+    // Get the owner's settings, or defaults owned by the manager without an owner
+    [[nodiscard]] GameSettings* getSettings();
+
   private:
+    // Retired states kept at most; one of each kind is enough to restart instantly
+    static constexpr size_t MAX_POOLED_STATES = 4;
+
+    // Seconds a preparation may take before the loading frame replaces the last frame shown
+    static constexpr float LOADING_FRAME_DELAY = 0.1f;
+
     std::stack<std::unique_ptr<GameState>> stateStack;
+    std::vector<std::unique_ptr<GameState>> statePool; // Exited reusable states
+
+    // While a state handles input or updates it may replace itself; states retired meanwhile
+    // are destroyed once it has returned
+    bool dispatching;
+    std::vector<std::unique_ptr<GameState>> retiredStates;
     GameApp* owner; // Pointer to the owning application
+    GameSettings defaultSettings;
+
+    // State being prepared; the future is declared last so it is waited for first
+    std::unique_ptr<GameState> pendingState;
+    float pendingTime; // Seconds spent preparing so far
+    RenderCommandBuffer loadingCommands;
+    std::future<void> pendingPreparation;
+
+    // Prepare a state on a worker thread; update() enters it once that is done
+    void beginTransition(std::unique_ptr<GameState> newState);
+
+    // Enter the prepared state and make it current
+    void completeTransition();
+
+    // Exit and remove every state
+    void clearStates();
+
+    // Exit and remove the current state, keeping it for reuse if it allows that
+    void retireTopState();
+
+    // Destroy the states retired during the last dispatch
+    void endDispatch();
+
+    // Take a pooled T and re-apply args to it if there is one, otherwise construct it
+    template <typename T, typename... Args> std::unique_ptr<GameState> obtainState(Args&&... args)
+    {
+        for (auto it = statePool.begin(); it != statePool.end(); ++it)
+        {
+            if (T* pooled = dynamic_cast<T*>(it->get()))
+            {
+                pooled->reset(std::forward<Args>(args)...);
+                std::unique_ptr<GameState> state = std::move(*it);
+                statePool.erase(it);
+                return state;
+            }
+        }
+        return std::make_unique<T>(std::forward<Args>(args)...);
+    }
 };
 
 } // namespace GreedySnake
@@ -1,6 +1,10 @@
 #ifndef GREEDYSNAKE_INPUT_H
 #define GREEDYSNAKE_INPUT_H
 
+#include <array>
+#include <chrono>
+#include <cstddef>
+
 namespace GreedySnake
 {
 
@@ -20,6 +24,81 @@ enum class Input
     QUIT    // Quit the game
 };
 
+// Clock used to timestamp input events
+using InputClock = std::chrono::steady_clock;
+
+// An input action together with the time its event was read
+struct InputEvent
+{
+    Input input;
+    InputClock::time_point timestamp;
+};
+
+// Fixed-capacity list of the inputs read in one frame, in arrival order
+class InputBatch
+{
+  public:
+    static constexpr size_t CAPACITY = 32;
+
+    InputBatch() : events{}, count(0), droppedCount(0)
+    {
+    }
+
+    // Append an input; returns false (and counts it) if the batch is full
+    bool add(Input input, InputClock::time_point timestamp = InputClock::now())
+    {
+        if (count == CAPACITY)
+        {
+            ++droppedCount;
+            return false;
+        }
+        events[count++] = InputEvent{input, timestamp};
+        return true;
+    }
+
+    // Remove all inputs, keeping the dropped count
+    void clear()
+    {
+        count = 0;
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return count;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return count == 0;
+    }
+
+    [[nodiscard]] const InputEvent& operator[](size_t index) const
+    {
+        return events[index];
+    }
+
+    [[nodiscard]] const InputEvent* begin() const
+    {
+        return events.data();
+    }
+
+    [[nodiscard]] const InputEvent* end() const
+    {
+        return events.data() + count;
+    }
+
+    // Inputs lost because more than CAPACITY arrived in one frame
+    [[nodiscard]] size_t getDroppedCount() const
+    {
+        return droppedCount;
+    }
+
+  private:
+    std::array<InputEvent, CAPACITY> events;
+    size_t count;
+    size_t droppedCount;
+};
+
 } // namespace GreedySnake
 
-#endif // GREEDYSNAKE_INPUT_H
\ No newline at end of file
+#endif // GREEDYSNAKE_INPUT_H
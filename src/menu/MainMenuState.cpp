@@ -1,5 +1,4 @@
 #include "menu/MainMenuState.h"
-#include "game/GameApp.h"
 #include "menu/GamePlayState.h"
 #include "menu/SettingsMenuState.h"
 #include "menu/TextMenuItem.h"
@@ -15,6 +14,7 @@ void MainMenuState::enter()
 {
     // Create menu items
     menu.clearItems();
+    menu.setAudio(stateManager->getAudio());
 
     // Start Game
     menu.addItem<TextMenuItem>("Start Game", [this]() { onStartGame(); });
@@ -61,38 +61,15 @@ size_t MainMenuState::getSelectedIndex() const
 
 void MainMenuState::onStartGame()
 {
-    // Look up game settings from the application context
-    // For now, we access it from GameApp
-    GameApp* app = dynamic_cast<GameApp*>(stateManager->getOwner());
-    if (app == nullptr)
-    {
-        // Fallback if we can't get the app context
-        GameSettings* settings = new GameSettings();
-        stateManager->pushState(std::make_unique<GamePlayState>(stateManager, settings));
-    }
-    else
-    {
-        // Use app's settings
-        stateManager->pushState(std::make_unique<GamePlayState>(stateManager, app->getSettings()));
-    }
+    // Reuse the last game's state and storage if there was one
+    stateManager->pushPooledState<GamePlayState>(stateManager, stateManager->getSettings());
 }
 
 void MainMenuState::onSettings()
 {
-    // Look up game settings from the application context
-    GameApp* app = dynamic_cast<GameApp*>(stateManager->getOwner());
-    if (app == nullptr)
-    {
-        // Fallback if we can't get the app context
-        GameSettings* settings = new GameSettings();
-        stateManager->pushState(std::make_unique<SettingsMenuState>(stateManager, settings));
-    }
-    else
-    {
-        // Use app's settings
-        stateManager->pushState(
-            std::make_unique<SettingsMenuState>(stateManager, app->getSettings()));
-    }
+    // Edit the application's settings (or the manager's defaults without an application)
+    stateManager->pushState(
+        std::make_unique<SettingsMenuState>(stateManager, stateManager->getSettings()));
 }
 
 void MainMenuState::onExit()
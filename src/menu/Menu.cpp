@@ -1,12 +1,13 @@
 #include "menu/Menu.h"
 #include "menu/SliderMenuItem.h"
 #include "menu/ToggleMenuItem.h"
+#include "renderer/FrameLayout.h"
 #include <algorithm>
 
 namespace GreedySnake
 {
 
-Menu::Menu() : selectedIndex(0), instructions("")
+Menu::Menu() : selectedIndex(0), instructions(""), audio(nullptr)
 {
 }
 
@@ -20,54 +21,48 @@ bool Menu::handleInput(Input input)
     if (input == Input::UP)
     {
         selectPrevious();
+        playSound(SoundEffect::MENU_MOVE);
         return true;
     }
 
     if (input == Input::DOWN)
     {
         selectNext();
+        playSound(SoundEffect::MENU_MOVE);
         return true;
     }
 
     if (input == Input::SELECT)
     {
-        auto selectedItem = getSelectedItem();
+        playSound(SoundEffect::MENU_SELECT);
 
-        // Check if it's a toggle item first
-        auto toggleItem = std::dynamic_pointer_cast<ToggleMenuItem>(selectedItem);
-        if (toggleItem)
+        // Toggles flip in place; everything else runs its action
+        MenuItem& selectedItem = *items[selectedIndex];
+        if (selectedItem.getKind() == MenuItem::Kind::TOGGLE)
         {
-            toggleItem->toggle();
+            static_cast<ToggleMenuItem&>(selectedItem).toggle();
             return true;
         }
 
-        // Otherwise execute the standard action
         executeSelected();
         return true;
     }
 
-    if (input == Input::LEFT)
+    // For slider items, allow left/right navigation
+    if ((input == Input::LEFT || input == Input::RIGHT) &&
+        items[selectedIndex]->getKind() == MenuItem::Kind::SLIDER)
     {
-        // For slider items, allow left/right navigation
-        auto selectedItem = getSelectedItem();
-        auto sliderItem = std::dynamic_pointer_cast<SliderMenuItem>(selectedItem);
-        if (sliderItem)
+        auto& sliderItem = static_cast<SliderMenuItem&>(*items[selectedIndex]);
+        if (input == Input::LEFT)
         {
-            sliderItem->decrement();
-            return true;
+            sliderItem.decrement();
         }
-    }
-
-    if (input == Input::RIGHT)
-    {
-        // For slider items, allow left/right navigation
-        auto selectedItem = getSelectedItem();
-        auto sliderItem = std::dynamic_pointer_cast<SliderMenuItem>(selectedItem);
-        if (sliderItem)
+        else
         {
-            sliderItem->increment();
-            return true;
+            sliderItem.increment();
         }
+        playSound(SoundEffect::MENU_MOVE);
+        return true;
     }
 
     return false;
@@ -75,7 +70,9 @@ bool Menu::handleInput(Input input)
 
 void Menu::render(Renderer& renderer, const std::string& title) const
 {
-    renderer.renderMenu(title, getMenuItems(), getSelectedIndex(), instructions);
+    FrameLayout::layoutMenu(
+        title, getDisplayStrings(), getSelectedIndex(), instructions, frameCommands);
+    renderer.renderCommands(frameCommands);
 }
 
 std::shared_ptr<MenuItem> Menu::getSelectedItem() const
@@ -153,6 +150,7 @@ void Menu::executeSelected() const
 void Menu::clearItems()
 {
     items.clear();
+    displayStrings.clear();
     selectedIndex = 0;
 }
 
@@ -168,12 +166,21 @@ size_t Menu::getSelectedIndex() const
 
 std::vector<std::string> Menu::getMenuItems() const
 {
-    std::vector<std::string> result;
-    for (const auto& item : items)
+    return getDisplayStrings();
+}
+
+const std::vector<std::string>& Menu::getDisplayStrings() const
+{
+    // Only items whose values changed are formatted again
+    for (size_t i = 0; i < items.size(); ++i)
     {
-        result.push_back(item->getDisplayString());
+        if (items[i]->isDisplayDirty())
+        {
+            items[i]->formatDisplayString(displayStrings[i]);
+            items[i]->clearDisplayDirty();
+        }
     }
-    return result;
+    return displayStrings;
 }
 
 void Menu::setInstructions(const std::string& instructionsText)
@@ -186,4 +193,17 @@ const std::string& Menu::getInstructions() const
     return instructions;
 }
 
-} // namespace GreedySnake
\ No newline at end of file
+void Menu::setAudio(AudioEngine* audio)
+{
+    this->audio = audio;
+}
+
+void Menu::playSound(SoundEffect effect) const
+{
+    if (audio != nullptr)
+    {
+        audio->play(effect);
+    }
+}
+
+} // namespace GreedySnake
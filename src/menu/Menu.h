@@ -1,9 +1,11 @@
 #ifndef GREEDYSNAKE_MENU_H
 #define GREEDYSNAKE_MENU_H
 
+#include "audio/AudioEngine.h"
 #include "menu/Input.h"
 #include "menu/MenuItem.h"
 #include "menu/SliderMenuItem.h"
+#include "renderer/RenderCommandBuffer.h"
 #include "renderer/Renderer.h"
 #include <memory>
 #include <string>
@@ -39,6 +41,7 @@ class Menu
     {
         auto item = std::make_shared<T>(std::forward<Args>(args)...);
         items.push_back(item);
+        displayStrings.emplace_back();
 
         // If this is the first selectable item, select it
         if (items.size() == 1 && item->isSelectable())
@@ -107,6 +110,16 @@ class Menu
      */
     [[nodiscard]] std::vector<std::string> getMenuItems() const;
 
+    /**
+     * @brief Get the cached menu item texts
+     *
+     * Strings are only reformatted when an item's value changed, so calling
+     * this every frame does not allocate.
+     *
+     * @return Reference to the display strings, valid until items are added or cleared
+     */
+    [[nodiscard]] const std::vector<std::string>& getDisplayStrings() const;
+
     /**
      * @brief Set instructions for using the menu
      * @param instructionsText The instructions text
@@ -119,10 +132,24 @@ class Menu
      */
     const std::string& getInstructions() const;
 
+    /**
+     * @brief Set the engine used for navigation sounds
+     * @param audio Audio engine, or nullptr for a silent menu
+     */
+    void setAudio(AudioEngine* audio);
+
   private:
     std::vector<std::shared_ptr<MenuItem>> items;
+    mutable std::vector<std::string> displayStrings; // Cached item texts, parallel to items
     size_t selectedIndex;
     std::string instructions;
+    AudioEngine* audio;
+
+    // Play a sound effect if an audio engine is attached
+    void playSound(SoundEffect effect) const;
+
+    // Draw commands reused from frame to frame by render()
+    mutable RenderCommandBuffer frameCommands;
 };
 
 } // namespace GreedySnake
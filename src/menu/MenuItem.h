@@ -13,11 +13,25 @@ namespace GreedySnake
 class MenuItem
 {
   public:
-    MenuItem() : selected(false)
+    // Kind of item, so menus can dispatch input with a switch instead of casts
+    enum class Kind
+    {
+        ACTION, // Runs its callback
+        TOGGLE, // ToggleMenuItem
+        SLIDER  // SliderMenuItem
+    };
+
+    MenuItem() : selected(false), kind(Kind::ACTION), displayDirty(true)
     {
     }
     virtual ~MenuItem() = default;
 
+    // Get the kind of the item
+    [[nodiscard]] Kind getKind() const
+    {
+        return kind;
+    }
+
     // Get the label of the menu item
     [[nodiscard]] std::string getLabel() const
     {
@@ -25,9 +39,29 @@ class MenuItem
     }
 
     // Get the display string for the menu item (including value for sliders, etc.)
-    [[nodiscard]] virtual std::string getDisplayString() const
+    [[nodiscard]] std::string getDisplayString() const
     {
-        return label;
+        std::string text;
+        formatDisplayString(text);
+        return text;
+    }
+
+    // Write the display string into out, reusing its capacity
+    virtual void formatDisplayString(std::string& out) const
+    {
+        out.assign(label);
+    }
+
+    // Check if the display string changed since it was last cleared
+    [[nodiscard]] bool isDisplayDirty() const
+    {
+        return displayDirty;
+    }
+
+    // Mark the display string as picked up
+    void clearDisplayDirty()
+    {
+        displayDirty = false;
     }
 
     // Check if the menu item is currently selected
@@ -61,9 +95,23 @@ class MenuItem
     virtual void render(Renderer& renderer) = 0;
 
   protected:
+    explicit MenuItem(Kind kind) : selected(false), kind(kind), displayDirty(true)
+    {
+    }
+
+    // Call whenever a value shown in the display string changes
+    void markDisplayDirty()
+    {
+        displayDirty = true;
+    }
+
     std::string label;
     bool selected;
     std::function<void()> callback;
+
+  private:
+    Kind kind;
+    bool displayDirty;
 };
 
 } // namespace GreedySnake
@@ -18,6 +18,7 @@ void SettingsMenuState::enter()
 
     // Copy settings to temp settings
     tempSettings = *settings;
+    menu.setAudio(stateManager->getAudio());
 
     // Create menu items with current settings values
     menu.clearItems();
@@ -1,6 +1,4 @@
 #include "menu/SliderMenuItem.h"
-#include <iomanip>
-#include <sstream>
 
 namespace GreedySnake
 {
@@ -10,7 +8,8 @@ SliderMenuItem::SliderMenuItem(const std::string& labelText,
                                int max,
                                int initialValue,
                                std::function<void(int)> valueCallback)
-    : minValue(min),
+    : MenuItem(Kind::SLIDER),
+      minValue(min),
       maxValue(max),
       currentValue(initialValue),
       valueCallback(std::move(valueCallback))
@@ -30,11 +29,11 @@ void SliderMenuItem::render(Renderer& renderer)
     // Rendering logic - this is handled by the renderer
 }
 
-std::string SliderMenuItem::getDisplayString() const
+void SliderMenuItem::formatDisplayString(std::string& out) const
 {
-    std::stringstream ss;
-    ss << label << ": " << currentValue;
-    return ss.str();
+    out.assign(label);
+    out += ": ";
+    out += std::to_string(currentValue);
 }
 
 void SliderMenuItem::increment()
@@ -43,6 +42,7 @@ void SliderMenuItem::increment()
     if (newValue <= maxValue)
     {
         currentValue = newValue;
+        markDisplayDirty();
         if (valueCallback)
         {
             valueCallback(currentValue);
@@ -56,6 +56,7 @@ void SliderMenuItem::decrement()
     if (newValue >= minValue)
     {
         currentValue = newValue;
+        markDisplayDirty();
         if (valueCallback)
         {
             valueCallback(currentValue);
@@ -25,8 +25,8 @@ class SliderMenuItem : public MenuItem
     // Render the slider menu item
     void render(Renderer& renderer) override;
 
-    // Get the display string with the current value
-    [[nodiscard]] std::string getDisplayString() const override;
+    // Write the display string with the current value
+    void formatDisplayString(std::string& out) const override;
 
     // Increment the value and call the callback
     void increment();
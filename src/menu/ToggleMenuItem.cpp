@@ -6,7 +6,7 @@ namespace GreedySnake
 ToggleMenuItem::ToggleMenuItem(const std::string& label,
                                bool initialState,
                                std::function<void(bool)> stateCallback)
-    : state(initialState), stateCallback(std::move(stateCallback))
+    : MenuItem(Kind::TOGGLE), state(initialState), stateCallback(std::move(stateCallback))
 {
     this->label = label;
 }
@@ -22,14 +22,16 @@ void ToggleMenuItem::render(Renderer& renderer)
     // Rendering logic - this is handled by the renderer
 }
 
-std::string ToggleMenuItem::getDisplayString() const
+void ToggleMenuItem::formatDisplayString(std::string& out) const
 {
-    return label + ": " + (state ? "On" : "Off");
+    out.assign(label);
+    out += state ? ": On" : ": Off";
 }
 
 void ToggleMenuItem::toggle()
 {
     state = !state;
+    markDisplayDirty();
     if (stateCallback)
     {
         stateCallback(state);
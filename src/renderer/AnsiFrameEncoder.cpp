@@ -0,0 +1,114 @@
+#include "renderer/AnsiFrameEncoder.h"
+#include "renderer/TerminalComposer.h"
+
+namespace GreedySnake
+{
+
+namespace
+{
+/**
+ * @brief SGR color parameters of one color pair
+ */
+struct AnsiColors
+{
+    short colorPair;
+    const char* parameters;
+};
+
+// Same colors the ncurses renderer sets up with init_pair()
+const AnsiColors COLOR_TABLE[] = {
+    {TerminalComposer::TEXT_COLOR, ";37"},
+    {TerminalComposer::WALL_COLOR, ";37;47"},
+    {TerminalComposer::SNAKE_HEAD_COLOR, ";32;42"},
+    {TerminalComposer::SNAKE_BODY_COLOR, ";30;42"},
+    {TerminalComposer::FOOD_COLOR, ";31"},
+    {TerminalComposer::HIGHLIGHT_COLOR, ";33"},
+    {TerminalComposer::DIM_COLOR, ";36"},
+};
+} // namespace
+
+void AnsiFrameEncoder::beginSession(std::string& output)
+{
+    // Hide the cursor and start from a blank screen
+    output += "\x1b[?25l\x1b[0m\x1b[2J";
+}
+
+void AnsiFrameEncoder::endSession(std::string& output)
+{
+    output += "\x1b[0m\x1b[2J\x1b[H\x1b[?25h";
+}
+
+size_t AnsiFrameEncoder::encodeFrame(TerminalCellBuffer& cells, std::string& output)
+{
+    int cursorX = -1;
+    int cursorY = -1;
+    short currentColorPair = -1; // Unknown until the first cell sets it
+    bool currentBold = false;
+
+    const size_t changed = cells.flush([&](int x, int y, const TerminalCell& cell) {
+        if (x != cursorX || y != cursorY)
+        {
+            // CUP is 1-based
+            output += "\x1b[";
+            appendNumber(output, y + 1);
+            output += ';';
+            appendNumber(output, x + 1);
+            output += 'H';
+        }
+
+        if (cell.colorPair != currentColorPair || cell.bold != currentBold)
+        {
+            appendAttributes(output, cell.colorPair, cell.bold);
+            currentColorPair = cell.colorPair;
+            currentBold = cell.bold;
+        }
+
+        output += cell.character;
+        cursorX = x + 1;
+        cursorY = y;
+    });
+
+    if (changed > 0)
+    {
+        // Reset and park the cursor; clients can count frames by the bare CUP
+        output += "\x1b[0m\x1b[H";
+    }
+    return changed;
+}
+
+void AnsiFrameEncoder::appendNumber(std::string& output, int value)
+{
+    char digits[12];
+    int count = 0;
+    do
+    {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0 && count < 12);
+
+    while (count > 0)
+    {
+        output += digits[--count];
+    }
+}
+
+void AnsiFrameEncoder::appendAttributes(std::string& output, short colorPair, bool bold)
+{
+    // Reset first so attributes of the previous cell never leak
+    output += "\x1b[0";
+    if (bold)
+    {
+        output += ";1";
+    }
+    for (const AnsiColors& colors : COLOR_TABLE)
+    {
+        if (colors.colorPair == colorPair)
+        {
+            output += colors.parameters;
+            break;
+        }
+    }
+    output += 'm';
+}
+
+} // namespace GreedySnake
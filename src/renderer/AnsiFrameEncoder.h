@@ -0,0 +1,54 @@
+#pragma once
+
+#include "renderer/TerminalCellBuffer.h"
+#include <cstddef>
+#include <string>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Turns cell buffer changes into ANSI escape sequences
+ *
+ * Used where there is no curses library on the other end, such as remote
+ * terminal sessions. Only the cells that changed since the last encode are
+ * written; the cursor is moved only when the next changed cell is not
+ * directly to the right of the previous one, and colors are set only when
+ * they change. Colors follow TerminalComposer's color pairs.
+ */
+class AnsiFrameEncoder
+{
+  public:
+    /**
+     * @brief Append the sequences that prepare a terminal for frames
+     * @param output String to append to
+     */
+    static void beginSession(std::string& output);
+
+    /**
+     * @brief Append the sequences that restore a terminal after the last frame
+     * @param output String to append to
+     */
+    static void endSession(std::string& output);
+
+    /**
+     * @brief Append the changes of a composed frame and mark them as shown
+     *
+     * A non-empty frame ends with an attribute reset and a bare cursor-home
+     * sequence, which appears nowhere else in a frame.
+     *
+     * @param cells Cell buffer holding the composed frame
+     * @param output String to append to; nothing is appended if no cell changed
+     * @return Number of cells written
+     */
+    static size_t encodeFrame(TerminalCellBuffer& cells, std::string& output);
+
+  private:
+    // Append a decimal number without going through a temporary string
+    static void appendNumber(std::string& output, int value);
+
+    // Append the SGR sequence selecting a color pair and weight
+    static void appendAttributes(std::string& output, short colorPair, bool bold);
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,196 @@
+#include "renderer/FrameLayout.h"
+#include "renderer/PixelBuffer.h"
+#include <algorithm>
+
+namespace GreedySnake
+{
+
+namespace
+{
+const uint32_t WALL_COLOR = PixelBuffer::packColor(100, 100, 100);
+const uint32_t SNAKE_HEAD_COLOR = PixelBuffer::packColor(0, 255, 0);
+const uint32_t SNAKE_BODY_COLOR = PixelBuffer::packColor(0, 180, 0);
+const uint32_t FOOD_COLOR = PixelBuffer::packColor(255, 0, 0);
+const uint32_t TEXT_COLOR = PixelBuffer::packColor(255, 255, 255);
+const uint32_t HIGHLIGHT_COLOR = PixelBuffer::packColor(255, 255, 0);
+const uint32_t HINT_COLOR = PixelBuffer::packColor(150, 150, 150);
+
+// Body segments are drawn slightly smaller than a cell so they read as segments
+const float BODY_INSET = 0.05f;
+const float BODY_SIZE = 1.0f - 2.0f * BODY_INSET;
+const float FOOD_RADIUS = 0.4f;
+
+// Menu lines, counted from the title
+const float FIRST_ITEM_LINE = 2.5f;
+} // namespace
+
+void FrameLayout::layoutGame(const RenderSnapshot& snapshot, RenderCommandBuffer& commands)
+{
+    commands.clear();
+    commands.setTick(snapshot.tick);
+
+    const int width = snapshot.boardWidth;
+    const int height = snapshot.boardHeight;
+    const std::vector<Position>& body = snapshot.snakeCells;
+
+    // Blend between the previous and the current tick position of a cell
+    const float alpha = std::clamp(snapshot.interpolationAlpha, 0.0f, 1.0f);
+    auto blendX = [alpha](const Position& from, const Position& to) {
+        return from.x + (to.x - from.x) * alpha;
+    };
+    auto blendY = [alpha](const Position& from, const Position& to) {
+        return from.y + (to.y - from.y) * alpha;
+    };
+
+    // Scrolling cameras follow the interpolated head
+    if (body.empty())
+    {
+        commands.setBoard(width, height, width / 2.0f, height / 2.0f);
+    }
+    else
+    {
+        commands.setBoard(width,
+                          height,
+                          blendX(snapshot.previousHead, body.front()) + 0.5f,
+                          blendY(snapshot.previousHead, body.front()) + 0.5f);
+    }
+
+    // Border walls as four strips
+    if (width > 0 && height > 0)
+    {
+        commands.addRect(0.0f, 0.0f, width, 1.0f, WALL_COLOR);
+        commands.addRect(0.0f, height - 1.0f, width, 1.0f, WALL_COLOR);
+        commands.addRect(0.0f, 1.0f, 1.0f, height - 2.0f, WALL_COLOR);
+        commands.addRect(width - 1.0f, 1.0f, 1.0f, height - 2.0f, WALL_COLOR);
+    }
+
+    for (const Position& obstacle : snapshot.obstacleCells)
+    {
+        commands.addRect(obstacle.x, obstacle.y, 1.0f, 1.0f, WALL_COLOR);
+    }
+
+    for (const Position& food : snapshot.foodCells)
+    {
+        commands.addCircle(food.x + 0.5f, food.y + 0.5f, FOOD_RADIUS, FOOD_COLOR);
+    }
+
+    if (!body.empty())
+    {
+        for (size_t i = 1; i < body.size(); ++i)
+        {
+            commands.addSprite(SpriteId::SNAKE_BODY,
+                               body[i].x + BODY_INSET,
+                               body[i].y + BODY_INSET,
+                               BODY_SIZE,
+                               BODY_SIZE,
+                               SNAKE_BODY_COLOR);
+        }
+
+        // The tail end slides out of the cell it vacated during the last tick
+        if (body.size() > 1 && snapshot.previousTail != body.back())
+        {
+            commands.addSprite(SpriteId::SNAKE_BODY,
+                               blendX(snapshot.previousTail, body.back()) + BODY_INSET,
+                               blendY(snapshot.previousTail, body.back()) + BODY_INSET,
+                               BODY_SIZE,
+                               BODY_SIZE,
+                               SNAKE_BODY_COLOR);
+        }
+
+        // The head slides from its previous cell into the current one
+        commands.addSprite(SpriteId::SNAKE_HEAD,
+                           blendX(snapshot.previousHead, body.front()),
+                           blendY(snapshot.previousHead, body.front()),
+                           1.0f,
+                           1.0f,
+                           SNAKE_HEAD_COLOR);
+    }
+
+    commands.addText("Score: " + std::to_string(snapshot.score),
+                     TextStyle::HUD,
+                     TextAnchor::TOP_LEFT,
+                     0.0f,
+                     TEXT_COLOR);
+
+    if (snapshot.gameOver)
+    {
+        commands.addText("Game Over! Press R to restart",
+                         TextStyle::BANNER,
+                         TextAnchor::CENTER,
+                         0.0f,
+                         FOOD_COLOR);
+    }
+    else if (snapshot.paused)
+    {
+        commands.addText("Paused. Press P to resume",
+                         TextStyle::BANNER,
+                         TextAnchor::CENTER,
+                         0.0f,
+                         HIGHLIGHT_COLOR);
+    }
+}
+
+void FrameLayout::layoutMenu(const std::string& title,
+                             const std::vector<std::string>& items,
+                             size_t selectedIndex,
+                             const std::string& instructions,
+                             RenderCommandBuffer& commands)
+{
+    commands.clear();
+
+    commands.addText(title, TextStyle::TITLE, TextAnchor::TOP_CENTER, 0.0f, TEXT_COLOR);
+
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        const float line = FIRST_ITEM_LINE + static_cast<float>(i);
+        if (i == selectedIndex)
+        {
+            // Selection indicator (arrow) in front of the highlighted item
+            commands.addText("> ",
+                             items[i],
+                             TextStyle::SELECTED_ITEM,
+                             TextAnchor::TOP_CENTER,
+                             line,
+                             HIGHLIGHT_COLOR);
+        }
+        else
+        {
+            commands.addText(
+                "  ", items[i], TextStyle::ITEM, TextAnchor::TOP_CENTER, line, TEXT_COLOR);
+        }
+    }
+
+    if (!instructions.empty())
+    {
+        commands.addText(instructions,
+                         TextStyle::HINT,
+                         TextAnchor::TOP_CENTER,
+                         FIRST_ITEM_LINE + static_cast<float>(items.size()) + 1.0f,
+                         HINT_COLOR);
+    }
+}
+
+void FrameLayout::layoutSnapshot(const RenderSnapshot& snapshot, RenderCommandBuffer& commands)
+{
+    switch (snapshot.kind)
+    {
+    case RenderSnapshot::Kind::GAME:
+        layoutGame(snapshot, commands);
+        break;
+    case RenderSnapshot::Kind::MENU:
+        layoutMenu(snapshot.title,
+                   snapshot.items,
+                   snapshot.selectedIndex,
+                   snapshot.instructions,
+                   commands);
+        break;
+    case RenderSnapshot::Kind::COMMANDS:
+        commands.copyFrom(snapshot.commands);
+        break;
+    default:
+        commands.clear();
+        break;
+    }
+}
+
+} // namespace GreedySnake
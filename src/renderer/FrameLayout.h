@@ -0,0 +1,52 @@
+#pragma once
+
+#include "renderer/RenderCommandBuffer.h"
+#include "renderer/RenderSnapshot.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief The single layout pass turning game and menu state into draw commands
+ *
+ * Decides what is drawn, in which order and in which colors; backends only map
+ * the resulting commands onto their output. Keeping this in one place means a
+ * frame looks the same in every backend and is laid out once even when it is
+ * sent to several outputs.
+ */
+class FrameLayout
+{
+  public:
+    /**
+     * @brief Lay out a gameplay frame
+     * @param snapshot Captured game state (including interpolation progress)
+     * @param commands Buffer to fill; cleared first
+     */
+    static void layoutGame(const RenderSnapshot& snapshot, RenderCommandBuffer& commands);
+
+    /**
+     * @brief Lay out a menu frame
+     * @param title The title to display
+     * @param items List of menu item texts
+     * @param selectedIndex Index of the highlighted item
+     * @param instructions Instructions to display below the menu (may be empty)
+     * @param commands Buffer to fill; cleared first
+     */
+    static void layoutMenu(const std::string& title,
+                           const std::vector<std::string>& items,
+                           size_t selectedIndex,
+                           const std::string& instructions,
+                           RenderCommandBuffer& commands);
+
+    /**
+     * @brief Lay out whatever frame a snapshot holds
+     * @param snapshot Snapshot of any kind
+     * @param commands Buffer to fill; cleared first
+     */
+    static void layoutSnapshot(const RenderSnapshot& snapshot, RenderCommandBuffer& commands);
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,309 @@
+#include "renderer/FrameRecorder.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace GreedySnake
+{
+
+FrameRecorder::FrameRecorder(size_t poolSize)
+    : poolSize(std::max<size_t>(poolSize, 1)),
+      stopRequested(false),
+      format(Format::Y4M),
+      width(0),
+      height(0),
+      recording(false),
+      frameInterval(0),
+      capturedFrames(0),
+      droppedFrames(0),
+      encodedFrames(0)
+{
+}
+
+FrameRecorder::~FrameRecorder()
+{
+    stop();
+}
+
+bool FrameRecorder::start(const std::string& outputPath,
+                          Format outputFormat,
+                          int frameWidth,
+                          int frameHeight,
+                          int framesPerSecond)
+{
+    if (recording || frameWidth <= 0 || frameHeight <= 0 || framesPerSecond <= 0)
+    {
+        return false;
+    }
+
+    path = outputPath;
+    format = outputFormat;
+    width = frameWidth;
+    height = frameHeight;
+
+    if (format == Format::Y4M)
+    {
+        videoFile.open(path, std::ios::binary | std::ios::trunc);
+        if (!videoFile)
+        {
+            std::cerr << "Failed to open video file: " << path << std::endl;
+            return false;
+        }
+
+        // Full-resolution chroma keeps the RGB to YUV conversion per pixel
+        videoFile << "YUV4MPEG2 W" << width << " H" << height << " F" << framesPerSecond
+                  << ":1 Ip A1:1 C444\n";
+    }
+
+    // All buffers are allocated up front; capturing never allocates
+    const size_t frameBytes = static_cast<size_t>(width) * height * 4;
+    pool.assign(poolSize, std::vector<uint8_t>(frameBytes));
+    freeFrames.clear();
+    for (std::vector<uint8_t>& buffer : pool)
+    {
+        freeFrames.push_back(buffer.data());
+    }
+    pendingFrames.clear();
+    scratch.assign(static_cast<size_t>(width) * height * 4, 0);
+
+    capturedFrames = 0;
+    droppedFrames = 0;
+    encodedFrames = 0;
+    frameInterval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / framesPerSecond));
+    nextFrameTime = std::chrono::steady_clock::now();
+
+    stopRequested = false;
+    recording = true;
+    encoderThread = std::thread(&FrameRecorder::encoderLoop, this);
+    return true;
+}
+
+void FrameRecorder::stop()
+{
+    if (!recording)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    frameQueued.notify_one();
+    encoderThread.join();
+
+    recording = false;
+    if (videoFile.is_open())
+    {
+        videoFile.close();
+    }
+}
+
+bool FrameRecorder::isRecording() const
+{
+    return recording;
+}
+
+int FrameRecorder::getWidth() const
+{
+    return width;
+}
+
+int FrameRecorder::getHeight() const
+{
+    return height;
+}
+
+bool FrameRecorder::isFrameDue()
+{
+    if (!recording)
+    {
+        return false;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now < nextFrameTime)
+    {
+        return false;
+    }
+
+    // Keep a steady cadence, but don't try to catch up after a long stall
+    nextFrameTime += frameInterval;
+    if (nextFrameTime < now)
+    {
+        nextFrameTime = now + frameInterval;
+    }
+    return true;
+}
+
+uint8_t* FrameRecorder::acquireFrame()
+{
+    if (!recording)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (freeFrames.empty())
+    {
+        // The encoder is behind; drop this frame rather than stall rendering
+        ++droppedFrames;
+        return nullptr;
+    }
+
+    uint8_t* frame = freeFrames.back();
+    freeFrames.pop_back();
+    return frame;
+}
+
+void FrameRecorder::submitFrame(uint8_t* frame, bool bottomUp)
+{
+    if (frame == nullptr)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pendingFrames.push_back(PendingFrame{frame, bottomUp});
+    }
+    ++capturedFrames;
+    frameQueued.notify_one();
+}
+
+bool FrameRecorder::captureFrame(const uint8_t* rgba, bool bottomUp)
+{
+    uint8_t* frame = acquireFrame();
+    if (frame == nullptr)
+    {
+        return false;
+    }
+
+    std::memcpy(frame, rgba, static_cast<size_t>(width) * height * 4);
+    submitFrame(frame, bottomUp);
+    return true;
+}
+
+void FrameRecorder::dropFrame()
+{
+    if (recording)
+    {
+        ++droppedFrames;
+    }
+}
+
+uint64_t FrameRecorder::getCapturedFrameCount() const
+{
+    return capturedFrames;
+}
+
+uint64_t FrameRecorder::getDroppedFrameCount() const
+{
+    return droppedFrames;
+}
+
+uint64_t FrameRecorder::getEncodedFrameCount() const
+{
+    return encodedFrames;
+}
+
+void FrameRecorder::encoderLoop()
+{
+    while (true)
+    {
+        PendingFrame frame{};
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            frameQueued.wait(lock, [this] { return stopRequested || !pendingFrames.empty(); });
+
+            // Drain everything queued before honouring a stop request
+            if (pendingFrames.empty())
+            {
+                return;
+            }
+            frame = pendingFrames.front();
+            pendingFrames.pop_front();
+        }
+
+        encodeFrame(frame);
+        ++encodedFrames;
+
+        // Hand the buffer back to the capturing thread
+        std::lock_guard<std::mutex> lock(mutex);
+        freeFrames.push_back(frame.pixels);
+    }
+}
+
+void FrameRecorder::encodeFrame(const PendingFrame& frame)
+{
+    switch (format)
+    {
+    case Format::Y4M:
+        writeY4mFrame(frame);
+        break;
+    case Format::PNG_SEQUENCE:
+        writePngFrame(frame);
+        break;
+    }
+}
+
+void FrameRecorder::writeY4mFrame(const PendingFrame& frame)
+{
+    const size_t planeSize = static_cast<size_t>(width) * height;
+    uint8_t* yPlane = scratch.data();
+    uint8_t* uPlane = yPlane + planeSize;
+    uint8_t* vPlane = uPlane + planeSize;
+
+    // BT.601 limited-range conversion in fixed point
+    size_t index = 0;
+    for (int row = 0; row < height; ++row)
+    {
+        const uint8_t* pixel = getRow(frame, row);
+        for (int column = 0; column < width; ++column, pixel += 4, ++index)
+        {
+            const int r = pixel[0];
+            const int g = pixel[1];
+            const int b = pixel[2];
+            yPlane[index] = static_cast<uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+            uPlane[index] = static_cast<uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+            vPlane[index] = static_cast<uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+        }
+    }
+
+    videoFile << "FRAME\n";
+    videoFile.write(reinterpret_cast<const char*>(scratch.data()),
+                    static_cast<std::streamsize>(planeSize * 3));
+}
+
+void FrameRecorder::writePngFrame(const PendingFrame& frame)
+{
+    // sf::Image expects rows top to bottom
+    const size_t rowBytes = static_cast<size_t>(width) * 4;
+    for (int row = 0; row < height; ++row)
+    {
+        std::memcpy(&scratch[row * rowBytes], getRow(frame, row), rowBytes);
+    }
+
+    sf::Image image;
+    image.create(width, height, scratch.data());
+
+    char suffix[32];
+    std::snprintf(suffix, sizeof(suffix), "_%06llu.png",
+                  static_cast<unsigned long long>(encodedFrames.load()));
+    if (!image.saveToFile(path + suffix))
+    {
+        std::cerr << "Failed to write frame: " << path + suffix << std::endl;
+    }
+}
+
+const uint8_t* FrameRecorder::getRow(const PendingFrame& frame, int row) const
+{
+    const size_t rowBytes = static_cast<size_t>(width) * 4;
+    const int storedRow = frame.bottomUp ? height - 1 - row : row;
+    return frame.pixels + storedRow * rowBytes;
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Records rendered frames to disk on a background thread
+ *
+ * The rendering thread copies each frame into one of a fixed pool of RGBA
+ * buffers and hands it to an encoder thread. Nothing is allocated per frame and
+ * the renderer never waits for the disk: if every buffer is still queued for
+ * encoding, the frame is dropped and counted instead.
+ */
+class FrameRecorder
+{
+  public:
+    /**
+     * @brief Output formats
+     */
+    enum class Format
+    {
+        Y4M,         // Uncompressed YUV 4:4:4 video stream (playable by ffmpeg, mpv, VLC)
+        PNG_SEQUENCE // One PNG image per frame: <path>_000000.png, <path>_000001.png, ...
+    };
+
+    /**
+     * @brief Constructor
+     * @param poolSize Number of frame buffers that can be queued for encoding
+     */
+    explicit FrameRecorder(size_t poolSize = 8);
+
+    /**
+     * @brief Destructor stops recording, encoding any queued frames
+     */
+    ~FrameRecorder();
+
+    FrameRecorder(const FrameRecorder&) = delete;
+    FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+    /**
+     * @brief Start recording
+     * @param path Output file (Y4M) or file name prefix (PNG sequence)
+     * @param format Output format
+     * @param width Frame width in pixels
+     * @param height Frame height in pixels
+     * @param framesPerSecond Capture rate, also written into the video header
+     * @return True if recording started
+     */
+    bool start(const std::string& path,
+               Format format,
+               int width,
+               int height,
+               int framesPerSecond = 30);
+
+    /**
+     * @brief Stop recording after encoding the frames already queued
+     */
+    void stop();
+
+    /**
+     * @brief Check if a recording is in progress
+     * @return True between start() and stop()
+     */
+    [[nodiscard]] bool isRecording() const;
+
+    /**
+     * @brief Get the frame width of the current recording
+     * @return Width in pixels
+     */
+    [[nodiscard]] int getWidth() const;
+
+    /**
+     * @brief Get the frame height of the current recording
+     * @return Height in pixels
+     */
+    [[nodiscard]] int getHeight() const;
+
+    /**
+     * @brief Check whether the next frame should be captured to keep the capture rate
+     *
+     * Rendering usually runs faster than the capture rate; frames in between are
+     * skipped so the video plays back at real-time speed.
+     *
+     * @return True if a frame is due
+     */
+    bool isFrameDue();
+
+    /**
+     * @brief Take a free buffer to copy the next frame into
+     * @return Buffer of width * height * 4 bytes, or nullptr if the pool is exhausted
+     *         (the frame is counted as dropped)
+     */
+    uint8_t* acquireFrame();
+
+    /**
+     * @brief Count a due frame that could not be read back, e.g. after the window was resized
+     */
+    void dropFrame();
+
+    /**
+     * @brief Queue a buffer obtained from acquireFrame() for encoding
+     * @param frame The filled buffer
+     * @param bottomUp True if rows are stored bottom to top (as read back from OpenGL)
+     */
+    void submitFrame(uint8_t* frame, bool bottomUp = false);
+
+    /**
+     * @brief Copy a frame into the pool and queue it for encoding
+     * @param rgba Frame pixels, width * height * 4 bytes
+     * @param bottomUp True if rows are stored bottom to top
+     * @return False if the frame was dropped
+     */
+    bool captureFrame(const uint8_t* rgba, bool bottomUp = false);
+
+    /**
+     * @brief Get the number of frames queued for encoding
+     * @return Captured frame count since start()
+     */
+    [[nodiscard]] uint64_t getCapturedFrameCount() const;
+
+    /**
+     * @brief Get the number of frames dropped because the encoder fell behind or they
+     *        could not be read back
+     * @return Dropped frame count since start()
+     */
+    [[nodiscard]] uint64_t getDroppedFrameCount() const;
+
+    /**
+     * @brief Get the number of frames written to disk
+     * @return Encoded frame count since start()
+     */
+    [[nodiscard]] uint64_t getEncodedFrameCount() const;
+
+  private:
+    /**
+     * @brief A buffer queued for encoding
+     */
+    struct PendingFrame
+    {
+        uint8_t* pixels;
+        bool bottomUp;
+    };
+
+    size_t poolSize;
+    std::vector<std::vector<uint8_t>> pool;
+    std::vector<uint8_t*> freeFrames;
+    std::deque<PendingFrame> pendingFrames;
+    std::mutex mutex;
+    std::condition_variable frameQueued;
+    std::thread encoderThread;
+    bool stopRequested;
+
+    std::string path;
+    Format format;
+    int width;
+    int height;
+    std::atomic<bool> recording;
+    std::ofstream videoFile;
+    std::vector<uint8_t> scratch; // Encoder-side conversion buffer
+
+    std::chrono::steady_clock::duration frameInterval;
+    std::chrono::steady_clock::time_point nextFrameTime;
+
+    std::atomic<uint64_t> capturedFrames;
+    std::atomic<uint64_t> droppedFrames;
+    std::atomic<uint64_t> encodedFrames;
+
+    // Encoder thread main loop
+    void encoderLoop();
+
+    // Write one frame in the configured format
+    void encodeFrame(const PendingFrame& frame);
+
+    // Append one frame to the Y4M stream
+    void writeY4mFrame(const PendingFrame& frame);
+
+    // Write one frame as a PNG image
+    void writePngFrame(const PendingFrame& frame);
+
+    // Get the start of a row, accounting for bottom-up storage
+    [[nodiscard]] const uint8_t* getRow(const PendingFrame& frame, int row) const;
+};
+
+} // namespace GreedySnake
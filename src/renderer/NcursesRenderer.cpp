@@ -0,0 +1,339 @@
+#include "renderer/NcursesRenderer.h"
+#include "renderer/FrameLayout.h"
+
+// Keep curses from defining function-like macros such as clear() and move()
+#define NCURSES_NOMACROS
+#include <curses.h>
+
+namespace GreedySnake
+{
+
+namespace
+{
+// Key code of Ctrl+C while the terminal is in raw mode
+const int CTRL_C_KEY = 3;
+const int ESCAPE_KEY = 27;
+} // namespace
+
+NcursesRenderer::NcursesRenderer()
+    : initialized(false), open(true), colorsEnabled(false), lastChangedCellCount(0)
+{
+}
+
+NcursesRenderer::~NcursesRenderer()
+{
+    shutdown();
+}
+
+bool NcursesRenderer::initialize()
+{
+    if (initialized)
+    {
+        return true;
+    }
+
+    if (initscr() == nullptr)
+    {
+        return false;
+    }
+    initialized = true;
+    open = true;
+
+    // Raw, unbuffered, non-blocking keyboard input without echo
+    raw();
+    noecho();
+    keypad(stdscr, TRUE);
+    nodelay(stdscr, TRUE);
+    curs_set(0);
+#ifdef NCURSES_VERSION
+    set_escdelay(25); // Don't let a lone Escape stall input for a second
+#endif
+
+    colorsEnabled = has_colors();
+    if (colorsEnabled)
+    {
+        start_color();
+        use_default_colors();
+        init_pair(TerminalComposer::TEXT_COLOR, COLOR_WHITE, -1);
+        init_pair(TerminalComposer::WALL_COLOR, COLOR_WHITE, COLOR_WHITE);
+        init_pair(TerminalComposer::SNAKE_HEAD_COLOR, COLOR_GREEN, COLOR_GREEN);
+        init_pair(TerminalComposer::SNAKE_BODY_COLOR, COLOR_BLACK, COLOR_GREEN);
+        init_pair(TerminalComposer::FOOD_COLOR, COLOR_RED, -1);
+        init_pair(TerminalComposer::HIGHLIGHT_COLOR, COLOR_YELLOW, -1);
+        init_pair(TerminalComposer::DIM_COLOR, COLOR_CYAN, -1);
+    }
+
+    handleTerminalResize();
+    return true;
+}
+
+void NcursesRenderer::shutdown()
+{
+    if (!initialized)
+    {
+        return;
+    }
+
+    endwin();
+    initialized = false;
+    open = false;
+}
+
+void NcursesRenderer::render(const Game& game)
+{
+    frameSnapshot.captureGame(game);
+    FrameLayout::layoutGame(frameSnapshot, frameCommands);
+    renderCommands(frameCommands);
+}
+
+void NcursesRenderer::renderMenu(const std::string& title,
+                                 const std::vector<std::string>& items,
+                                 size_t selectedIndex,
+                                 const std::string& instructions)
+{
+    FrameLayout::layoutMenu(title, items, selectedIndex, instructions, frameCommands);
+    renderCommands(frameCommands);
+}
+
+void NcursesRenderer::renderCommands(const RenderCommandBuffer& commands)
+{
+    TerminalComposer::compose(commands, cells);
+    present();
+}
+
+bool NcursesRenderer::isWindowOpen() const
+{
+    return open;
+}
+
+bool NcursesRenderer::handleEvents(Game& game)
+{
+    if (!initialized)
+    {
+        return open;
+    }
+
+    int key;
+    while ((key = getch()) != ERR)
+    {
+        if (key == KEY_RESIZE)
+        {
+            handleTerminalResize();
+            continue;
+        }
+
+        if (key == CTRL_C_KEY || key == ESCAPE_KEY)
+        {
+            open = false;
+            return false;
+        }
+
+        switch (translateKey(key))
+        {
+        case Input::UP:
+            game.processKeyPress(119); // W key code
+            break;
+
+        case Input::DOWN:
+            game.processKeyPress(115); // S key code
+            break;
+
+        case Input::LEFT:
+            game.processKeyPress(97); // A key code
+            break;
+
+        case Input::RIGHT:
+            game.processKeyPress(100); // D key code
+            break;
+
+        case Input::PAUSE:
+            // Toggle pause state
+            if (game.isPaused())
+            {
+                game.resume();
+            }
+            else
+            {
+                game.pause();
+            }
+            break;
+
+        case Input::QUIT:
+            game.processKeyPress(113); // Q key code (quit)
+            break;
+
+        default:
+            // Reset game if it's over
+            if ((key == 'r' || key == 'R') && game.isGameOver())
+            {
+                game.reset();
+            }
+            break;
+        }
+    }
+
+    return true;
+}
+
+bool NcursesRenderer::handleEvents(Input& input)
+{
+    // Default to no input
+    input = Input::NONE;
+
+    if (!initialized)
+    {
+        return open;
+    }
+
+    int key;
+    while ((key = getch()) != ERR)
+    {
+        if (key == KEY_RESIZE)
+        {
+            handleTerminalResize();
+            continue;
+        }
+
+        // Ctrl+C closes the terminal "window"
+        if (key == CTRL_C_KEY)
+        {
+            open = false;
+            input = Input::QUIT;
+            return false;
+        }
+
+        input = translateKey(key);
+        // Stop processing after the first meaningful input
+        if (input != Input::NONE)
+        {
+            break;
+        }
+    }
+
+    return true;
+}
+
+bool NcursesRenderer::handleEvents(InputBatch& inputs)
+{
+    if (!initialized)
+    {
+        return open;
+    }
+
+    int key;
+    while ((key = getch()) != ERR)
+    {
+        if (key == KEY_RESIZE)
+        {
+            handleTerminalResize();
+            continue;
+        }
+
+        // Ctrl+C closes the terminal "window"
+        if (key == CTRL_C_KEY)
+        {
+            open = false;
+            inputs.add(Input::QUIT);
+            return false;
+        }
+
+        const Input input = translateKey(key);
+        if (input != Input::NONE)
+        {
+            inputs.add(input, InputClock::now());
+        }
+    }
+
+    return true;
+}
+
+void NcursesRenderer::resize(int columns, int rows)
+{
+    cells.resize(columns, rows);
+}
+
+const TerminalCellBuffer& NcursesRenderer::getCellBuffer() const
+{
+    return cells;
+}
+
+size_t NcursesRenderer::getLastChangedCellCount() const
+{
+    return lastChangedCellCount;
+}
+
+Input NcursesRenderer::translateKey(int key)
+{
+    switch (key)
+    {
+    case KEY_UP:
+    case 'w':
+    case 'W':
+        return Input::UP;
+    case KEY_DOWN:
+    case 's':
+    case 'S':
+        return Input::DOWN;
+    case KEY_LEFT:
+    case 'a':
+    case 'A':
+        return Input::LEFT;
+    case KEY_RIGHT:
+    case 'd':
+    case 'D':
+        return Input::RIGHT;
+    case KEY_ENTER:
+    case '\n':
+    case '\r':
+    case ' ':
+        return Input::SELECT;
+    case ESCAPE_KEY:
+    case KEY_BACKSPACE:
+        return Input::BACK;
+    case 'p':
+    case 'P':
+        return Input::PAUSE;
+    case 'q':
+    case 'Q':
+        return Input::QUIT;
+    default:
+        return Input::NONE;
+    }
+}
+
+void NcursesRenderer::present()
+{
+    if (!initialized)
+    {
+        return;
+    }
+
+    lastChangedCellCount = cells.flush([this](int x, int y, const TerminalCell& cell) {
+        attr_t attributes = cell.bold ? A_BOLD : A_NORMAL;
+        if (colorsEnabled)
+        {
+            attributes |= COLOR_PAIR(cell.colorPair);
+        }
+        attrset(attributes);
+        mvaddch(y, x, static_cast<chtype>(static_cast<unsigned char>(cell.character)));
+    });
+
+    // Nothing changed, nothing to send
+    if (lastChangedCellCount > 0)
+    {
+        refresh();
+    }
+}
+
+void NcursesRenderer::handleTerminalResize()
+{
+    int rows = 0;
+    int columns = 0;
+    getmaxyx(stdscr, rows, columns);
+    resize(columns, rows);
+
+    // The terminal contents are undefined after a resize
+    clearok(stdscr, TRUE);
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "renderer/Renderer.h"
+#include "renderer/TerminalCellBuffer.h"
+#include "renderer/TerminalComposer.h"
+#include <string>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Terminal implementation of the game renderer using ncurses
+ *
+ * Frames are composed into a TerminalCellBuffer (see TerminalComposer) and
+ * only the cells that changed since the previous frame are written to the
+ * terminal, so a moving snake costs a handful of cells per tick instead of a
+ * full-screen redraw.
+ */
+class NcursesRenderer : public Renderer
+{
+  public:
+    /**
+     * @brief Constructor for the terminal renderer
+     */
+    NcursesRenderer();
+
+    /**
+     * @brief Destructor restores the terminal
+     */
+    ~NcursesRenderer() override;
+
+    /**
+     * @brief Put the terminal into curses mode
+     * @return True if initialization was successful
+     */
+    bool initialize() override;
+
+    /**
+     * @brief Restore the terminal to its normal mode
+     */
+    void shutdown() override;
+
+    /**
+     * @brief Render the game state to the terminal
+     * @param game Reference to the game state to render
+     */
+    void render(const Game& game) override;
+
+    /**
+     * @brief Render a menu with title and items
+     * @param title The title to display
+     * @param items List of menu items to display
+     * @param selectedIndex Index of the currently selected item
+     * @param instructions Optional instructions to display below the menu
+     */
+    void renderMenu(const std::string& title,
+                    const std::vector<std::string>& items,
+                    size_t selectedIndex,
+                    const std::string& instructions = "") override;
+
+    /**
+     * @brief Render a laid-out frame to the terminal
+     * @param commands Commands describing the frame
+     */
+    void renderCommands(const RenderCommandBuffer& commands) override;
+
+    /**
+     * @brief Check if the renderer is still running
+     * @return False once the terminal was closed with Ctrl+C or shut down
+     */
+    [[nodiscard]] bool isWindowOpen() const override;
+
+    /**
+     * @brief Handle keyboard input for a Game object
+     * @param game Reference to the game for processing input
+     * @return True if the game should continue running
+     */
+    bool handleEvents(Game& game) override;
+
+    /**
+     * @brief Handle keyboard input and convert it to the Input enum
+     * @param input Reference to an Input enum to be filled with the detected input
+     * @return True if the game should continue running
+     */
+    bool handleEvents(Input& input) override;
+
+    /**
+     * @brief Read all pending keys into a batch of inputs
+     * @param inputs Batch to append the inputs to
+     * @return True if the game should continue running
+     */
+    bool handleEvents(InputBatch& inputs) override;
+
+    /**
+     * @brief Resize the frame to a terminal size; the next frame is redrawn fully
+     * @param columns Terminal width in columns
+     * @param rows Terminal height in rows
+     */
+    void resize(int columns, int rows);
+
+    /**
+     * @brief Get the composed frame
+     * @return Cell buffer holding the last composed frame
+     */
+    [[nodiscard]] const TerminalCellBuffer& getCellBuffer() const;
+
+    /**
+     * @brief Get the number of cells written to the terminal by the last frame
+     * @return Changed cell count
+     */
+    [[nodiscard]] size_t getLastChangedCellCount() const;
+
+    /**
+     * @brief Convert a curses key code to the Input enum
+     * @param key Key code returned by getch()
+     * @return Corresponding input, or Input::NONE
+     */
+    static Input translateKey(int key);
+
+  private:
+    bool initialized;
+    bool open;
+    bool colorsEnabled;
+    TerminalCellBuffer cells;
+    RenderSnapshot frameSnapshot;
+    RenderCommandBuffer frameCommands;
+    size_t lastChangedCellCount;
+
+    // Write the changed cells to the terminal
+    void present();
+
+    // Pick up a new terminal size after a resize
+    void handleTerminalResize();
+};
+
+} // namespace GreedySnake
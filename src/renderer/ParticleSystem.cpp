@@ -0,0 +1,203 @@
+#include "renderer/ParticleSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace GreedySnake
+{
+
+namespace
+{
+// Speed lost per second, as a fraction
+const float DRAG = 2.5f;
+
+// Particle edge length in cells at full life; shrinks to half as it fades
+const float PARTICLE_SIZE = 0.2f;
+
+// The budget never drops below capacity / MIN_BUDGET_DIVISOR
+const size_t MIN_BUDGET_DIVISOR = 16;
+
+// Seconds between budget changes, so one slow frame doesn't halve the effects
+const float ADAPT_INTERVAL = 0.25f;
+
+// Weight of the newest frame in the smoothed frame time
+const float FRAME_TIME_SMOOTHING = 0.1f;
+
+const float TWO_PI = 6.28318530718f;
+} // namespace
+
+ParticleSystem::ParticleSystem(size_t capacity)
+    : positionX(capacity),
+      positionY(capacity),
+      velocityX(capacity),
+      velocityY(capacity),
+      lifetime(capacity),
+      inverseLifetime(capacity),
+      color(capacity),
+      liveCount(0),
+      budget(capacity),
+      targetFrameTime(0.0f),
+      smoothedFrameTime(0.0f),
+      timeSinceAdapt(0.0f),
+      randomState(0x9E3779B9u)
+{
+}
+
+void ParticleSystem::setTargetFrameTime(float seconds)
+{
+    targetFrameTime = std::max(seconds, 0.0f);
+    smoothedFrameTime = targetFrameTime;
+}
+
+size_t ParticleSystem::emitBurst(float x,
+                                 float y,
+                                 size_t count,
+                                 uint32_t burstColor,
+                                 float speed,
+                                 float maxLifetime)
+{
+    const size_t available = budget > liveCount ? budget - liveCount : 0;
+    const size_t emitted = std::min(count, available);
+
+    for (size_t n = 0; n < emitted; ++n)
+    {
+        const size_t i = liveCount++;
+        const float angle = nextRandom() * TWO_PI;
+        const float particleSpeed = speed * (0.3f + 0.7f * nextRandom());
+        const float particleLifetime = maxLifetime * (0.5f + 0.5f * nextRandom());
+
+        positionX[i] = x;
+        positionY[i] = y;
+        velocityX[i] = std::cos(angle) * particleSpeed;
+        velocityY[i] = std::sin(angle) * particleSpeed;
+        lifetime[i] = particleLifetime;
+        inverseLifetime[i] = 1.0f / particleLifetime;
+        color[i] = burstColor;
+    }
+    return emitted;
+}
+
+void ParticleSystem::update(float deltaTime)
+{
+    if (deltaTime <= 0.0f)
+    {
+        return;
+    }
+
+    adaptBudget(deltaTime);
+
+    // Branch-free integration over the live range, one array at a time
+    const size_t count = liveCount;
+    const float damping = std::max(0.0f, 1.0f - DRAG * deltaTime);
+    float* px = positionX.data();
+    float* py = positionY.data();
+    float* vx = velocityX.data();
+    float* vy = velocityY.data();
+    float* life = lifetime.data();
+    for (size_t i = 0; i < count; ++i)
+    {
+        px[i] += vx[i] * deltaTime;
+        py[i] += vy[i] * deltaTime;
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        vx[i] *= damping;
+        vy[i] *= damping;
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        life[i] -= deltaTime;
+    }
+
+    // Compact: move the last live particle into each dead slot
+    size_t i = 0;
+    while (i < liveCount)
+    {
+        if (lifetime[i] > 0.0f)
+        {
+            ++i;
+            continue;
+        }
+
+        const size_t last = --liveCount;
+        positionX[i] = positionX[last];
+        positionY[i] = positionY[last];
+        velocityX[i] = velocityX[last];
+        velocityY[i] = velocityY[last];
+        lifetime[i] = lifetime[last];
+        inverseLifetime[i] = inverseLifetime[last];
+        color[i] = color[last];
+    }
+}
+
+void ParticleSystem::appendCommands(RenderCommandBuffer& commands) const
+{
+    for (size_t i = 0; i < liveCount; ++i)
+    {
+        // Fade out and shrink over the particle's life
+        const float remaining = std::min(lifetime[i] * inverseLifetime[i], 1.0f);
+        const auto alpha = static_cast<uint32_t>((color[i] >> 24) * remaining);
+        const uint32_t fadedColor = (color[i] & 0x00FFFFFFu) | (alpha << 24);
+        commands.addParticle(
+            positionX[i], positionY[i], PARTICLE_SIZE * (0.5f + 0.5f * remaining), fadedColor);
+    }
+}
+
+void ParticleSystem::clear()
+{
+    liveCount = 0;
+}
+
+size_t ParticleSystem::getLiveCount() const
+{
+    return liveCount;
+}
+
+size_t ParticleSystem::getCapacity() const
+{
+    return positionX.size();
+}
+
+size_t ParticleSystem::getBudget() const
+{
+    return budget;
+}
+
+void ParticleSystem::adaptBudget(float deltaTime)
+{
+    if (targetFrameTime <= 0.0f)
+    {
+        return;
+    }
+
+    smoothedFrameTime += (deltaTime - smoothedFrameTime) * FRAME_TIME_SMOOTHING;
+    timeSinceAdapt += deltaTime;
+    if (timeSinceAdapt < ADAPT_INTERVAL)
+    {
+        return;
+    }
+    timeSinceAdapt = 0.0f;
+
+    const size_t capacity = getCapacity();
+    const size_t minimum = std::max<size_t>(1, capacity / MIN_BUDGET_DIVISOR);
+    if (smoothedFrameTime > targetFrameTime)
+    {
+        // Back off quickly while frames are slow...
+        budget = std::max(minimum, budget / 2);
+    }
+    else if (smoothedFrameTime < targetFrameTime * 0.8f)
+    {
+        // ...and recover gradually once there is headroom again
+        budget = std::min(capacity, budget + std::max<size_t>(1, capacity / 8));
+    }
+}
+
+float ParticleSystem::nextRandom()
+{
+    // xorshift32: cheap, allocation-free and reproducible
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return static_cast<float>(randomState >> 8) * (1.0f / 16777216.0f);
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "renderer/RenderCommandBuffer.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Fixed-capacity pool of short-lived particles for eat and death effects
+ *
+ * Particles are stored as parallel arrays (struct of arrays) so the per-frame
+ * integration is a handful of branch-free loops over floats that compilers
+ * vectorize. All storage is allocated up front; emitting and updating never
+ * allocate. Dead particles are swapped with the last live one, so live
+ * particles are always the first getLiveCount() entries.
+ *
+ * The number of particles that may be alive at once (the budget) shrinks
+ * while frames take longer than the target frame time and grows back when
+ * they are fast again, so effects get thinner rather than costing frames on
+ * slow machines.
+ */
+class ParticleSystem
+{
+  public:
+    static constexpr size_t DEFAULT_CAPACITY = 2048;
+
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of live particles
+     */
+    explicit ParticleSystem(size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Set the frame time above which the budget shrinks
+     * @param seconds Target frame time; 0 disables budget adaptation
+     */
+    void setTargetFrameTime(float seconds);
+
+    /**
+     * @brief Emit particles flying out from a point in all directions
+     *
+     * Emits fewer particles (or none) if the budget is used up.
+     *
+     * @param x Column (fractional)
+     * @param y Row (fractional)
+     * @param count Number of particles requested
+     * @param color Packed RGBA color
+     * @param speed Maximum speed in cells per second
+     * @param lifetime Maximum lifetime in seconds
+     * @return Number of particles emitted
+     */
+    size_t emitBurst(float x, float y, size_t count, uint32_t color, float speed, float lifetime);
+
+    /**
+     * @brief Advance all particles and adapt the budget to the frame time
+     * @param deltaTime Seconds since the previous update
+     */
+    void update(float deltaTime);
+
+    /**
+     * @brief Add a PARTICLE command for every live particle
+     * @param commands Frame to add the particles to
+     */
+    void appendCommands(RenderCommandBuffer& commands) const;
+
+    /**
+     * @brief Remove all particles (the budget is kept)
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of live particles
+     * @return Live particle count
+     */
+    [[nodiscard]] size_t getLiveCount() const;
+
+    /**
+     * @brief Get the maximum number of live particles
+     * @return Pool capacity
+     */
+    [[nodiscard]] size_t getCapacity() const;
+
+    /**
+     * @brief Get how many particles may currently be alive
+     * @return Particle budget, between the minimum budget and the capacity
+     */
+    [[nodiscard]] size_t getBudget() const;
+
+  private:
+    // Component arrays, capacity entries each
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> lifetime;        // Seconds left
+    std::vector<float> inverseLifetime; // 1 / initial lifetime, for fading
+    std::vector<uint32_t> color;
+
+    size_t liveCount;
+    size_t budget;
+    float targetFrameTime;
+    float smoothedFrameTime;
+    float timeSinceAdapt;
+    uint32_t randomState;
+
+    // Shrink or grow the budget from the smoothed frame time
+    void adaptBudget(float deltaTime);
+
+    // Uniform random number in [0, 1)
+    float nextRandom();
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,228 @@
+#include "renderer/PixelBuffer.h"
+#include "renderer/TerminalCellBuffer.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace GreedySnake
+{
+
+namespace
+{
+const int GLYPH_WIDTH = 3;
+const int GLYPH_HEIGHT = 5;
+const int GLYPH_SPACING = 1;
+
+/**
+ * @brief One glyph of the built-in font: five rows of three bits, MSB on the left
+ */
+struct Glyph
+{
+    char character;
+    uint8_t rows[GLYPH_HEIGHT];
+};
+
+const Glyph FONT[] = {
+    {' ', {0b000, 0b000, 0b000, 0b000, 0b000}}, {'0', {0b111, 0b101, 0b101, 0b101, 0b111}},
+    {'1', {0b010, 0b110, 0b010, 0b010, 0b111}}, {'2', {0b111, 0b001, 0b111, 0b100, 0b111}},
+    {'3', {0b111, 0b001, 0b111, 0b001, 0b111}}, {'4', {0b101, 0b101, 0b111, 0b001, 0b001}},
+    {'5', {0b111, 0b100, 0b111, 0b001, 0b111}}, {'6', {0b111, 0b100, 0b111, 0b101, 0b111}},
+    {'7', {0b111, 0b001, 0b001, 0b001, 0b001}}, {'8', {0b111, 0b101, 0b111, 0b101, 0b111}},
+    {'9', {0b111, 0b101, 0b111, 0b001, 0b111}}, {'A', {0b010, 0b101, 0b111, 0b101, 0b101}},
+    {'B', {0b110, 0b101, 0b110, 0b101, 0b110}}, {'C', {0b011, 0b100, 0b100, 0b100, 0b011}},
+    {'D', {0b110, 0b101, 0b101, 0b101, 0b110}}, {'E', {0b111, 0b100, 0b110, 0b100, 0b111}},
+    {'F', {0b111, 0b100, 0b110, 0b100, 0b100}}, {'G', {0b011, 0b100, 0b101, 0b101, 0b011}},
+    {'H', {0b101, 0b101, 0b111, 0b101, 0b101}}, {'I', {0b111, 0b010, 0b010, 0b010, 0b111}},
+    {'J', {0b001, 0b001, 0b001, 0b101, 0b010}}, {'K', {0b101, 0b101, 0b110, 0b101, 0b101}},
+    {'L', {0b100, 0b100, 0b100, 0b100, 0b111}}, {'M', {0b101, 0b111, 0b111, 0b101, 0b101}},
+    {'N', {0b110, 0b101, 0b101, 0b101, 0b101}}, {'O', {0b010, 0b101, 0b101, 0b101, 0b010}},
+    {'P', {0b110, 0b101, 0b110, 0b100, 0b100}}, {'Q', {0b010, 0b101, 0b101, 0b110, 0b011}},
+    {'R', {0b110, 0b101, 0b110, 0b101, 0b101}}, {'S', {0b011, 0b100, 0b010, 0b001, 0b110}},
+    {'T', {0b111, 0b010, 0b010, 0b010, 0b010}}, {'U', {0b101, 0b101, 0b101, 0b101, 0b111}},
+    {'V', {0b101, 0b101, 0b101, 0b101, 0b010}}, {'W', {0b101, 0b101, 0b111, 0b111, 0b101}},
+    {'X', {0b101, 0b101, 0b010, 0b101, 0b101}}, {'Y', {0b101, 0b101, 0b010, 0b010, 0b010}},
+    {'Z', {0b111, 0b001, 0b010, 0b100, 0b111}}, {':', {0b000, 0b010, 0b000, 0b010, 0b000}},
+    {'!', {0b010, 0b010, 0b010, 0b000, 0b010}}, {'.', {0b000, 0b000, 0b000, 0b000, 0b010}},
+    {',', {0b000, 0b000, 0b000, 0b010, 0b100}}, {'-', {0b000, 0b000, 0b111, 0b000, 0b000}},
+    {'+', {0b000, 0b010, 0b111, 0b010, 0b000}}, {'=', {0b000, 0b111, 0b000, 0b111, 0b000}},
+    {'>', {0b100, 0b010, 0b001, 0b010, 0b100}}, {'<', {0b001, 0b010, 0b100, 0b010, 0b001}},
+    {'^', {0b010, 0b101, 0b000, 0b000, 0b000}}, {'/', {0b001, 0b001, 0b010, 0b100, 0b100}},
+    {'(', {0b010, 0b100, 0b100, 0b100, 0b010}}, {')', {0b010, 0b001, 0b001, 0b001, 0b010}},
+    {'#', {0b101, 0b111, 0b101, 0b111, 0b101}}, {'%', {0b101, 0b001, 0b010, 0b100, 0b101}},
+    {'\'', {0b010, 0b010, 0b000, 0b000, 0b000}}, {'?', {0b111, 0b001, 0b010, 0b000, 0b010}},
+};
+
+const Glyph& findGlyph(char character)
+{
+    const char upper = static_cast<char>(std::toupper(static_cast<unsigned char>(character)));
+    for (const Glyph& glyph : FONT)
+    {
+        if (glyph.character == upper)
+        {
+            return glyph;
+        }
+    }
+    return findGlyph('?');
+}
+} // namespace
+
+PixelBuffer::PixelBuffer(int width, int height) : width(0), height(0)
+{
+    resize(width, height);
+}
+
+void PixelBuffer::resize(int newWidth, int newHeight)
+{
+    width = std::max(newWidth, 0);
+    height = std::max(newHeight, 0);
+    pixels.resize(static_cast<size_t>(width) * height);
+}
+
+int PixelBuffer::getWidth() const
+{
+    return width;
+}
+
+int PixelBuffer::getHeight() const
+{
+    return height;
+}
+
+const std::vector<uint32_t>& PixelBuffer::getPixels() const
+{
+    return pixels;
+}
+
+uint32_t PixelBuffer::getPixel(int x, int y) const
+{
+    if (x < 0 || y < 0 || x >= width || y >= height)
+    {
+        return 0;
+    }
+    return pixels[static_cast<size_t>(y) * width + x];
+}
+
+void PixelBuffer::clear(uint32_t color)
+{
+    fillSpan(pixels.data(), pixels.size(), color);
+}
+
+void PixelBuffer::fillRect(int x, int y, int rectWidth, int rectHeight, uint32_t color)
+{
+    // Clip to the image
+    const int left = std::max(x, 0);
+    const int top = std::max(y, 0);
+    const int right = std::min(x + rectWidth, width);
+    const int bottom = std::min(y + rectHeight, height);
+    if (left >= right || top >= bottom)
+    {
+        return;
+    }
+
+    const auto spanLength = static_cast<size_t>(right - left);
+    for (int row = top; row < bottom; ++row)
+    {
+        fillSpan(&pixels[static_cast<size_t>(row) * width + left], spanLength, color);
+    }
+}
+
+void PixelBuffer::fillCircle(float centerX, float centerY, float radius, uint32_t color)
+{
+    if (radius <= 0.0f)
+    {
+        return;
+    }
+
+    // One span per row, covering the pixels whose centers lie inside the circle
+    const int top = static_cast<int>(std::ceil(centerY - radius - 0.5f));
+    const int bottom = static_cast<int>(std::floor(centerY + radius - 0.5f));
+    for (int row = top; row <= bottom; ++row)
+    {
+        const float dy = row + 0.5f - centerY;
+        const float halfWidth = std::sqrt(std::max(0.0f, radius * radius - dy * dy));
+        const int left = static_cast<int>(std::ceil(centerX - halfWidth - 0.5f));
+        const int right = static_cast<int>(std::floor(centerX + halfWidth - 0.5f));
+        fillRect(left, row, right - left + 1, 1, color);
+    }
+}
+
+void PixelBuffer::drawText(int x, int y, const std::string& text, int scale, uint32_t color)
+{
+    const int advance = (GLYPH_WIDTH + GLYPH_SPACING) * scale;
+    size_t index = 0;
+    while (index < text.size())
+    {
+        drawGlyph(x, y, TerminalCellBuffer::decodeCharacter(text, index), scale, color);
+        x += advance;
+    }
+}
+
+int PixelBuffer::getTextWidth(const std::string& text, int scale)
+{
+    const int columns = TerminalCellBuffer::getTextWidth(text);
+    if (columns == 0)
+    {
+        return 0;
+    }
+    return (columns * (GLYPH_WIDTH + GLYPH_SPACING) - GLYPH_SPACING) * scale;
+}
+
+int PixelBuffer::getTextHeight(int scale)
+{
+    return GLYPH_HEIGHT * scale;
+}
+
+void PixelBuffer::fillSpan(uint32_t* destination, size_t count, uint32_t color)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    // Four pixels per store
+    const __m128i value = _mm_set1_epi32(static_cast<int>(color));
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), value);
+    }
+#elif defined(__ARM_NEON)
+    const uint32x4_t value = vdupq_n_u32(color);
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_u32(destination + i, value);
+    }
+#endif
+    // Remainder (or the whole span without SIMD)
+    std::fill(destination + i, destination + count, color);
+}
+
+void PixelBuffer::drawGlyph(int x, int y, char character, int scale, uint32_t color)
+{
+    const Glyph& glyph = findGlyph(character);
+    for (int row = 0; row < GLYPH_HEIGHT; ++row)
+    {
+        // Fill runs of set bits as single spans
+        int column = 0;
+        while (column < GLYPH_WIDTH)
+        {
+            const int bit = GLYPH_WIDTH - 1 - column;
+            if ((glyph.rows[row] >> bit & 1) == 0)
+            {
+                ++column;
+                continue;
+            }
+
+            const int start = column;
+            while (column < GLYPH_WIDTH && (glyph.rows[row] >> (GLYPH_WIDTH - 1 - column) & 1))
+            {
+                ++column;
+            }
+            fillRect(x + start * scale, y + row * scale, (column - start) * scale, scale, color);
+        }
+    }
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief CPU-side RGBA image with the primitives needed to draw the game
+ *
+ * Pixels are stored row-major as 32-bit values whose bytes are R, G, B, A in
+ * memory order (on little-endian hosts), so the buffer can be handed to image
+ * writers or tensor libraries without conversion. All drawing is built on
+ * horizontal span fills, which use SIMD stores where available.
+ */
+class PixelBuffer
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param width Width in pixels
+     * @param height Height in pixels
+     */
+    PixelBuffer(int width = 0, int height = 0);
+
+    /**
+     * @brief Pack a color into the buffer's pixel format
+     * @param r Red component
+     * @param g Green component
+     * @param b Blue component
+     * @param a Alpha component
+     * @return Packed pixel value
+     */
+    static constexpr uint32_t packColor(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255)
+    {
+        return static_cast<uint32_t>(r) | (static_cast<uint32_t>(g) << 8) |
+               (static_cast<uint32_t>(b) << 16) | (static_cast<uint32_t>(a) << 24);
+    }
+
+    /**
+     * @brief Resize the image; contents become undefined until the next clear
+     * @param width Width in pixels
+     * @param height Height in pixels
+     */
+    void resize(int width, int height);
+
+    /**
+     * @brief Get the width in pixels
+     * @return Width of the image
+     */
+    [[nodiscard]] int getWidth() const;
+
+    /**
+     * @brief Get the height in pixels
+     * @return Height of the image
+     */
+    [[nodiscard]] int getHeight() const;
+
+    /**
+     * @brief Get the pixel data
+     * @return Row-major pixels, width * height entries
+     */
+    [[nodiscard]] const std::vector<uint32_t>& getPixels() const;
+
+    /**
+     * @brief Get one pixel
+     * @param x Column
+     * @param y Row
+     * @return Packed pixel value (0 if out of bounds)
+     */
+    [[nodiscard]] uint32_t getPixel(int x, int y) const;
+
+    /**
+     * @brief Fill the whole image with one color
+     * @param color Packed color
+     */
+    void clear(uint32_t color);
+
+    /**
+     * @brief Fill an axis-aligned rectangle, clipped to the image
+     * @param x Left edge
+     * @param y Top edge
+     * @param width Width in pixels
+     * @param height Height in pixels
+     * @param color Packed color
+     */
+    void fillRect(int x, int y, int width, int height, uint32_t color);
+
+    /**
+     * @brief Fill a circle, clipped to the image
+     * @param centerX Center column (fractional)
+     * @param centerY Center row (fractional)
+     * @param radius Radius in pixels
+     * @param color Packed color
+     */
+    void fillCircle(float centerX, float centerY, float radius, uint32_t color);
+
+    /**
+     * @brief Draw text with the built-in 3x5 pixel font, clipped to the image
+     *
+     * Lowercase letters are drawn as uppercase; characters without a glyph are
+     * drawn as '?'.
+     *
+     * @param x Left edge
+     * @param y Top edge
+     * @param text UTF-8 text
+     * @param scale Size of one font dot in pixels
+     * @param color Packed color
+     */
+    void drawText(int x, int y, const std::string& text, int scale, uint32_t color);
+
+    /**
+     * @brief Get the width of text drawn with drawText()
+     * @param text UTF-8 text
+     * @param scale Size of one font dot in pixels
+     * @return Width in pixels
+     */
+    [[nodiscard]] static int getTextWidth(const std::string& text, int scale);
+
+    /**
+     * @brief Height of one line of text drawn with drawText()
+     * @param scale Size of one font dot in pixels
+     * @return Height in pixels
+     */
+    [[nodiscard]] static int getTextHeight(int scale);
+
+    /**
+     * @brief Fill a run of pixels with one color
+     * @param destination First pixel of the span
+     * @param count Number of pixels
+     * @param color Packed color
+     */
+    static void fillSpan(uint32_t* destination, size_t count, uint32_t color);
+
+  private:
+    int width;
+    int height;
+    std::vector<uint32_t> pixels;
+
+    // Draw one glyph of the built-in font
+    void drawGlyph(int x, int y, char character, int scale, uint32_t color);
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,167 @@
+#include "renderer/RenderCommandBuffer.h"
+
+namespace GreedySnake
+{
+
+void RenderCommandBuffer::clear()
+{
+    commands.clear();
+    textCount = 0;
+    boardPresent = false;
+    tick = NO_TICK;
+    boardWidth = 0;
+    boardHeight = 0;
+    focusX = 0.0f;
+    focusY = 0.0f;
+}
+
+void RenderCommandBuffer::setBoard(int width, int height, float newFocusX, float newFocusY)
+{
+    boardPresent = true;
+    boardWidth = width;
+    boardHeight = height;
+    focusX = newFocusX;
+    focusY = newFocusY;
+}
+
+void RenderCommandBuffer::setTick(uint64_t frameTick)
+{
+    tick = frameTick;
+}
+
+uint64_t RenderCommandBuffer::getTick() const
+{
+    return tick;
+}
+
+bool RenderCommandBuffer::hasBoard() const
+{
+    return boardPresent;
+}
+
+int RenderCommandBuffer::getBoardWidth() const
+{
+    return boardWidth;
+}
+
+int RenderCommandBuffer::getBoardHeight() const
+{
+    return boardHeight;
+}
+
+float RenderCommandBuffer::getFocusX() const
+{
+    return focusX;
+}
+
+float RenderCommandBuffer::getFocusY() const
+{
+    return focusY;
+}
+
+void RenderCommandBuffer::addRect(float x, float y, float width, float height, uint32_t color)
+{
+    commands.push_back(
+        RenderCommand{RenderCommand::Type::RECT, 0, 0, 0, color, x, y, width, height});
+}
+
+void RenderCommandBuffer::addCircle(float centerX, float centerY, float radius, uint32_t color)
+{
+    commands.push_back(RenderCommand{
+        RenderCommand::Type::CIRCLE, 0, 0, 0, color, centerX, centerY, radius, radius});
+}
+
+void RenderCommandBuffer::addSprite(SpriteId sprite,
+                                    float x,
+                                    float y,
+                                    float width,
+                                    float height,
+                                    uint32_t color)
+{
+    commands.push_back(RenderCommand{RenderCommand::Type::SPRITE,
+                                     static_cast<uint8_t>(sprite),
+                                     0,
+                                     0,
+                                     color,
+                                     x,
+                                     y,
+                                     width,
+                                     height});
+}
+
+void RenderCommandBuffer::addParticle(float centerX, float centerY, float size, uint32_t color)
+{
+    commands.push_back(RenderCommand{
+        RenderCommand::Type::PARTICLE, 0, 0, 0, color, centerX, centerY, size, size});
+}
+
+void RenderCommandBuffer::addText(const std::string& text,
+                                  TextStyle style,
+                                  TextAnchor anchor,
+                                  float line,
+                                  uint32_t color)
+{
+    addText("", text, style, anchor, line, color);
+}
+
+void RenderCommandBuffer::addText(const char* prefix,
+                                  const std::string& text,
+                                  TextStyle style,
+                                  TextAnchor anchor,
+                                  float line,
+                                  uint32_t color)
+{
+    // Reuse pooled strings so their capacity survives from frame to frame
+    if (textCount == texts.size())
+    {
+        texts.emplace_back();
+    }
+    texts[textCount].assign(prefix);
+    texts[textCount] += text;
+
+    commands.push_back(RenderCommand{RenderCommand::Type::TEXT,
+                                     static_cast<uint8_t>(style),
+                                     static_cast<uint8_t>(anchor),
+                                     static_cast<uint16_t>(textCount),
+                                     color,
+                                     0.0f,
+                                     line,
+                                     0.0f,
+                                     0.0f});
+    ++textCount;
+}
+
+const std::vector<RenderCommand>& RenderCommandBuffer::getCommands() const
+{
+    return commands;
+}
+
+const std::string& RenderCommandBuffer::getText(const RenderCommand& command) const
+{
+    return texts[command.textId];
+}
+
+void RenderCommandBuffer::copyFrom(const RenderCommandBuffer& other)
+{
+    // Vector assignment reuses the existing allocation when it is large enough
+    commands = other.commands;
+
+    if (texts.size() < other.textCount)
+    {
+        texts.resize(other.textCount);
+    }
+    for (size_t i = 0; i < other.textCount; ++i)
+    {
+        texts[i].assign(other.texts[i]);
+    }
+    textCount = other.textCount;
+
+    boardPresent = other.boardPresent;
+    tick = other.tick;
+    boardWidth = other.boardWidth;
+    boardHeight = other.boardHeight;
+    focusX = other.focusX;
+    focusY = other.focusY;
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Sprites a backend may draw with a texture; the command color is the fallback
+ */
+enum class SpriteId : uint8_t
+{
+    SNAKE_HEAD,
+    SNAKE_BODY,
+    FOOD,
+    WALL,
+    BACKGROUND // Empty board cell
+};
+
+/**
+ * @brief Role of a text command; backends pick font size (or terminal attributes) from it
+ */
+enum class TextStyle : uint8_t
+{
+    HUD,           // Score line
+    BANNER,        // Game over / paused message
+    TITLE,         // Menu title
+    ITEM,          // Menu item
+    SELECTED_ITEM, // Highlighted menu item
+    HINT           // Instructions below a menu
+};
+
+/**
+ * @brief Where a text command's line counts from
+ */
+enum class TextAnchor : uint8_t
+{
+    TOP_LEFT,   // Left-aligned from the top of the screen
+    TOP_CENTER, // Centered horizontally, from the top of the screen
+    CENTER      // Centered horizontally, from the middle of the screen
+};
+
+/**
+ * @brief One draw command
+ *
+ * Shapes and sprites are positioned in board cells, so every backend can map
+ * them through its own camera (pixels, terminal cells, ...). Text is placed by
+ * anchor and line number in backend-defined line units.
+ */
+struct RenderCommand
+{
+    /**
+     * @brief Kind of command
+     */
+    enum class Type : uint8_t
+    {
+        RECT,   // x, y, width, height in cells
+        CIRCLE, // Center x, y and radius (width) in cells
+        SPRITE,   // Sprite id; x, y, width, height in cells
+        PARTICLE, // Center x, y and edge length (width) in cells; color may be translucent
+        TEXT      // Text id, style and anchor; y is the line
+    };
+
+    Type type;
+    uint8_t style;   // SpriteId for sprites, TextStyle for text
+    uint8_t anchor;  // TextAnchor for text
+    uint16_t textId; // Index into the buffer's text pool
+    uint32_t color;  // RGBA in PixelBuffer::packColor layout
+    float x;
+    float y;
+    float width;
+    float height;
+};
+
+/**
+ * @brief Reusable list of draw commands describing one frame
+ *
+ * Filled by the layout pass (see FrameLayout) and replayed by any number of
+ * backends. clear() keeps all storage, including the text pool strings, so
+ * building a frame of a similar size again does not allocate.
+ */
+class RenderCommandBuffer
+{
+  public:
+    static constexpr uint64_t NO_TICK = UINT64_MAX;
+
+    /**
+     * @brief Start a new frame, keeping the allocated storage
+     */
+    void clear();
+
+    /**
+     * @brief Record which game tick the frame shows
+     * @param frameTick Tick count of the game when it was captured
+     */
+    void setTick(uint64_t frameTick);
+
+    /**
+     * @brief Get the game tick the frame shows
+     * @return Tick count, or NO_TICK for frames without a game
+     */
+    [[nodiscard]] uint64_t getTick() const;
+
+    /**
+     * @brief Declare the board shown by the board-space commands
+     * @param width Board width in cells
+     * @param height Board height in cells
+     * @param focusX Column (fractional) a scrolling camera should keep in view
+     * @param focusY Row (fractional) a scrolling camera should keep in view
+     */
+    void setBoard(int width, int height, float focusX, float focusY);
+
+    /**
+     * @brief Check if the frame shows a board
+     * @return True if setBoard() was called since clear()
+     */
+    [[nodiscard]] bool hasBoard() const;
+
+    /**
+     * @brief Get the board width
+     * @return Board width in cells
+     */
+    [[nodiscard]] int getBoardWidth() const;
+
+    /**
+     * @brief Get the board height
+     * @return Board height in cells
+     */
+    [[nodiscard]] int getBoardHeight() const;
+
+    /**
+     * @brief Get the column a scrolling camera should follow
+     * @return Focus column (fractional, cell centers at .5)
+     */
+    [[nodiscard]] float getFocusX() const;
+
+    /**
+     * @brief Get the row a scrolling camera should follow
+     * @return Focus row (fractional, cell centers at .5)
+     */
+    [[nodiscard]] float getFocusY() const;
+
+    /**
+     * @brief Add a filled rectangle
+     * @param x Left edge in cells
+     * @param y Top edge in cells
+     * @param width Width in cells
+     * @param height Height in cells
+     * @param color Packed RGBA color
+     */
+    void addRect(float x, float y, float width, float height, uint32_t color);
+
+    /**
+     * @brief Add a filled circle
+     * @param centerX Center column
+     * @param centerY Center row
+     * @param radius Radius in cells
+     * @param color Packed RGBA color
+     */
+    void addCircle(float centerX, float centerY, float radius, uint32_t color);
+
+    /**
+     * @brief Add a sprite
+     * @param sprite Sprite to draw
+     * @param x Left edge in cells
+     * @param y Top edge in cells
+     * @param width Width in cells
+     * @param height Height in cells
+     * @param color Fallback color for backends without textures
+     */
+    void addSprite(SpriteId sprite, float x, float y, float width, float height, uint32_t color);
+
+    /**
+     * @brief Add a particle (a small square)
+     * @param centerX Center column
+     * @param centerY Center row
+     * @param size Edge length in cells
+     * @param color Packed RGBA color
+     */
+    void addParticle(float centerX, float centerY, float size, uint32_t color);
+
+    /**
+     * @brief Add a line of text
+     * @param text UTF-8 text (copied into the text pool)
+     * @param style Role of the text
+     * @param anchor Where the line counts from
+     * @param line Line offset from the anchor (fractional lines allowed)
+     * @param color Packed RGBA color
+     */
+    void addText(const std::string& text,
+                 TextStyle style,
+                 TextAnchor anchor,
+                 float line,
+                 uint32_t color);
+
+    /**
+     * @brief Add a line of text made of a prefix and a body
+     *
+     * Saves building the joined string first, so pooled storage is reused.
+     *
+     * @param prefix Text in front of the body
+     * @param text UTF-8 text (copied into the text pool)
+     * @param style Role of the text
+     * @param anchor Where the line counts from
+     * @param line Line offset from the anchor (fractional lines allowed)
+     * @param color Packed RGBA color
+     */
+    void addText(const char* prefix,
+                 const std::string& text,
+                 TextStyle style,
+                 TextAnchor anchor,
+                 float line,
+                 uint32_t color);
+
+    /**
+     * @brief Get the commands in drawing order
+     * @return Commands of the current frame
+     */
+    [[nodiscard]] const std::vector<RenderCommand>& getCommands() const;
+
+    /**
+     * @brief Get the text of a text command
+     * @param command A TEXT command of this buffer
+     * @return The text
+     */
+    [[nodiscard]] const std::string& getText(const RenderCommand& command) const;
+
+    /**
+     * @brief Copy another buffer's frame, reusing this buffer's storage
+     * @param other Buffer to copy
+     */
+    void copyFrom(const RenderCommandBuffer& other);
+
+  private:
+    std::vector<RenderCommand> commands;
+    std::vector<std::string> texts; // Pool; only the first textCount entries are live
+    size_t textCount = 0;
+    bool boardPresent = false;
+    uint64_t tick = NO_TICK;
+    int boardWidth = 0;
+    int boardHeight = 0;
+    float focusX = 0.0f;
+    float focusY = 0.0f;
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,71 @@
+#include "renderer/RenderSnapshot.h"
+
+namespace GreedySnake
+{
+
+void RenderSnapshot::captureGame(const Game& game, float alpha)
+{
+    kind = Kind::GAME;
+
+    const Board& board = game.getBoard();
+    boardWidth = board.getWidth();
+    boardHeight = board.getHeight();
+    tick = game.getTickCount();
+
+    // assign() keeps the existing capacity of the slot
+    const std::vector<Position>& body = game.getSnake().getBody();
+    snakeCells.assign(body.begin(), body.end());
+    previousHead = game.getSnake().getPreviousHead();
+    previousTail = game.getSnake().getPreviousTail();
+    interpolationAlpha = alpha;
+
+    // Sort the entities by kind; clear() keeps the capacity
+    foodCells.clear();
+    obstacleCells.clear();
+    const EntityStore& entities = game.getEntities();
+    const std::vector<Position>& positions = entities.getPositions();
+    const std::vector<EntityKind>& kinds = entities.getKinds();
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+        if (kinds[i] == EntityKind::FOOD)
+        {
+            foodCells.push_back(positions[i]);
+        }
+        else
+        {
+            obstacleCells.push_back(positions[i]);
+        }
+    }
+
+    score = game.getScore();
+    gameOver = game.isGameOver();
+    paused = game.isPaused();
+}
+
+void RenderSnapshot::captureMenu(const std::string& menuTitle,
+                                 const std::vector<std::string>& menuItems,
+                                 size_t selected,
+                                 const std::string& menuInstructions)
+{
+    kind = Kind::MENU;
+
+    title = menuTitle;
+
+    // Copy element-wise so the strings already in the slot keep their buffers
+    items.resize(menuItems.size());
+    for (size_t i = 0; i < menuItems.size(); ++i)
+    {
+        items[i] = menuItems[i];
+    }
+
+    selectedIndex = selected;
+    instructions = menuInstructions;
+}
+
+void RenderSnapshot::captureCommands(const RenderCommandBuffer& frameCommands)
+{
+    kind = Kind::COMMANDS;
+    commands.copyFrom(frameCommands);
+}
+
+} // namespace GreedySnake
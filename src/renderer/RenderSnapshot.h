@@ -0,0 +1,92 @@
+#pragma once
+
+#include "game/Game.h"
+#include "renderer/RenderCommandBuffer.h"
+#include "utils/Position.h"
+#include "utils/TripleBuffer.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Self-contained copy of everything needed to draw one frame
+ *
+ * Snapshots decouple the simulation from rendering: the simulation thread
+ * captures one, publishes it, and never touches it again, so a renderer on
+ * another thread can read it without synchronisation. Capturing reuses the
+ * storage of the previous snapshot in the same slot, so steady-state capture
+ * does not allocate.
+ */
+struct RenderSnapshot
+{
+    /**
+     * @brief What kind of frame the snapshot describes
+     */
+    enum class Kind
+    {
+        NONE,    // Nothing captured yet
+        GAME,    // Gameplay frame
+        MENU,    // Menu frame
+        COMMANDS // Frame already laid out as draw commands
+    };
+
+    Kind kind = Kind::NONE;
+
+    // Gameplay data
+    int boardWidth = 0;
+    int boardHeight = 0;
+    uint64_t tick = 0;                // Game tick count when captured
+    std::vector<Position> snakeCells; // Head first
+    Position previousHead;            // Head before the last tick
+    Position previousTail;            // Tail before the last tick
+    float interpolationAlpha = 1.0f;  // Progress from the previous tick (0) to the current (1)
+    std::vector<Position> foodCells;
+    std::vector<Position> obstacleCells;
+    int score = 0;
+    bool gameOver = false;
+    bool paused = false;
+
+    // Menu data
+    std::string title;
+    std::vector<std::string> items;
+    size_t selectedIndex = 0;
+    std::string instructions;
+
+    // Laid-out frame
+    RenderCommandBuffer commands;
+
+    /**
+     * @brief Capture a gameplay frame
+     * @param game Game to copy the visible state from
+     * @param alpha Progress from the previous tick (0) to the current tick (1)
+     */
+    void captureGame(const Game& game, float alpha = 1.0f);
+
+    /**
+     * @brief Capture a menu frame
+     * @param menuTitle The title to display
+     * @param menuItems List of menu item texts
+     * @param selected Index of the selected item
+     * @param menuInstructions Instructions to display below the menu
+     */
+    void captureMenu(const std::string& menuTitle,
+                     const std::vector<std::string>& menuItems,
+                     size_t selected,
+                     const std::string& menuInstructions);
+
+    /**
+     * @brief Capture a frame that was already laid out
+     * @param frameCommands Draw commands of the frame
+     */
+    void captureCommands(const RenderCommandBuffer& frameCommands);
+};
+
+/**
+ * @brief Triple buffer carrying snapshots from the simulation to the render thread
+ */
+using RenderSnapshotBuffer = TripleBuffer<RenderSnapshot>;
+
+} // namespace GreedySnake
@@ -2,6 +2,7 @@
 
 #include "game/Game.h"
 #include "menu/Input.h"
+#include "renderer/RenderSnapshot.h"
 #include <cstddef> // for size_t
 #include <string>
 #include <vector>
@@ -43,6 +44,29 @@ class Renderer
      */
     virtual void render(const Game& game) = 0;
 
+    /**
+     * @brief Render a frame of the game between two ticks
+     * @param game Reference to the game state to render
+     * @param alpha Progress from the previous tick (0) to the current tick (1)
+     */
+    virtual void renderInterpolated(const Game& game, float alpha)
+    {
+        render(game); // Default implementation: draw the current tick as is
+    }
+
+    /**
+     * @brief Render many games at once in a tiled spectator grid
+     * @param games Games to show, one tile each; null entries leave their tile empty
+     */
+    virtual void renderSpectatorGrid(const std::vector<const Game*>& games)
+    {
+        // Default implementation: show the first game on its own
+        if (!games.empty() && games.front() != nullptr)
+        {
+            render(*games.front());
+        }
+    }
+
     /**
      * @brief Render a game state (menu, settings, etc.)
      * @param title The title to display (if applicable)
@@ -55,6 +79,20 @@ class Renderer
                             size_t selectedIndex,
                             const std::string& instructions = "") = 0;
 
+    /**
+     * @brief Draw a frame that was laid out as draw commands (see FrameLayout)
+     *
+     * This is the path game states use, so a frame is laid out once no matter
+     * how many backends replay it.
+     *
+     * @param commands Commands describing the frame
+     */
+    virtual void renderCommands(const RenderCommandBuffer& commands)
+    {
+        // Default implementation: renderers without command replay only
+        // support the render() and renderMenu() entry points
+    }
+
     /**
      * @brief Check if the render window is still open
      * @return True if the window is open
@@ -74,6 +112,49 @@ class Renderer
      * @return True if the game should continue running
      */
     virtual bool handleEvents(Input& input) = 0;
+
+    /**
+     * @brief Handle all pending input events from the window system
+     *
+     * Appends every translated input of this frame to the batch, in the
+     * order the events arrived, instead of only the first one.
+     *
+     * @param inputs Batch to append the inputs to
+     * @return True if the game should continue running
+     */
+    virtual bool handleEvents(InputBatch& inputs)
+    {
+        // Default implementation: one input per frame
+        Input input = Input::NONE;
+        const bool running = handleEvents(input);
+        if (input != Input::NONE)
+        {
+            inputs.add(input);
+        }
+        return running;
+    }
+
+    /**
+     * @brief Start drawing snapshots from a buffer on a dedicated render thread
+     *
+     * While the thread runs, render() and renderMenu() must not be called on
+     * this renderer; frames are fed through the buffer instead. Event handling
+     * stays on the calling thread.
+     *
+     * @param buffer Triple buffer the simulation publishes snapshots into
+     * @return True if the render thread was started, false if unsupported
+     */
+    virtual bool startRenderThread(RenderSnapshotBuffer& buffer)
+    {
+        return false; // Default implementation: render on the caller's thread
+    }
+
+    /**
+     * @brief Stop the render thread started by startRenderThread()
+     */
+    virtual void stopRenderThread()
+    {
+    }
 };
 
 } // namespace GreedySnake
\ No newline at end of file
@@ -1,16 +1,63 @@
 #include "renderer/SFMLRenderer.h"
+#include "renderer/FrameLayout.h"
+#include <SFML/OpenGL.hpp>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 
 namespace GreedySnake
 {
 
+namespace
+{
+// Vertical distance between text lines in pixels
+const float TEXT_LINE_HEIGHT = 40.0f;
+
+const sf::Color BACKGROUND_COLOR(0, 32, 48);
+
+// Score of a spectator label that has no text yet
+const int NO_SCORE = INT_MIN;
+
+// Fonts tried in order; the later ones have better Unicode coverage on some systems
+const char* const FONT_PATHS[] = {
+    "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+    "/usr/share/fonts/truetype/noto/NotoSans-Regular.ttf",
+    "/usr/share/fonts/truetype/freefont/FreeSans.ttf",
+    "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
+};
+
+// Convert a packed command color (see PixelBuffer::packColor) to an SFML color
+sf::Color toColor(uint32_t color)
+{
+    return sf::Color(color & 0xFF, (color >> 8) & 0xFF, (color >> 16) & 0xFF, color >> 24);
+}
+} // namespace
+
 SFMLRenderer::SFMLRenderer(int width, int height, const std::string& title)
     : windowTitle(title),
       windowWidth(width),
       windowHeight(height),
       cellSize(0.0f),
       currentBoardWidth(20),
-      currentBoardHeight(20) // Default to 20x20
+      currentBoardHeight(20), // Default to 20x20
+      cameraMode(CameraMode::AUTO),
+      followingHead(false),
+      followCellSize(30.0f),
+      minimapEnabled(true),
+      minimapVertices(sf::Quads),
+      spectatorGrid(static_cast<float>(width), static_cast<float>(height)),
+      particleVertices(sf::Quads),
+      startupTimer(nullptr),
+      latencyTracker(nullptr),
+      resourcesLoaded(false),
+      resourcesFailed(false),
+      snapshotBuffer(nullptr),
+      renderThreadRunning(false),
+      captureTime(0)
 {
 }
 
@@ -22,17 +69,37 @@ SFMLRenderer::~SFMLRenderer()
 bool SFMLRenderer::initialize()
 {
     // Create the SFML window
+    const auto windowBegin = StartupTimer::Clock::now();
     window.create(sf::VideoMode(windowWidth, windowHeight),
                   windowTitle,
                   sf::Style::Titlebar | sf::Style::Close);
-    window.setFramerateLimit(60);
+    // Frame pacing is done by the application's FrameScheduler; a driver-side
+    // limit or vsync would stack a second throttle on top of it
+    window.setFramerateLimit(0);
+    window.setVerticalSyncEnabled(false);
+    if (startupTimer != nullptr)
+    {
+        startupTimer->recordPhase("window", windowBegin);
+    }
 
-    // Load resources
-    return loadResources();
+    // Show something right away; fonts and sprites follow when the loader is done
+    drawLoadingFrame();
+    startLoadingResources();
+    return window.isOpen();
 }
 
 void SFMLRenderer::shutdown()
 {
+    // The render thread must release the window before it is closed
+    stopRenderThread();
+    stopCapture();
+
+    // Don't leave the loader running against a renderer that is going away
+    if (pendingResources.valid())
+    {
+        pendingResources.wait();
+    }
+
     if (window.isOpen())
     {
         window.close();
@@ -41,21 +108,109 @@ void SFMLRenderer::shutdown()
 
 bool SFMLRenderer::loadResources()
 {
-    // Create default textures for the game entities
-    createDefaultTextures();
+    if (!resourcesLoaded && !pendingResources.valid())
+    {
+        startLoadingResources();
+    }
+    return finishLoadingResources(true);
+}
+
+bool SFMLRenderer::areResourcesLoaded() const
+{
+    return resourcesLoaded;
+}
+
+void SFMLRenderer::setStartupTimer(StartupTimer* timer)
+{
+    startupTimer = timer;
+}
+
+void SFMLRenderer::setLatencyTracker(LatencyTracker* tracker)
+{
+    latencyTracker = tracker;
+}
 
-    // Load font for text elements
-    if (!font.loadFromFile("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf"))
+SFMLRenderer::LoadedResources SFMLRenderer::readResources(const std::string& atlasPath,
+                                                          StartupTimer* timer)
+{
+    LoadedResources resources;
+
+    // Read the first font file that exists; sf::Font parses it on upload
+    const auto fontBegin = StartupTimer::Clock::now();
+    for (const char* path : FONT_PATHS)
     {
-        std::cerr << "Failed to load primary font, trying alternatives..." << std::endl;
-        // Try loading alternative fonts with better Unicode support
-        if (!font.loadFromFile("/usr/share/fonts/truetype/noto/NotoSans-Regular.ttf") &&
-            !font.loadFromFile("/usr/share/fonts/truetype/freefont/FreeSans.ttf") &&
-            !font.loadFromFile("/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf"))
+        std::ifstream file(path, std::ios::binary);
+        if (file)
         {
-            std::cerr << "Failed to load any fonts!" << std::endl;
-            return false;
+            resources.fontData.assign(std::istreambuf_iterator<char>(file),
+                                      std::istreambuf_iterator<char>());
+        }
+        if (!resources.fontData.empty())
+        {
+            break;
         }
+        std::cerr << "Failed to load font " << path << ", trying alternatives..." << std::endl;
+    }
+    if (timer != nullptr)
+    {
+        timer->recordPhase("fonts", fontBegin);
+    }
+
+    // Decode the theme, or generate the default sprites
+    const auto spritesBegin = StartupTimer::Clock::now();
+    if (atlasPath.empty() || !resources.atlasImage.loadFromFile(atlasPath))
+    {
+        if (!atlasPath.empty())
+        {
+            std::cerr << "Failed to load sprite atlas " << atlasPath
+                      << ", using the default sprites" << std::endl;
+        }
+        resources.atlasImage = SpriteAtlas::generateDefaultImage();
+    }
+    if (timer != nullptr)
+    {
+        timer->recordPhase("sprites", spritesBegin);
+    }
+
+    return resources;
+}
+
+void SFMLRenderer::startLoadingResources()
+{
+    pendingResources = std::async(std::launch::async, &SFMLRenderer::readResources,
+                                  atlasPath, startupTimer);
+}
+
+bool SFMLRenderer::finishLoadingResources(bool wait)
+{
+    if (resourcesLoaded)
+    {
+        return true;
+    }
+    if (!pendingResources.valid())
+    {
+        return false;
+    }
+    if (!wait && pendingResources.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        return false;
+    }
+
+    // Uploads need the OpenGL context, so they happen on the drawing thread
+    const auto uploadBegin = StartupTimer::Clock::now();
+    LoadedResources resources = pendingResources.get();
+
+    // A theme that doesn't fit the atlas layout falls back to the default sprites
+    if (!spriteAtlas.createFromImage(resources.atlasImage) && !spriteAtlas.createDefault())
+    {
+        return false;
+    }
+
+    fontData = std::move(resources.fontData);
+    if (fontData.empty() || !font.loadFromMemory(fontData.data(), fontData.size()))
+    {
+        std::cerr << "Failed to load any fonts!" << std::endl;
+        return false;
     }
 
     // Initialize text elements
@@ -64,15 +219,8 @@ bool SFMLRenderer::loadResources()
     scoreText.setFillColor(sf::Color::White);
     scoreText.setPosition(10.f, 10.f);
 
-    gameOverText.setFont(font);
-    gameOverText.setCharacterSize(40);
-    gameOverText.setFillColor(sf::Color::Red);
-    gameOverText.setString("Game Over! Press R to restart");
-
-    pausedText.setFont(font);
-    pausedText.setCharacterSize(40);
-    pausedText.setFillColor(sf::Color::Yellow);
-    pausedText.setString("Paused. Press P to resume");
+    bannerText.setFont(font);
+    bannerText.setCharacterSize(40);
 
     // Initialize menu text elements
     menuTitleText.setFont(font);
@@ -83,13 +231,85 @@ bool SFMLRenderer::loadResources()
     menuItemText.setCharacterSize(24);
     menuItemText.setFillColor(sf::Color::White);
 
+    hintText.setFont(font);
+    hintText.setCharacterSize(16);
+
+    // Small per-tile score labels for the spectator grid
+    spectatorScoreText.setFont(font);
+    spectatorScoreText.setCharacterSize(12);
+    spectatorScoreText.setFillColor(sf::Color::White);
+
     // Initialize cell size with a default value for testing purposes
     // This will be recalculated during rendering with the actual board
     cellSize = 30.0f;
 
+    resourcesLoaded = true;
+    if (startupTimer != nullptr)
+    {
+        startupTimer->recordPhase("resource upload", uploadBegin);
+    }
     return true;
 }
 
+bool SFMLRenderer::prepareFrame()
+{
+    if (resourcesLoaded)
+    {
+        return true;
+    }
+    if (resourcesFailed.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    const bool loaderDone = pendingResources.valid() &&
+                            pendingResources.wait_for(std::chrono::seconds(0)) ==
+                                std::future_status::ready;
+    if (finishLoadingResources(false))
+    {
+        return true;
+    }
+
+    if (loaderDone)
+    {
+        // Nothing to draw text with; give up like a failed initialize() would. This may be
+        // the render thread, so the window is closed where its events are polled
+        resourcesFailed.store(true, std::memory_order_release);
+    }
+    else
+    {
+        drawLoadingFrame();
+    }
+    return false;
+}
+
+bool SFMLRenderer::closeIfResourcesFailed()
+{
+    if (!resourcesFailed.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    stopRenderThread();
+    window.close();
+    return true;
+}
+
+void SFMLRenderer::drawLoadingFrame()
+{
+    if (!window.isOpen())
+    {
+        return;
+    }
+
+    window.clear(BACKGROUND_COLOR);
+    window.display();
+    if (startupTimer != nullptr)
+    {
+        startupTimer->markFirstFrame();
+    }
+}
+
 void SFMLRenderer::render(const Game& game)
 {
     if (!window.isOpen())
@@ -97,47 +317,72 @@ void SFMLRenderer::render(const Game& game)
         return;
     }
 
-    // Clear the window
-    window.clear(sf::Color(0, 32, 48));
+    // Lay out through the same snapshot path the render thread uses
+    frameSnapshot.captureGame(game);
+    FrameLayout::layoutGame(frameSnapshot, frameCommands);
+    drawCommands(frameCommands);
+}
 
-    // Update cell size based on the board dimensions
-    const Board& board = game.getBoard();
+void SFMLRenderer::renderInterpolated(const Game& game, float alpha)
+{
+    if (!window.isOpen())
+    {
+        return;
+    }
 
-    // Store the current board dimensions
-    currentBoardWidth = board.getWidth();
-    currentBoardHeight = board.getHeight();
+    frameSnapshot.captureGame(game, alpha);
+    FrameLayout::layoutGame(frameSnapshot, frameCommands);
+    drawCommands(frameCommands);
+}
 
-    cellSize =
-        std::min(static_cast<float>(windowWidth) / board.getWidth(),
-                 static_cast<float>(windowHeight - 60) / board.getHeight() // Leave space for score
-        );
+void SFMLRenderer::renderSpectatorGrid(const std::vector<const Game*>& games)
+{
+    if (!window.isOpen())
+    {
+        return;
+    }
 
-    // Center the board on the screen
-    float boardWidth = cellSize * board.getWidth();
-    float boardHeight = cellSize * board.getHeight();
-    float offsetX = (windowWidth - boardWidth) / 2.0f;
-    float offsetY = (windowHeight - boardHeight - 30) / 2.0f + 30; // Adjust for score text at top
+    if (!prepareFrame())
+    {
+        return;
+    }
 
-    // Draw the background
-    drawBackground();
+    window.clear(sf::Color(0, 0, 0));
+    window.setView(window.getDefaultView());
 
-    // Draw the board (walls)
-    drawBoard(game.getBoard());
+    // All boards go out in a single draw call
+    spectatorGrid.setSize(static_cast<float>(windowWidth), static_cast<float>(windowHeight));
+    spectatorGrid.build(games);
+    window.draw(spectatorGrid.getVertices());
 
-    // Draw the food
-    drawFood(game.getFood());
+    // Label each tile with its score; a label's text is only rebuilt when its score changes
+    if (spectatorLabels.size() != games.size())
+    {
+        spectatorLabels.assign(games.size(), spectatorScoreText);
+        spectatorLabelScores.assign(games.size(), NO_SCORE);
+    }
 
-    // Draw the snake
-    drawSnake(game.getSnake());
+    for (size_t i = 0; i < games.size(); ++i)
+    {
+        if (games[i] == nullptr)
+        {
+            continue;
+        }
 
-    // Draw the score
-    drawScore(game.getScore());
+        sf::Text& label = spectatorLabels[i];
+        const int score = games[i]->getScore();
+        if (spectatorLabelScores[i] != score)
+        {
+            label.setString(std::to_string(score));
+            spectatorLabelScores[i] = score;
+        }
 
-    // Draw game state messages
-    drawGameState(game.isGameOver(), game.isPaused());
+        sf::FloatRect tile = spectatorGrid.getTileRect(i, games.size());
+        label.setPosition(tile.left + 4.0f, tile.top + 2.0f);
+        window.draw(label);
+    }
 
-    // Display everything
-    window.display();
+    displayFrame(RenderCommandBuffer::NO_TICK);
 }
 
 void SFMLRenderer::renderMenu(const std::string& title,
@@ -150,31 +395,237 @@ void SFMLRenderer::renderMenu(const std::string& title,
         return;
     }
 
-    // Clear the window
-    window.clear(sf::Color(0, 32, 48));
+    FrameLayout::layoutMenu(title, items, selectedIndex, instructions, frameCommands);
+    drawCommands(frameCommands);
+}
 
-    // Draw the background
-    drawBackground();
+void SFMLRenderer::renderCommands(const RenderCommandBuffer& commands)
+{
+    if (!window.isOpen())
+    {
+        return;
+    }
 
-    // Draw the menu
-    drawMenu(title, items, selectedIndex, instructions);
+    drawCommands(commands);
+}
 
-    // Display everything
-    window.display();
+void SFMLRenderer::setAtlasPath(const std::string& path)
+{
+    atlasPath = path;
 }
 
 bool SFMLRenderer::isWindowOpen() const
 {
-    return window.isOpen();
+    // A failed load counts as closed even before the event thread gets to close it
+    return window.isOpen() && !resourcesFailed.load(std::memory_order_acquire);
+}
+
+bool SFMLRenderer::startRenderThread(RenderSnapshotBuffer& buffer)
+{
+    if (renderThread.joinable())
+    {
+        return true;
+    }
+
+    if (!window.isOpen())
+    {
+        return false;
+    }
+
+    // An OpenGL context can only be active on one thread at a time
+    window.setActive(false);
+
+    snapshotBuffer = &buffer;
+    renderThreadRunning.store(true, std::memory_order_release);
+    renderThread = std::thread(&SFMLRenderer::renderThreadLoop, this);
+    return true;
+}
+
+void SFMLRenderer::stopRenderThread()
+{
+    if (!renderThread.joinable())
+    {
+        return;
+    }
+
+    renderThreadRunning.store(false, std::memory_order_release);
+    renderThread.join();
+    snapshotBuffer = nullptr;
+
+    // Take the context back for rendering on this thread
+    window.setActive(true);
+}
+
+bool SFMLRenderer::startCapture(const std::string& path,
+                                FrameRecorder::Format format,
+                                int framesPerSecond)
+{
+    if (!window.isOpen())
+    {
+        return false;
+    }
+
+    captureStart = std::chrono::steady_clock::now();
+    captureTime = std::chrono::steady_clock::duration::zero();
+    const sf::Vector2u size = window.getSize();
+    return frameRecorder.start(path, format, static_cast<int>(size.x), static_cast<int>(size.y),
+                               framesPerSecond);
+}
+
+void SFMLRenderer::stopCapture()
+{
+    if (!frameRecorder.isRecording())
+    {
+        return;
+    }
+
+    // Share of the drawing thread's time spent on read-backs, to compare against uncaptured runs
+    const auto elapsed = std::chrono::steady_clock::now() - captureStart;
+    const double captureShare =
+        elapsed.count() > 0 ? std::round(1000.0 * captureTime.count() / elapsed.count()) / 10.0
+                          : 0.0;
+
+    frameRecorder.stop();
+    std::cout << "Recorded " << frameRecorder.getEncodedFrameCount() << " frames ("
+              << frameRecorder.getDroppedFrameCount() << " dropped, read-back took "
+              << captureShare << "% of the drawing thread)" << std::endl;
+}
+
+const FrameRecorder& SFMLRenderer::getFrameRecorder() const
+{
+    return frameRecorder;
+}
+
+void SFMLRenderer::displayFrame(uint64_t frameTick)
+{
+    if (frameRecorder.isFrameDue())
+    {
+        const auto readBegin = std::chrono::steady_clock::now();
+        const sf::Vector2u size = window.getSize();
+        const bool sizeMatches = static_cast<int>(size.x) == frameRecorder.getWidth() &&
+                                 static_cast<int>(size.y) == frameRecorder.getHeight();
+
+        // A recording keeps its size; frames of a resized window can't go into it
+        if (!sizeMatches)
+        {
+            frameRecorder.dropFrame();
+        }
+
+        // Read the back buffer straight into a pooled buffer before it is swapped out
+        uint8_t* frame = sizeMatches ? frameRecorder.acquireFrame() : nullptr;
+        if (frame != nullptr)
+        {
+            glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, frame);
+            frameRecorder.submitFrame(frame, true); // OpenGL rows start at the bottom
+        }
+        captureTime += std::chrono::steady_clock::now() - readBegin;
+    }
+
+    window.display();
+
+    // Frames without a game, e.g. menus, show no turn
+    if (latencyTracker != nullptr && frameTick != RenderCommandBuffer::NO_TICK)
+    {
+        latencyTracker->markPresented(frameTick);
+    }
+}
+
+void SFMLRenderer::renderThreadLoop()
+{
+    window.setActive(true);
+
+    while (renderThreadRunning.load(std::memory_order_acquire))
+    {
+        // Only redraw when the simulation published something new
+        if (!snapshotBuffer->update())
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+            continue;
+        }
+
+        drawSnapshot(snapshotBuffer->getReadBuffer());
+    }
+
+    window.setActive(false);
+}
+
+void SFMLRenderer::drawSnapshot(const RenderSnapshot& snapshot)
+{
+    switch (snapshot.kind)
+    {
+    case RenderSnapshot::Kind::GAME:
+    case RenderSnapshot::Kind::MENU:
+        FrameLayout::layoutSnapshot(snapshot, frameCommands);
+        drawCommands(frameCommands);
+        break;
+    case RenderSnapshot::Kind::COMMANDS:
+        // Already laid out by the simulation thread
+        drawCommands(snapshot.commands);
+        break;
+    default:
+        break;
+    }
+}
+
+void SFMLRenderer::drawCommands(const RenderCommandBuffer& commands)
+{
+    if (!prepareFrame())
+    {
+        return;
+    }
+
+    // Clear the window
+    window.clear(BACKGROUND_COLOR);
+
+    // Draw the background
+    drawBackground();
+
+    if (commands.hasBoard() && commands.getBoardWidth() > 0 && commands.getBoardHeight() > 0)
+    {
+        // Store the current board dimensions
+        currentBoardWidth = commands.getBoardWidth();
+        currentBoardHeight = commands.getBoardHeight();
+
+        // Choose cell size, view and visible cell range for this frame
+        updateCamera(commands);
+
+        // Board-space commands are drawn through the camera
+        drawBoardCommands(commands);
+
+        // Overlays are drawn in window coordinates
+        window.setView(window.getDefaultView());
+        if (followingHead && minimapEnabled)
+        {
+            drawMinimap(commands);
+        }
+    }
+
+    // Text last so it stays on top of the board
+    for (const RenderCommand& command : commands.getCommands())
+    {
+        if (command.type == RenderCommand::Type::TEXT)
+        {
+            drawText(commands, command);
+        }
+    }
+
+    // Display everything
+    displayFrame(commands.getTick());
 }
 
 bool SFMLRenderer::handleEvents(Game& game)
 {
+    if (closeIfResourcesFailed())
+    {
+        return false;
+    }
+
     sf::Event event;
     while (window.pollEvent(event))
     {
         if (event.type == sf::Event::Closed)
         {
+            stopRenderThread();
             window.close();
             return false;
         }
@@ -185,6 +636,7 @@ bool SFMLRenderer::handleEvents(Game& game)
             switch (event.key.code)
             {
             case sf::Keyboard::Escape:
+                stopRenderThread();
                 window.close();
                 return false;
 
@@ -246,11 +698,18 @@ bool SFMLRenderer::handleEvents(Input& input)
     // Default to no input
     input = Input::NONE;
 
+    if (closeIfResourcesFailed())
+    {
+        input = Input::QUIT;
+        return false;
+    }
+
     sf::Event event;
     while (window.pollEvent(event))
     {
         if (event.type == sf::Event::Closed)
         {
+            stopRenderThread();
             window.close();
             input = Input::QUIT;
             return false;
@@ -271,6 +730,35 @@ bool SFMLRenderer::handleEvents(Input& input)
     return true;
 }
 
+bool SFMLRenderer::handleEvents(InputBatch& inputs)
+{
+    if (closeIfResourcesFailed())
+    {
+        inputs.add(Input::QUIT);
+        return false;
+    }
+
+    sf::Event event;
+    while (window.pollEvent(event))
+    {
+        if (event.type == sf::Event::Closed)
+        {
+            stopRenderThread();
+            window.close();
+            inputs.add(Input::QUIT);
+            return false;
+        }
+
+        const Input input = convertSFMLEvent(event);
+        if (input != Input::NONE)
+        {
+            inputs.add(input, InputClock::now());
+        }
+    }
+
+    return true;
+}
+
 Input SFMLRenderer::convertSFMLEvent(const sf::Event& event)
 {
     if (event.type != sf::Event::KeyPressed)
@@ -326,6 +814,15 @@ float SFMLRenderer::getCellSize() const
 
 sf::Vector2f SFMLRenderer::gameToScreenPosition(const Position& position) const
 {
+    if (followingHead)
+    {
+        // Board pixel position relative to the top-left corner of the camera view
+        const sf::Vector2f viewOrigin(cameraView.getCenter().x - cameraView.getSize().x / 2.0f,
+                                      cameraView.getCenter().y - cameraView.getSize().y / 2.0f);
+        return sf::Vector2f(position.x * cellSize - viewOrigin.x,
+                            position.y * cellSize - viewOrigin.y + 30); // Space for score
+    }
+
     // Calculate the top-left corner of the game board
     const float offsetX = (windowWidth - cellSize * currentBoardWidth) / 2.0f;
     const float offsetY =
@@ -334,223 +831,283 @@ sf::Vector2f SFMLRenderer::gameToScreenPosition(const Position& position) const
     return sf::Vector2f(offsetX + position.x * cellSize, offsetY + position.y * cellSize);
 }
 
-void SFMLRenderer::drawBoard(const Board& board)
+void SFMLRenderer::setCameraMode(CameraMode mode)
 {
-    sf::RectangleShape cellShape(sf::Vector2f(cellSize, cellSize));
-    sf::RectangleShape borderShape(sf::Vector2f(cellSize, cellSize));
-    borderShape.setFillColor(sf::Color(100, 100, 100));
-
-    // Calculate board offset to center it
-    float offsetX = (windowWidth - cellSize * board.getWidth()) / 2.0f;
-    float offsetY = (windowHeight - cellSize * board.getHeight() - 30) / 2.0f + 30;
-
-    // Draw the grid and walls
-    for (int y = 0; y < board.getHeight(); ++y)
-    {
-        for (int x = 0; x < board.getWidth(); ++x)
-        {
-            Position pos(x, y);
-
-            if (x == 0 || y == 0 || x == board.getWidth() - 1 || y == board.getHeight() - 1)
-            {
-                // Draw wall/border
-                borderShape.setPosition(offsetX + x * cellSize, offsetY + y * cellSize);
-                window.draw(borderShape);
-            }
-        }
-    }
+    cameraMode = mode;
 }
 
-void SFMLRenderer::drawSnake(const Snake& snake)
+SFMLRenderer::CameraMode SFMLRenderer::getCameraMode() const
 {
-    // Get the snake body segments
-    const std::vector<Position>& body = snake.getBody();
-    if (body.empty())
-        return;
-
-    // Calculate board offset to center it
-    float offsetX = (windowWidth - cellSize * currentBoardWidth) / 2.0f;
-    float offsetY = (windowHeight - cellSize * currentBoardHeight - 30) / 2.0f + 30;
-
-    // Draw the head
-    sf::CircleShape headShape(cellSize / 2.f);
-    headShape.setFillColor(sf::Color::Green);
-    headShape.setPosition(offsetX + body[0].x * cellSize, offsetY + body[0].y * cellSize);
-    window.draw(headShape);
-
-    // Draw the body segments
-    sf::RectangleShape bodyShape(sf::Vector2f(cellSize * 0.9f, cellSize * 0.9f));
-    bodyShape.setFillColor(sf::Color(0, 180, 0));
-
-    for (size_t i = 1; i < body.size(); ++i)
-    {
-        bodyShape.setPosition(offsetX + body[i].x * cellSize + cellSize * 0.05f,
-                              offsetY + body[i].y * cellSize + cellSize * 0.05f);
-        window.draw(bodyShape);
-    }
+    return cameraMode;
 }
 
-void SFMLRenderer::drawFood(const Food& food)
+void SFMLRenderer::setFollowCellSize(float size)
 {
-    // Calculate board offset to center it
-    float offsetX = (windowWidth - cellSize * currentBoardWidth) / 2.0f;
-    float offsetY = (windowHeight - cellSize * currentBoardHeight - 30) / 2.0f + 30;
-
-    // Draw the food
-    sf::CircleShape foodShape(cellSize / 2.5f);
-    foodShape.setFillColor(sf::Color::Red);
-    foodShape.setPosition(offsetX + food.getPosition().x * cellSize + cellSize / 4.f,
-                          offsetY + food.getPosition().y * cellSize + cellSize / 4.f);
-    window.draw(foodShape);
+    followCellSize = std::max(size, 1.0f);
 }
 
-void SFMLRenderer::drawScore(int score)
+void SFMLRenderer::setMinimapEnabled(bool enabled)
 {
-    scoreText.setString("Score: " + std::to_string(score));
-    window.draw(scoreText);
+    minimapEnabled = enabled;
 }
 
-void SFMLRenderer::drawGameState(bool gameOver, bool paused)
+sf::IntRect SFMLRenderer::getVisibleCells() const
 {
-    if (gameOver)
-    {
-        // Position game over text in the center
-        sf::FloatRect textBounds = gameOverText.getLocalBounds();
-        gameOverText.setPosition((windowWidth - textBounds.width) / 2.f,
-                                 (windowHeight - textBounds.height) / 2.f - 50.f);
-        window.draw(gameOverText);
-    }
-    else if (paused)
-    {
-        // Position paused text in the center
-        sf::FloatRect textBounds = pausedText.getLocalBounds();
-        pausedText.setPosition((windowWidth - textBounds.width) / 2.f,
-                               (windowHeight - textBounds.height) / 2.f - 50.f);
-        window.draw(pausedText);
-    }
+    return visibleCells;
 }
 
-void SFMLRenderer::drawBackground()
+sf::IntRect SFMLRenderer::computeVisibleCells(const sf::View& view,
+                                              float cellSize,
+                                              int boardWidth,
+                                              int boardHeight)
 {
-    sf::RectangleShape background(sf::Vector2f(windowWidth, windowHeight));
-    background.setFillColor(sf::Color(0, 32, 48));
-    window.draw(background);
+    const float left = view.getCenter().x - view.getSize().x / 2.0f;
+    const float top = view.getCenter().y - view.getSize().y / 2.0f;
+
+    // Include partially visible cells on every edge
+    const int minX = std::max(0, static_cast<int>(std::floor(left / cellSize)));
+    const int minY = std::max(0, static_cast<int>(std::floor(top / cellSize)));
+    const int maxX = std::min(boardWidth - 1,
+                              static_cast<int>(std::floor((left + view.getSize().x) / cellSize)));
+    const int maxY = std::min(boardHeight - 1,
+                              static_cast<int>(std::floor((top + view.getSize().y) / cellSize)));
+
+    return sf::IntRect(minX, minY, std::max(0, maxX - minX + 1), std::max(0, maxY - minY + 1));
 }
 
-void SFMLRenderer::createDefaultTextures()
+void SFMLRenderer::updateCamera(const RenderCommandBuffer& commands)
 {
-    // Create default colored textures when we can't load from files
+    const int boardWidth = commands.getBoardWidth();
+    const int boardHeight = commands.getBoardHeight();
+
+    // Area below the score line available to the board
+    const sf::Vector2f viewSize(static_cast<float>(windowWidth),
+                                static_cast<float>(windowHeight - 30));
+
+    // Update cell size based on the board dimensions, leaving space for the score
+    const float fitCellSize = std::min(static_cast<float>(windowWidth) / boardWidth,
+                                       static_cast<float>(windowHeight - 60) / boardHeight);
+
+    // Follow the head in AUTO mode once fitted cells get too small to read
+    const float minReadableCellSize = 12.0f;
+    followingHead = cameraMode == CameraMode::FOLLOW_HEAD ||
+                    (cameraMode == CameraMode::AUTO && fitCellSize < minReadableCellSize);
 
-    // Snake head (green circle)
-    sf::Image headImage;
-    headImage.create(32, 32, sf::Color::Transparent);
-    for (unsigned int y = 0; y < 32; ++y)
+    if (!followingHead)
     {
-        for (unsigned int x = 0; x < 32; ++x)
-        {
-            int dx = x - 16;
-            int dy = y - 16;
-            if (dx * dx + dy * dy < 16 * 16)
-            {
-                headImage.setPixel(x, y, sf::Color::Green);
-            }
-        }
+        cellSize = fitCellSize;
+        boardOffset = sf::Vector2f((windowWidth - cellSize * boardWidth) / 2.0f,
+                                   (windowHeight - cellSize * boardHeight - 30) / 2.0f + 30);
+        visibleCells = sf::IntRect(0, 0, boardWidth, boardHeight);
+        window.setView(window.getDefaultView());
+        return;
     }
-    snakeHeadTexture.loadFromImage(headImage);
 
-    // Snake body (green square)
-    sf::Image bodyImage;
-    bodyImage.create(32, 32, sf::Color(0, 180, 0));
-    snakeBodyTexture.loadFromImage(bodyImage);
+    cellSize = followCellSize;
+    boardOffset = sf::Vector2f(0.0f, 0.0f);
 
-    // Food (red circle)
-    sf::Image foodImage;
-    foodImage.create(32, 32, sf::Color::Transparent);
-    for (unsigned int y = 0; y < 32; ++y)
-    {
-        for (unsigned int x = 0; x < 32; ++x)
+    // The layout's focus is the interpolated head, so the camera scrolls as smoothly
+    // as the snake moves
+    const sf::Vector2f focus(commands.getFocusX() * cellSize, commands.getFocusY() * cellSize);
+
+    // Keep the view inside the board, or centred on it along axes where it fits
+    const sf::Vector2f boardSize(cellSize * boardWidth, cellSize * boardHeight);
+    auto clampAxis = [](float center, float view, float board) {
+        if (board <= view)
         {
-            int dx = x - 16;
-            int dy = y - 16;
-            if (dx * dx + dy * dy < 12 * 12)
-            {
-                foodImage.setPixel(x, y, sf::Color::Red);
-            }
+            return board / 2.0f;
         }
-    }
-    foodTexture.loadFromImage(foodImage);
+        return std::clamp(center, view / 2.0f, board - view / 2.0f);
+    };
 
-    // Wall (gray square)
-    sf::Image wallImage;
-    wallImage.create(32, 32, sf::Color(100, 100, 100));
-    wallTexture.loadFromImage(wallImage);
+    cameraView.setSize(viewSize);
+    cameraView.setCenter(clampAxis(focus.x, viewSize.x, boardSize.x),
+                         clampAxis(focus.y, viewSize.y, boardSize.y));
+    cameraView.setViewport(
+        sf::FloatRect(0.0f, 30.0f / windowHeight, 1.0f, viewSize.y / windowHeight));
+    window.setView(cameraView);
 
-    // Background (dark blue)
-    sf::Image backgroundImage;
-    backgroundImage.create(32, 32, sf::Color(0, 32, 48));
-    backgroundTexture.loadFromImage(backgroundImage);
+    visibleCells = computeVisibleCells(cameraView, cellSize, boardWidth, boardHeight);
 }
 
-void SFMLRenderer::drawMenu(const std::string& title,
-                            const std::vector<std::string>& items,
-                            size_t selectedIndex,
-                            const std::string& instructions)
+void SFMLRenderer::drawBoardCommands(const RenderCommandBuffer& commands)
 {
-    const float padding = 20.0f;
-    const float itemHeight = 40.0f;
-    const float startY = 150.0f;
+    // Every board sprite samples the atlas, so the whole board is one draw call
+    spriteBatch.build(commands, spriteAtlas, boardOffset, cellSize, visibleCells);
+    window.draw(spriteBatch.getVertices(), &spriteAtlas.getTexture());
 
-    // Draw title
-    menuTitleText.setString(sf::String::fromUtf8(title.begin(), title.end()));
-    menuTitleText.setPosition((windowWidth - menuTitleText.getLocalBounds().width) / 2.0f, 50.0f);
-    window.draw(menuTitleText);
+    drawParticles(commands);
+}
 
-    // Draw menu items
-    for (size_t i = 0; i < items.size(); ++i)
+void SFMLRenderer::drawParticles(const RenderCommandBuffer& commands)
+{
+    // Reuse the array's storage from the previous frame
+    particleVertices.clear();
+
+    const float left = static_cast<float>(visibleCells.left - 1);
+    const float top = static_cast<float>(visibleCells.top - 1);
+    const float right = static_cast<float>(visibleCells.left + visibleCells.width + 1);
+    const float bottom = static_cast<float>(visibleCells.top + visibleCells.height + 1);
+    for (const RenderCommand& command : commands.getCommands())
     {
-        // Highlight selected item
-        if (i == selectedIndex)
+        if (command.type != RenderCommand::Type::PARTICLE || command.x < left ||
+            command.x > right || command.y < top || command.y > bottom)
         {
-            menuItemText.setFillColor(sf::Color::Yellow);
-
-            // Draw selection indicator (arrow)
-            sf::String itemText = sf::String::fromUtf8(items[i].begin(), items[i].end());
-            menuItemText.setString("> " + itemText);
+            continue;
         }
-        else
+
+        const float half = command.width * cellSize / 2.0f;
+        const float x = boardOffset.x + command.x * cellSize;
+        const float y = boardOffset.y + command.y * cellSize;
+        const sf::Color color = toColor(command.color);
+        particleVertices.append(sf::Vertex(sf::Vector2f(x - half, y - half), color));
+        particleVertices.append(sf::Vertex(sf::Vector2f(x + half, y - half), color));
+        particleVertices.append(sf::Vertex(sf::Vector2f(x + half, y + half), color));
+        particleVertices.append(sf::Vertex(sf::Vector2f(x - half, y + half), color));
+    }
+
+    if (particleVertices.getVertexCount() > 0)
+    {
+        window.draw(particleVertices);
+    }
+}
+
+void SFMLRenderer::drawMinimap(const RenderCommandBuffer& commands)
+{
+    const int boardWidth = commands.getBoardWidth();
+    const int boardHeight = commands.getBoardHeight();
+
+    // Scale the whole board into a small box in the top-right corner
+    const float maxSize = 150.0f;
+    const float margin = 10.0f;
+    const float scale = maxSize / std::max(boardWidth, boardHeight);
+    const sf::Vector2f origin(windowWidth - margin - scale * boardWidth, 30.0f + margin);
+    const float dot = std::max(scale, 1.0f);
+
+    // Everything goes into one quad array, so the minimap costs a single draw call
+    minimapVertices.clear();
+    auto addQuad = [this](float x, float y, float w, float h, const sf::Color& color) {
+        minimapVertices.append(sf::Vertex(sf::Vector2f(x, y), color));
+        minimapVertices.append(sf::Vertex(sf::Vector2f(x + w, y), color));
+        minimapVertices.append(sf::Vertex(sf::Vector2f(x + w, y + h), color));
+        minimapVertices.append(sf::Vertex(sf::Vector2f(x, y + h), color));
+    };
+
+    // Board background
+    addQuad(origin.x,
+            origin.y,
+            scale * boardWidth,
+            scale * boardHeight,
+            sf::Color(100, 100, 100, 200));
+    addQuad(origin.x + scale,
+            origin.y + scale,
+            scale * (boardWidth - 2),
+            scale * (boardHeight - 2),
+            sf::Color(0, 32, 48, 200));
+
+    // Snake and food as one dot per cell; the walls are part of the background
+    for (const RenderCommand& command : commands.getCommands())
+    {
+        if (command.type != RenderCommand::Type::SPRITE &&
+            command.type != RenderCommand::Type::CIRCLE)
         {
-            menuItemText.setFillColor(sf::Color::White);
-            sf::String itemText = sf::String::fromUtf8(items[i].begin(), items[i].end());
-            menuItemText.setString("  " + itemText);
+            continue;
         }
 
-        // Center horizontally, position vertically
-        menuItemText.setPosition((windowWidth - menuItemText.getLocalBounds().width) / 2.0f,
-                                 startY + i * itemHeight);
-
-        window.draw(menuItemText);
+        addQuad(origin.x + std::floor(command.x) * scale,
+                origin.y + std::floor(command.y) * scale,
+                dot,
+                dot,
+                toColor(command.color));
     }
 
-    // Draw instructions if provided
-    if (!instructions.empty())
+    // Outline of the area currently shown by the camera
+    const sf::Color frameColor(255, 255, 255, 160);
+    const float left = origin.x + visibleCells.left * scale;
+    const float top = origin.y + visibleCells.top * scale;
+    const float width = visibleCells.width * scale;
+    const float height = visibleCells.height * scale;
+    addQuad(left, top, width, 1.0f, frameColor);
+    addQuad(left, top + height - 1.0f, width, 1.0f, frameColor);
+    addQuad(left, top, 1.0f, height, frameColor);
+    addQuad(left + width - 1.0f, top, 1.0f, height, frameColor);
+
+    window.draw(minimapVertices);
+}
+
+void SFMLRenderer::drawText(const RenderCommandBuffer& commands, const RenderCommand& command)
+{
+    // Each style keeps its own sf::Text so font sizes are set up only once
+    const sf::Text* style = &menuItemText;
+    switch (static_cast<TextStyle>(command.style))
     {
-        sf::Text instructionsText;
-        instructionsText.setFont(font);
-        instructionsText.setCharacterSize(16);
-        instructionsText.setFillColor(sf::Color(150, 150, 150)); // Light gray
+    case TextStyle::HUD:
+        style = &scoreText;
+        break;
+    case TextStyle::BANNER:
+        style = &bannerText;
+        break;
+    case TextStyle::TITLE:
+        style = &menuTitleText;
+        break;
+    case TextStyle::ITEM:
+    case TextStyle::SELECTED_ITEM:
+        style = &menuItemText;
+        break;
+    case TextStyle::HINT:
+        style = &hintText;
+        break;
+    }
 
+    // Menus send the same strings in the same slots every frame; only changed ones are
+    // converted and reshaped
+    if (textSlots.size() <= command.textId)
+    {
+        textSlots.resize(command.textId + 1);
+    }
+    TextSlot& slot = textSlots[command.textId];
+    const std::string& string = commands.getText(command);
+    if (slot.style != command.style)
+    {
+        slot.text = *style;
+        slot.style = command.style;
+        slot.source.clear();
+        slot.text.setString(sf::String());
+    }
+    if (slot.source != string)
+    {
         // Convert UTF-8 string to sf::String for proper Unicode display
-        sf::String utf8Instructions =
-            sf::String::fromUtf8(instructions.begin(), instructions.end());
-        instructionsText.setString(utf8Instructions);
+        slot.source.assign(string);
+        slot.text.setString(sf::String::fromUtf8(string.begin(), string.end()));
+    }
 
-        // Position at bottom of menu items with some spacing
-        float instructionsY = startY + items.size() * itemHeight + 40.0f;
-        instructionsText.setPosition((windowWidth - instructionsText.getLocalBounds().width) / 2.0f,
-                                     instructionsY);
+    sf::Text* text = &slot.text;
+    text->setFillColor(toColor(command.color));
 
-        window.draw(instructionsText);
+    const sf::FloatRect bounds = text->getLocalBounds();
+    const float lineOffset = command.y * TEXT_LINE_HEIGHT;
+    switch (static_cast<TextAnchor>(command.anchor))
+    {
+    case TextAnchor::TOP_LEFT:
+        text->setPosition(10.0f, 10.0f + lineOffset);
+        break;
+    case TextAnchor::TOP_CENTER:
+        text->setPosition((windowWidth - bounds.width) / 2.0f, 50.0f + lineOffset);
+        break;
+    case TextAnchor::CENTER:
+        text->setPosition((windowWidth - bounds.width) / 2.0f,
+                          (windowHeight - bounds.height) / 2.0f - 50.0f + lineOffset);
+        break;
     }
+
+    window.draw(*text);
+}
+
+void SFMLRenderer::drawBackground()
+{
+    sf::RectangleShape background(sf::Vector2f(windowWidth, windowHeight));
+    background.setFillColor(BACKGROUND_COLOR);
+    window.draw(background);
 }
 
 } // namespace GreedySnake
\ No newline at end of file
@@ -1,9 +1,19 @@
 #pragma once
 
+#include "game/LatencyTracker.h"
+#include "game/StartupTimer.h"
+#include "renderer/FrameRecorder.h"
 #include "renderer/Renderer.h"
+#include "renderer/SpectatorGrid.h"
+#include "renderer/SpriteAtlas.h"
+#include "renderer/SpriteBatch.h"
 #include <SFML/Graphics.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
 #include <map>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace GreedySnake
@@ -15,6 +25,16 @@ namespace GreedySnake
 class SFMLRenderer : public Renderer
 {
   public:
+    /**
+     * @brief How the board is mapped onto the window
+     */
+    enum class CameraMode
+    {
+        FIT_BOARD,   // Shrink cells so the whole board fits into the window
+        FOLLOW_HEAD, // Keep a fixed cell size and scroll a view that follows the head
+        AUTO         // Follow the head only when fitting would make cells unreadably small
+    };
+
     /**
      * @brief Constructor for the SFML renderer
      * @param width Window width in pixels
@@ -29,8 +49,12 @@ class SFMLRenderer : public Renderer
     ~SFMLRenderer() override;
 
     /**
-     * @brief Initialize the SFML renderer
-     * @return True if initialization was successful
+     * @brief Open the window, show a first frame and start loading resources
+     *
+     * Fonts and sprites are read on a loader thread; frames drawn before they
+     * are ready show only the background.
+     *
+     * @return True if the window was created
      */
     bool initialize() override;
 
@@ -45,6 +69,19 @@ class SFMLRenderer : public Renderer
      */
     void render(const Game& game) override;
 
+    /**
+     * @brief Render the game with the snake ends interpolated between ticks
+     * @param game Reference to the game state to render
+     * @param alpha Progress from the previous tick (0) to the current tick (1)
+     */
+    void renderInterpolated(const Game& game, float alpha) override;
+
+    /**
+     * @brief Render many games in a tiled grid with one batched draw for all boards
+     * @param games Games to show, one tile each; null entries leave their tile empty
+     */
+    void renderSpectatorGrid(const std::vector<const Game*>& games) override;
+
     /**
      * @brief Render a menu with title and items
      * @param title The title to display
@@ -57,6 +94,12 @@ class SFMLRenderer : public Renderer
                     size_t selectedIndex,
                     const std::string& instructions = "") override;
 
+    /**
+     * @brief Draw a laid-out frame through the camera and display it
+     * @param commands Commands describing the frame
+     */
+    void renderCommands(const RenderCommandBuffer& commands) override;
+
     /**
      * @brief Check if the SFML window is still open
      * @return True if the window is open
@@ -78,11 +121,100 @@ class SFMLRenderer : public Renderer
     bool handleEvents(Input& input) override;
 
     /**
-     * @brief Load textures and other resources
+     * @brief Drain all pending SFML window events into a batch of inputs
+     *
+     * Each input is stamped with the time its event was polled.
+     *
+     * @param inputs Batch to append the inputs to
+     * @return True if the game should continue running
+     */
+    bool handleEvents(InputBatch& inputs) override;
+
+    /**
+     * @brief Draw snapshots from a buffer on a dedicated render thread
+     *
+     * The OpenGL context is handed over to the new thread; event polling keeps
+     * running on the thread that created the window, as SFML requires.
+     *
+     * @param buffer Triple buffer the simulation publishes snapshots into
+     * @return True if the render thread is running
+     */
+    bool startRenderThread(RenderSnapshotBuffer& buffer) override;
+
+    /**
+     * @brief Stop the render thread and take the OpenGL context back
+     */
+    void stopRenderThread() override;
+
+    /**
+     * @brief Start recording displayed frames
+     *
+     * Frames are read back into a pool of buffers and encoded on a background
+     * thread; when the encoder falls behind, frames are dropped and counted
+     * instead of stalling rendering.
+     *
+     * @param path Output file (Y4M) or file name prefix (PNG sequence)
+     * @param format Output format
+     * @param framesPerSecond Capture rate
+     * @return True if recording started
+     */
+    bool startCapture(const std::string& path,
+                      FrameRecorder::Format format,
+                      int framesPerSecond = 30);
+
+    /**
+     * @brief Stop recording, finishing the frames already captured
+     */
+    void stopCapture();
+
+    /**
+     * @brief Get the frame recorder (for capture statistics)
+     * @return Reference to the frame recorder
+     */
+    const FrameRecorder& getFrameRecorder() const;
+
+    /**
+     * @brief Load textures and other resources, waiting for them if needed
      * @return True if resources were loaded successfully
      */
     bool loadResources();
 
+    /**
+     * @brief Check whether fonts and sprites are ready for drawing
+     * @return True once the loaded resources were applied
+     */
+    [[nodiscard]] bool areResourcesLoaded() const;
+
+    /**
+     * @brief Report startup phases and the first frame to a timer
+     *
+     * Must be called before initialize(). The timer must outlive the renderer's
+     * startup.
+     *
+     * @param timer Startup timer, or nullptr to stop reporting
+     */
+    void setStartupTimer(StartupTimer* timer);
+
+    /**
+     * @brief Report every presented frame to a latency tracker
+     *
+     * Called from whichever thread draws, right after window.display().
+     *
+     * @param tracker Latency tracker, or nullptr to stop reporting
+     */
+    void setLatencyTracker(LatencyTracker* tracker);
+
+    /**
+     * @brief Use a themed sprite atlas instead of the generated sprites
+     *
+     * Takes effect when resources are loaded. The image must hold the tiles
+     * in SpriteId order in one row (see SpriteAtlas); if it can't be used the
+     * default sprites are kept.
+     *
+     * @param path Atlas image file
+     */
+    void setAtlasPath(const std::string& path);
+
     /**
      * @brief Get the window title
      * @return Window title
@@ -114,7 +246,59 @@ class SFMLRenderer : public Renderer
      */
     sf::Vector2f gameToScreenPosition(const Position& position) const;
 
+    /**
+     * @brief Set how the board is mapped onto the window
+     * @param mode Camera mode to use from the next frame on
+     */
+    void setCameraMode(CameraMode mode);
+
+    /**
+     * @brief Get the configured camera mode
+     * @return Camera mode
+     */
+    CameraMode getCameraMode() const;
+
+    /**
+     * @brief Set the fixed cell size used while following the head
+     * @param size Cell size in pixels (values below 1 are clamped to 1)
+     */
+    void setFollowCellSize(float size);
+
+    /**
+     * @brief Enable or disable the minimap overlay shown while following the head
+     * @param enabled True to draw the minimap
+     */
+    void setMinimapEnabled(bool enabled);
+
+    /**
+     * @brief Get the board cells covered by the last drawn frame
+     * @return Visible cell range (left/top cell and width/height in cells)
+     */
+    sf::IntRect getVisibleCells() const;
+
+    /**
+     * @brief Compute which board cells a view covers
+     * @param view View in board pixel coordinates (cell (0, 0) starts at the origin)
+     * @param cellSize Cell size in pixels
+     * @param boardWidth Board width in cells
+     * @param boardHeight Board height in cells
+     * @return Covered cell range clamped to the board (left/top cell and width/height in cells)
+     */
+    static sf::IntRect computeVisibleCells(const sf::View& view,
+                                           float cellSize,
+                                           int boardWidth,
+                                           int boardHeight);
+
   private:
+    /**
+     * @brief Resource data read on the loader thread, ready for upload
+     */
+    struct LoadedResources
+    {
+        std::vector<char> fontData;
+        sf::Image atlasImage;
+    };
+
     sf::RenderWindow window;
     std::string windowTitle;
     int windowWidth;
@@ -123,34 +307,105 @@ class SFMLRenderer : public Renderer
     int currentBoardWidth;  // Track current board width
     int currentBoardHeight; // Track current board height
 
-    // Game textures and sprites
-    sf::Texture snakeHeadTexture;
-    sf::Texture snakeBodyTexture;
-    sf::Texture foodTexture;
-    sf::Texture wallTexture;
-    sf::Texture backgroundTexture;
+    // Camera state
+    CameraMode cameraMode;
+    bool followingHead;       // Whether the last frame used the follow camera
+    float followCellSize;     // Cell size in pixels while following the head
+    bool minimapEnabled;      // Draw the full-board minimap while following
+    sf::Vector2f boardOffset; // Pixel position of cell (0, 0) in the active view
+    sf::View cameraView;      // View used while following the head
+    sf::IntRect visibleCells; // Cells that intersect the visible area
+    sf::VertexArray minimapVertices;
+
+    // Tiled multi-game view
+    SpectatorGrid spectatorGrid;
+    sf::Text spectatorScoreText;            // Style every tile label is copied from
+    std::vector<sf::Text> spectatorLabels;  // One score label per tile
+    std::vector<int> spectatorLabelScores;  // Score each label currently shows
+
+    // Game sprites, drawn as one batch from a single texture
+    std::string atlasPath;
+    SpriteAtlas spriteAtlas;
+    SpriteBatch spriteBatch;
+    sf::VertexArray particleVertices; // All particles, drawn untextured in one call
+
+    // Startup loading; sf::Font reads glyphs from fontData for as long as it is used
+    StartupTimer* startupTimer;
+    LatencyTracker* latencyTracker;
+    std::future<LoadedResources> pendingResources;
+    bool resourcesLoaded;
+    // Set by the drawing thread when loading failed; the event thread closes the window
+    std::atomic<bool> resourcesFailed;
+    std::vector<char> fontData;
 
     sf::Font font;
     sf::Text scoreText;
-    sf::Text gameOverText;
-    sf::Text pausedText;
+    sf::Text bannerText;
     sf::Text menuTitleText;
     sf::Text menuItemText;
+    sf::Text hintText;
+
+    // Text drawn for one text slot of a command buffer, reshaped only when its string changes
+    struct TextSlot
+    {
+        sf::Text text;
+        std::string source; // UTF-8 string the text was built from
+        uint8_t style = NO_TEXT_STYLE;
+    };
+    static constexpr uint8_t NO_TEXT_STYLE = 0xFF;
+    std::vector<TextSlot> textSlots; // Indexed by RenderCommand::textId
+
+    // Snapshot and commands reused by render() so every path shares one layout
+    RenderSnapshot frameSnapshot;
+    RenderCommandBuffer frameCommands;
+
+    // Render thread state
+    RenderSnapshotBuffer* snapshotBuffer;
+    std::thread renderThread;
+    std::atomic<bool> renderThreadRunning;
+
+    // Frame capture
+    FrameRecorder frameRecorder;
+    std::chrono::steady_clock::time_point captureStart;
+    std::chrono::steady_clock::duration captureTime; // Spent reading back frames
+
+    // Render thread entry point: draws each newly published snapshot
+    void renderThreadLoop();
+
+    // Draw a full frame from a snapshot and display it
+    void drawSnapshot(const RenderSnapshot& snapshot);
+
+    // Draw a laid-out frame and display it
+    void drawCommands(const RenderCommandBuffer& commands);
+
+    // Read fonts and decode sprites without touching OpenGL (loader thread)
+    static LoadedResources readResources(const std::string& atlasPath, StartupTimer* timer);
+
+    // Start reading resources on the loader thread
+    void startLoadingResources();
+
+    // Apply the loaded resources if they are ready (or wait for them); false if not applied
+    bool finishLoadingResources(bool wait);
+
+    // Make sure resources are usable before drawing; shows the loading frame otherwise
+    bool prepareFrame();
+
+    // Close the window if loading failed; must run on the thread that polls events
+    bool closeIfResourcesFailed();
+
+    // Background-only frame shown while resources load
+    void drawLoadingFrame();
 
     // Drawing helper methods
-    void drawBoard(const Board& board);
-    void drawSnake(const Snake& snake);
-    void drawFood(const Food& food);
-    void drawScore(int score);
-    void drawGameState(bool gameOver, bool paused);
+    void updateCamera(const RenderCommandBuffer& commands);
+    void drawBoardCommands(const RenderCommandBuffer& commands);
+    void drawParticles(const RenderCommandBuffer& commands);
+    void drawMinimap(const RenderCommandBuffer& commands);
+    void drawText(const RenderCommandBuffer& commands, const RenderCommand& command);
     void drawBackground();
-    void drawMenu(const std::string& title,
-                  const std::vector<std::string>& items,
-                  size_t selectedIndex,
-                  const std::string& instructions = "");
 
-    // Create default textures when actual textures can't be loaded
-    void createDefaultTextures();
+    // Capture the frame if recording, then show it; frameTick is the game tick it shows
+    void displayFrame(uint64_t frameTick);
 
     // Convert SFML events to our Input enum
     Input convertSFMLEvent(const sf::Event& event);
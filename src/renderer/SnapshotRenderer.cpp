@@ -0,0 +1,65 @@
+#include "renderer/SnapshotRenderer.h"
+
+namespace GreedySnake
+{
+
+SnapshotRenderer::SnapshotRenderer(RenderSnapshotBuffer& buffer) : buffer(buffer)
+{
+}
+
+bool SnapshotRenderer::initialize()
+{
+    return true;
+}
+
+void SnapshotRenderer::shutdown()
+{
+    // Nothing to release; the buffer is owned by the caller
+}
+
+void SnapshotRenderer::render(const Game& game)
+{
+    buffer.getWriteBuffer().captureGame(game);
+    buffer.publish();
+}
+
+void SnapshotRenderer::renderInterpolated(const Game& game, float alpha)
+{
+    buffer.getWriteBuffer().captureGame(game, alpha);
+    buffer.publish();
+}
+
+void SnapshotRenderer::renderMenu(const std::string& title,
+                                  const std::vector<std::string>& items,
+                                  size_t selectedIndex,
+                                  const std::string& instructions)
+{
+    buffer.getWriteBuffer().captureMenu(title, items, selectedIndex, instructions);
+    buffer.publish();
+}
+
+void SnapshotRenderer::renderCommands(const RenderCommandBuffer& commands)
+{
+    buffer.getWriteBuffer().captureCommands(commands);
+    buffer.publish();
+}
+
+bool SnapshotRenderer::isWindowOpen() const
+{
+    return true;
+}
+
+bool SnapshotRenderer::handleEvents(Game& game)
+{
+    // Events are handled by the window-owning renderer
+    return true;
+}
+
+bool SnapshotRenderer::handleEvents(Input& input)
+{
+    // Events are handled by the window-owning renderer
+    input = Input::NONE;
+    return true;
+}
+
+} // namespace GreedySnake
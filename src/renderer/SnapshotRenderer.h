@@ -0,0 +1,67 @@
+#pragma once
+
+#include "renderer/RenderSnapshot.h"
+#include "renderer/Renderer.h"
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Renderer that records frames as snapshots instead of drawing them
+ *
+ * Game states render into this renderer on the simulation thread. Each call
+ * fills the producer slot of a RenderSnapshotBuffer and publishes it, so a
+ * backend running on its own thread can draw the latest frame.
+ */
+class SnapshotRenderer : public Renderer
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param buffer Triple buffer to publish snapshots into
+     */
+    explicit SnapshotRenderer(RenderSnapshotBuffer& buffer);
+
+    bool initialize() override;
+    void shutdown() override;
+
+    /**
+     * @brief Capture and publish a gameplay frame
+     * @param game Reference to the game state to capture
+     */
+    void render(const Game& game) override;
+
+    /**
+     * @brief Capture and publish a gameplay frame between two ticks
+     * @param game Reference to the game state to capture
+     * @param alpha Progress from the previous tick (0) to the current tick (1)
+     */
+    void renderInterpolated(const Game& game, float alpha) override;
+
+    /**
+     * @brief Capture and publish a menu frame
+     * @param title The title to display
+     * @param items List of menu items to display
+     * @param selectedIndex Index of the currently selected item
+     * @param instructions Optional instructions to display below the menu
+     */
+    void renderMenu(const std::string& title,
+                    const std::vector<std::string>& items,
+                    size_t selectedIndex,
+                    const std::string& instructions = "") override;
+
+    /**
+     * @brief Capture and publish a laid-out frame
+     * @param commands Commands describing the frame
+     */
+    void renderCommands(const RenderCommandBuffer& commands) override;
+
+    [[nodiscard]] bool isWindowOpen() const override;
+    bool handleEvents(Game& game) override;
+    bool handleEvents(Input& input) override;
+
+  private:
+    RenderSnapshotBuffer& buffer;
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,191 @@
+#include "renderer/SoftwareRenderer.h"
+#include "renderer/FrameLayout.h"
+#include <algorithm>
+#include <cmath>
+
+namespace GreedySnake
+{
+
+namespace
+{
+const uint32_t BACKGROUND_COLOR = PixelBuffer::packColor(0, 32, 48);
+
+// Output height at which text is drawn with one pixel per font dot
+const int TEXT_SCALE_HEIGHT = 240;
+} // namespace
+
+SoftwareRenderer::SoftwareRenderer(int width, int height)
+    : frame(width, height), hudEnabled(true), frameCount(0)
+{
+}
+
+bool SoftwareRenderer::initialize()
+{
+    frame.clear(BACKGROUND_COLOR);
+    return true;
+}
+
+void SoftwareRenderer::shutdown()
+{
+    // Nothing to release; the buffer lives as long as the renderer
+}
+
+void SoftwareRenderer::render(const Game& game)
+{
+    frameSnapshot.captureGame(game);
+    FrameLayout::layoutGame(frameSnapshot, frameCommands);
+    renderCommands(frameCommands);
+}
+
+void SoftwareRenderer::renderMenu(const std::string& title,
+                                  const std::vector<std::string>& items,
+                                  size_t selectedIndex,
+                                  const std::string& instructions)
+{
+    FrameLayout::layoutMenu(title, items, selectedIndex, instructions, frameCommands);
+    renderCommands(frameCommands);
+}
+
+void SoftwareRenderer::renderCommands(const RenderCommandBuffer& commands)
+{
+    frame.clear(BACKGROUND_COLOR);
+    ++frameCount;
+
+    // Fit the board below the HUD; cells may be fractional at small resolutions
+    const int scale = getTextScale();
+    const int hudHeight = hudEnabled ? PixelBuffer::getTextHeight(scale) + 2 * scale : 0;
+    float cellSize = 0.0f;
+    float originX = 0.0f;
+    float originY = 0.0f;
+    const int boardWidth = commands.getBoardWidth();
+    const int boardHeight = commands.getBoardHeight();
+    if (commands.hasBoard() && boardWidth > 0 && boardHeight > 0)
+    {
+        const int areaHeight = frame.getHeight() - hudHeight;
+        cellSize = std::max(0.0f,
+                            std::min(static_cast<float>(frame.getWidth()) / boardWidth,
+                                     static_cast<float>(areaHeight) / boardHeight));
+        originX = (frame.getWidth() - cellSize * boardWidth) / 2.0f;
+        originY = hudHeight + (areaHeight - cellSize * boardHeight) / 2.0f;
+    }
+
+    // Cell edges are rounded the same way on both sides so neighbours share them
+    auto edgeX = [&](float x) { return static_cast<int>(std::floor(originX + x * cellSize)); };
+    auto edgeY = [&](float y) { return static_cast<int>(std::floor(originY + y * cellSize)); };
+
+    for (const RenderCommand& command : commands.getCommands())
+    {
+        switch (command.type)
+        {
+        case RenderCommand::Type::RECT:
+        case RenderCommand::Type::SPRITE: {
+            const int left = edgeX(command.x);
+            const int top = edgeY(command.y);
+            frame.fillRect(left,
+                           top,
+                           edgeX(command.x + command.width) - left,
+                           edgeY(command.y + command.height) - top,
+                           command.color);
+            break;
+        }
+        case RenderCommand::Type::CIRCLE:
+            frame.fillCircle(originX + command.x * cellSize,
+                             originY + command.y * cellSize,
+                             command.width * cellSize,
+                             command.color);
+            break;
+        case RenderCommand::Type::PARTICLE: {
+            // At least one pixel so small frames still show the effect; drawn opaque since
+            // the pixel buffer doesn't blend
+            const float size = std::max(1.0f, command.width * cellSize);
+            frame.fillRect(static_cast<int>(std::floor(originX + command.x * cellSize - size / 2)),
+                           static_cast<int>(std::floor(originY + command.y * cellSize - size / 2)),
+                           static_cast<int>(size),
+                           static_cast<int>(size),
+                           command.color | 0xFF000000u);
+            break;
+        }
+        case RenderCommand::Type::TEXT:
+            drawText(commands, command);
+            break;
+        }
+    }
+}
+
+bool SoftwareRenderer::isWindowOpen() const
+{
+    return true;
+}
+
+bool SoftwareRenderer::handleEvents(Game& game)
+{
+    return true;
+}
+
+bool SoftwareRenderer::handleEvents(Input& input)
+{
+    input = Input::NONE;
+    return true;
+}
+
+void SoftwareRenderer::setResolution(int width, int height)
+{
+    frame.resize(width, height);
+    frame.clear(BACKGROUND_COLOR);
+}
+
+void SoftwareRenderer::setHudEnabled(bool enabled)
+{
+    hudEnabled = enabled;
+}
+
+const PixelBuffer& SoftwareRenderer::getFrame() const
+{
+    return frame;
+}
+
+uint64_t SoftwareRenderer::getFrameCount() const
+{
+    return frameCount;
+}
+
+int SoftwareRenderer::getTextScale() const
+{
+    return std::max(1, frame.getHeight() / TEXT_SCALE_HEIGHT);
+}
+
+void SoftwareRenderer::drawText(const RenderCommandBuffer& commands, const RenderCommand& command)
+{
+    const auto style = static_cast<TextStyle>(command.style);
+    if (!hudEnabled && (style == TextStyle::HUD || style == TextStyle::BANNER))
+    {
+        return;
+    }
+
+    const std::string& text = commands.getText(command);
+    const int scale = style == TextStyle::TITLE ? getTextScale() * 2 : getTextScale();
+    const int height = frame.getHeight();
+    const float lineSpacing = height / 15.0f;
+    const int lineOffset = static_cast<int>(command.y * lineSpacing);
+    const int centeredX =
+        std::max(0, (frame.getWidth() - PixelBuffer::getTextWidth(text, scale)) / 2);
+
+    switch (static_cast<TextAnchor>(command.anchor))
+    {
+    case TextAnchor::TOP_LEFT:
+        frame.drawText(getTextScale(), getTextScale() + lineOffset, text, scale, command.color);
+        break;
+    case TextAnchor::TOP_CENTER:
+        frame.drawText(centeredX, height / 12 + lineOffset, text, scale, command.color);
+        break;
+    case TextAnchor::CENTER:
+        frame.drawText(centeredX,
+                       (height - PixelBuffer::getTextHeight(scale)) / 2 + lineOffset,
+                       text,
+                       scale,
+                       command.color);
+        break;
+    }
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "renderer/PixelBuffer.h"
+#include "renderer/Renderer.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Headless renderer that rasterizes frames into a CPU pixel buffer
+ *
+ * Needs neither a display server nor an OpenGL context, which makes it
+ * suitable for pixel-based agents and golden-image tests. Replays the same
+ * draw commands as SFMLRenderer, with the board fitted to the configured
+ * resolution. There is no window, so no input events are ever reported.
+ */
+class SoftwareRenderer : public Renderer
+{
+  public:
+    /**
+     * @brief Constructor for the software renderer
+     * @param width Output width in pixels
+     * @param height Output height in pixels
+     */
+    SoftwareRenderer(int width = 84, int height = 84);
+
+    /**
+     * @brief Initialize the renderer
+     * @return Always true
+     */
+    bool initialize() override;
+
+    /**
+     * @brief Release the pixel buffer
+     */
+    void shutdown() override;
+
+    /**
+     * @brief Rasterize the game state into the pixel buffer
+     * @param game Reference to the game state to render
+     */
+    void render(const Game& game) override;
+
+    /**
+     * @brief Rasterize a menu with title and items
+     * @param title The title to display
+     * @param items List of menu items to display
+     * @param selectedIndex Index of the currently selected item
+     * @param instructions Optional instructions to display below the menu
+     */
+    void renderMenu(const std::string& title,
+                    const std::vector<std::string>& items,
+                    size_t selectedIndex,
+                    const std::string& instructions = "") override;
+
+    /**
+     * @brief Rasterize a laid-out frame into the pixel buffer
+     * @param commands Commands describing the frame
+     */
+    void renderCommands(const RenderCommandBuffer& commands) override;
+
+    /**
+     * @brief Check if the renderer is usable
+     * @return Always true; there is no window to close
+     */
+    [[nodiscard]] bool isWindowOpen() const override;
+
+    /**
+     * @brief Handle input events (none without a window)
+     * @param game Reference to the game for processing input
+     * @return Always true
+     */
+    bool handleEvents(Game& game) override;
+
+    /**
+     * @brief Handle input events (none without a window)
+     * @param input Set to Input::NONE
+     * @return Always true
+     */
+    bool handleEvents(Input& input) override;
+
+    /**
+     * @brief Set the output resolution
+     * @param width Output width in pixels
+     * @param height Output height in pixels
+     */
+    void setResolution(int width, int height);
+
+    /**
+     * @brief Show or hide the score line and status messages
+     *
+     * Agents working on small frames such as 84x84 usually want the board only.
+     *
+     * @param enabled True to draw the HUD (default)
+     */
+    void setHudEnabled(bool enabled);
+
+    /**
+     * @brief Get the last rasterized frame
+     * @return Pixel buffer in RGBA byte order
+     */
+    [[nodiscard]] const PixelBuffer& getFrame() const;
+
+    /**
+     * @brief Get the number of frames rasterized so far
+     * @return Frame count
+     */
+    [[nodiscard]] uint64_t getFrameCount() const;
+
+  private:
+    PixelBuffer frame;
+    RenderSnapshot frameSnapshot;
+    RenderCommandBuffer frameCommands;
+    bool hudEnabled;
+    uint64_t frameCount;
+
+    // Size of one font dot for the current resolution
+    [[nodiscard]] int getTextScale() const;
+
+    // Rasterize one text command
+    void drawText(const RenderCommandBuffer& commands, const RenderCommand& command);
+};
+
+} // namespace GreedySnake
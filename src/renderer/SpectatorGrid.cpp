@@ -0,0 +1,129 @@
+#include "renderer/SpectatorGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace GreedySnake
+{
+
+SpectatorGrid::SpectatorGrid(float width, float height)
+    : width(width), height(height), vertices(sf::Quads)
+{
+}
+
+void SpectatorGrid::setSize(float newWidth, float newHeight)
+{
+    width = newWidth;
+    height = newHeight;
+}
+
+sf::Vector2u SpectatorGrid::computeGridShape(std::size_t gameCount)
+{
+    if (gameCount == 0)
+    {
+        return sf::Vector2u(0, 0);
+    }
+
+    // As square as possible, filling rows first
+    auto columns = static_cast<unsigned>(std::ceil(std::sqrt(static_cast<double>(gameCount))));
+    auto rows = static_cast<unsigned>((gameCount + columns - 1) / columns);
+    return sf::Vector2u(columns, rows);
+}
+
+sf::FloatRect SpectatorGrid::getTileRect(std::size_t index, std::size_t gameCount) const
+{
+    sf::Vector2u shape = computeGridShape(gameCount);
+    if (shape.x == 0)
+    {
+        return sf::FloatRect();
+    }
+
+    const float tileWidth = width / shape.x;
+    const float tileHeight = height / shape.y;
+    const auto column = static_cast<float>(index % shape.x);
+    const auto row = static_cast<float>(index / shape.x);
+    return sf::FloatRect(column * tileWidth, row * tileHeight, tileWidth, tileHeight);
+}
+
+void SpectatorGrid::build(const std::vector<const Game*>& games)
+{
+    // clear() keeps the vertex storage, so steady-state rebuilds do not allocate
+    vertices.clear();
+
+    for (std::size_t i = 0; i < games.size(); ++i)
+    {
+        if (games[i] != nullptr)
+        {
+            addGame(*games[i], getTileRect(i, games.size()));
+        }
+    }
+}
+
+const sf::VertexArray& SpectatorGrid::getVertices() const
+{
+    return vertices;
+}
+
+void SpectatorGrid::addQuad(float x, float y, float w, float h, const sf::Color& color)
+{
+    vertices.append(sf::Vertex(sf::Vector2f(x, y), color));
+    vertices.append(sf::Vertex(sf::Vector2f(x + w, y), color));
+    vertices.append(sf::Vertex(sf::Vector2f(x + w, y + h), color));
+    vertices.append(sf::Vertex(sf::Vector2f(x, y + h), color));
+}
+
+void SpectatorGrid::addGame(const Game& game, const sf::FloatRect& tile)
+{
+    const Board& board = game.getBoard();
+    const int boardWidth = board.getWidth();
+    const int boardHeight = board.getHeight();
+    if (boardWidth <= 0 || boardHeight <= 0)
+    {
+        return;
+    }
+
+    // Fit the board into the tile, leaving a small gap between neighbouring tiles
+    const float padding = 2.0f;
+    const float cellSize = std::max(0.0f,
+                                    std::min((tile.width - 2 * padding) / boardWidth,
+                                             (tile.height - 2 * padding) / boardHeight));
+    const float originX = tile.left + (tile.width - cellSize * boardWidth) / 2.0f;
+    const float originY = tile.top + (tile.height - cellSize * boardHeight) / 2.0f;
+    const float boardPixelWidth = cellSize * boardWidth;
+    const float boardPixelHeight = cellSize * boardHeight;
+
+    // Background, dimmed for finished games
+    const sf::Color background = game.isGameOver() ? sf::Color(48, 16, 16) : sf::Color(0, 32, 48);
+    addQuad(originX, originY, boardPixelWidth, boardPixelHeight, background);
+
+    // Border walls as four strips instead of one quad per wall cell
+    const sf::Color wallColor(100, 100, 100);
+    addQuad(originX, originY, boardPixelWidth, cellSize, wallColor);
+    addQuad(originX, originY + boardPixelHeight - cellSize, boardPixelWidth, cellSize, wallColor);
+    addQuad(originX, originY, cellSize, boardPixelHeight, wallColor);
+    addQuad(originX + boardPixelWidth - cellSize, originY, cellSize, boardPixelHeight, wallColor);
+
+    // Food and obstacles
+    const EntityStore& entities = game.getEntities();
+    for (std::size_t i = 0; i < entities.size(); ++i)
+    {
+        const Position cell = entities.getPositions()[i];
+        addQuad(originX + cell.x * cellSize,
+                originY + cell.y * cellSize,
+                cellSize,
+                cellSize,
+                entities.getKinds()[i] == EntityKind::FOOD ? sf::Color::Red : wallColor);
+    }
+
+    // Snake, head highlighted
+    const std::vector<Position>& body = game.getSnake().getBody();
+    for (std::size_t i = 0; i < body.size(); ++i)
+    {
+        addQuad(originX + body[i].x * cellSize,
+                originY + body[i].y * cellSize,
+                cellSize,
+                cellSize,
+                i == 0 ? sf::Color::Green : sf::Color(0, 180, 0));
+    }
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "game/Game.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Batched geometry for watching many games in a tiled grid
+ *
+ * Every game gets its own tile (sub-viewport) of the target area. All boards
+ * are written into a single quad vertex array whose storage is reused between
+ * frames, so the whole grid is drawn with one draw call regardless of how many
+ * games are shown.
+ */
+class SpectatorGrid
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param width Width of the area covered by the grid in pixels
+     * @param height Height of the area covered by the grid in pixels
+     */
+    SpectatorGrid(float width, float height);
+
+    /**
+     * @brief Set the area covered by the grid
+     * @param width Width in pixels
+     * @param height Height in pixels
+     */
+    void setSize(float width, float height);
+
+    /**
+     * @brief Compute the number of columns and rows for a number of games
+     * @param gameCount Number of games to tile
+     * @return Grid shape as (columns, rows)
+     */
+    static sf::Vector2u computeGridShape(std::size_t gameCount);
+
+    /**
+     * @brief Get the tile rectangle of one game
+     * @param index Index of the game
+     * @param gameCount Total number of games
+     * @return Tile rectangle in pixels
+     */
+    [[nodiscard]] sf::FloatRect getTileRect(std::size_t index, std::size_t gameCount) const;
+
+    /**
+     * @brief Rebuild the geometry for the given games
+     * @param games Games to show; null entries leave their tile empty
+     */
+    void build(const std::vector<const Game*>& games);
+
+    /**
+     * @brief Get the batched geometry of the last build
+     * @return Quad vertex array covering all tiles
+     */
+    [[nodiscard]] const sf::VertexArray& getVertices() const;
+
+  private:
+    float width;
+    float height;
+    sf::VertexArray vertices;
+
+    // Append one axis-aligned quad
+    void addQuad(float x, float y, float w, float h, const sf::Color& color);
+
+    // Append the geometry of one board into its tile
+    void addGame(const Game& game, const sf::FloatRect& tile);
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,122 @@
+#include "renderer/SpriteAtlas.h"
+#include <iostream>
+
+namespace GreedySnake
+{
+
+SpriteAtlas::SpriteAtlas() : tileSize(0)
+{
+}
+
+PixelBuffer SpriteAtlas::generateDefaultPixels(int tileSize)
+{
+    PixelBuffer pixels(tileSize * TILE_COUNT, tileSize);
+    pixels.clear(PixelBuffer::packColor(0, 0, 0, 0));
+
+    auto tileLeft = [tileSize](SpriteId sprite) {
+        return static_cast<int>(sprite) * tileSize;
+    };
+    const float center = tileSize / 2.0f;
+
+    // Snake head (green circle)
+    pixels.fillCircle(tileLeft(SpriteId::SNAKE_HEAD) + center,
+                      center,
+                      center,
+                      PixelBuffer::packColor(0, 255, 0));
+
+    // Snake body (green square)
+    pixels.fillRect(tileLeft(SpriteId::SNAKE_BODY),
+                    0,
+                    tileSize,
+                    tileSize,
+                    PixelBuffer::packColor(0, 180, 0));
+
+    // Food (red circle)
+    pixels.fillCircle(tileLeft(SpriteId::FOOD) + center,
+                      center,
+                      tileSize * FOOD_RADIUS,
+                      PixelBuffer::packColor(255, 0, 0));
+
+    // Wall (gray square)
+    pixels.fillRect(tileLeft(SpriteId::WALL),
+                    0,
+                    tileSize,
+                    tileSize,
+                    PixelBuffer::packColor(100, 100, 100));
+
+    // Background (dark blue)
+    pixels.fillRect(tileLeft(SpriteId::BACKGROUND),
+                    0,
+                    tileSize,
+                    tileSize,
+                    PixelBuffer::packColor(0, 32, 48));
+
+    return pixels;
+}
+
+sf::Image SpriteAtlas::generateDefaultImage(int tileSize)
+{
+    const PixelBuffer pixels = generateDefaultPixels(tileSize);
+    sf::Image image;
+    image.create(pixels.getWidth(),
+                 pixels.getHeight(),
+                 reinterpret_cast<const sf::Uint8*>(pixels.getPixels().data()));
+    return image;
+}
+
+bool SpriteAtlas::createDefault(int newTileSize)
+{
+    // Span fills into a CPU buffer, then a single upload
+    return createFromImage(generateDefaultImage(newTileSize));
+}
+
+bool SpriteAtlas::loadFromFile(const std::string& path)
+{
+    sf::Image image;
+    if (!image.loadFromFile(path))
+    {
+        std::cerr << "Failed to load sprite atlas: " << path << std::endl;
+        return false;
+    }
+    return createFromImage(image);
+}
+
+bool SpriteAtlas::createFromImage(const sf::Image& image)
+{
+    const sf::Vector2u size = image.getSize();
+    if (size.y == 0 || size.x < size.y * TILE_COUNT)
+    {
+        std::cerr << "Sprite atlas must hold " << TILE_COUNT << " square tiles in one row"
+                  << std::endl;
+        return false;
+    }
+
+    sf::Texture uploaded;
+    if (!uploaded.loadFromImage(image))
+    {
+        std::cerr << "Failed to create the sprite atlas texture" << std::endl;
+        return false;
+    }
+
+    texture = uploaded;
+    tileSize = static_cast<int>(size.y);
+    return true;
+}
+
+int SpriteAtlas::getTileSize() const
+{
+    return tileSize;
+}
+
+sf::FloatRect SpriteAtlas::getTileRect(SpriteId sprite) const
+{
+    const auto size = static_cast<float>(tileSize);
+    return sf::FloatRect(static_cast<float>(sprite) * size, 0.0f, size, size);
+}
+
+const sf::Texture& SpriteAtlas::getTexture() const
+{
+    return texture;
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "renderer/PixelBuffer.h"
+#include "renderer/RenderCommandBuffer.h"
+#include <SFML/Graphics.hpp>
+#include <string>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief All game sprites packed into one texture
+ *
+ * Tiles are square and laid out in a single row in SpriteId order, so a
+ * themed atlas is just an image (tile count * size) wide and one tile high.
+ * Drawing every sprite from the same texture lets the board go out as one
+ * batched draw without texture switches.
+ */
+class SpriteAtlas
+{
+  public:
+    /**
+     * @brief Number of tiles in an atlas
+     */
+    static constexpr int TILE_COUNT = static_cast<int>(SpriteId::BACKGROUND) + 1;
+
+    /**
+     * @brief Tile size of the generated default atlas in pixels
+     */
+    static constexpr int DEFAULT_TILE_SIZE = 32;
+
+    /**
+     * @brief Radius of the food circle relative to its tile size
+     */
+    static constexpr float FOOD_RADIUS = 0.4f;
+
+    /**
+     * @brief Constructor; the atlas is empty until created or loaded
+     */
+    SpriteAtlas();
+
+    /**
+     * @brief Generate the pixels of the default atlas
+     * @param tileSize Tile size in pixels
+     * @return Atlas image in RGBA byte order
+     */
+    static PixelBuffer generateDefaultPixels(int tileSize = DEFAULT_TILE_SIZE);
+
+    /**
+     * @brief Generate the default atlas as an image ready for upload
+     *
+     * Needs no OpenGL context, so it can run on a loader thread.
+     *
+     * @param tileSize Tile size in pixels
+     * @return Atlas image
+     */
+    static sf::Image generateDefaultImage(int tileSize = DEFAULT_TILE_SIZE);
+
+    /**
+     * @brief Create the atlas texture from the generated default sprites
+     * @param tileSize Tile size in pixels
+     * @return True if the texture was created
+     */
+    bool createDefault(int tileSize = DEFAULT_TILE_SIZE);
+
+    /**
+     * @brief Load a themed atlas from an image file
+     *
+     * The tile size is taken from the image height. On failure the current
+     * atlas is kept.
+     *
+     * @param path Image file with TILE_COUNT tiles in one row
+     * @return True if the atlas was loaded
+     */
+    bool loadFromFile(const std::string& path);
+
+    /**
+     * @brief Upload an atlas image that was decoded or generated beforehand
+     *
+     * The tile size is taken from the image height. On failure the current
+     * atlas is kept.
+     *
+     * @param image Image with TILE_COUNT tiles in one row
+     * @return True if the texture was created
+     */
+    bool createFromImage(const sf::Image& image);
+
+    /**
+     * @brief Get the tile size
+     * @return Tile size in pixels (0 before the atlas is created)
+     */
+    [[nodiscard]] int getTileSize() const;
+
+    /**
+     * @brief Get the texture area of a sprite
+     * @param sprite Sprite to look up
+     * @return Tile rectangle in texture pixels
+     */
+    [[nodiscard]] sf::FloatRect getTileRect(SpriteId sprite) const;
+
+    /**
+     * @brief Get the atlas texture
+     * @return Texture holding all tiles
+     */
+    [[nodiscard]] const sf::Texture& getTexture() const;
+
+  private:
+    sf::Texture texture;
+    int tileSize;
+};
+
+} // namespace GreedySnake
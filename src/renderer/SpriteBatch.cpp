@@ -0,0 +1,129 @@
+#include "renderer/SpriteBatch.h"
+#include <algorithm>
+#include <cmath>
+
+namespace GreedySnake
+{
+
+namespace
+{
+// Texture coordinates stay half a texel inside their tile so scaled quads never
+// sample the neighbouring tile
+const float TEXEL_INSET = 0.5f;
+} // namespace
+
+SpriteBatch::SpriteBatch() : vertices(sf::Quads), cellSize(0.0f)
+{
+}
+
+void SpriteBatch::build(const RenderCommandBuffer& commands,
+                        const SpriteAtlas& atlas,
+                        const sf::Vector2f& boardOrigin,
+                        float newCellSize,
+                        const sf::IntRect& visibleCells)
+{
+    // clear() keeps the vertex storage, so steady-state rebuilds do not allocate
+    vertices.clear();
+    origin = boardOrigin;
+    cellSize = newCellSize;
+
+    const int left = visibleCells.left;
+    const int top = visibleCells.top;
+    const int right = visibleCells.left + visibleCells.width;
+    const int bottom = visibleCells.top + visibleCells.height;
+
+    // Background under every visible cell
+    const sf::FloatRect backgroundTile = atlas.getTileRect(SpriteId::BACKGROUND);
+    for (int y = top; y < bottom; ++y)
+    {
+        for (int x = left; x < right; ++x)
+        {
+            addQuad(static_cast<float>(x), static_cast<float>(y), 1.0f, 1.0f, backgroundTile);
+        }
+    }
+
+    // One cell of slack so interpolated sprites entering the view are not popped in late
+    auto isVisible = [&](float x, float y, float width, float height) {
+        return x + width >= left - 1 && x <= right + 1 && y + height >= top - 1 &&
+               y <= bottom + 1;
+    };
+
+    const sf::FloatRect wallTile = atlas.getTileRect(SpriteId::WALL);
+    const sf::FloatRect foodTile = atlas.getTileRect(SpriteId::FOOD);
+    for (const RenderCommand& command : commands.getCommands())
+    {
+        switch (command.type)
+        {
+        case RenderCommand::Type::RECT: {
+            const int firstX = std::max(left, static_cast<int>(std::floor(command.x)));
+            const int firstY = std::max(top, static_cast<int>(std::floor(command.y)));
+            const int endX =
+                std::min(right, static_cast<int>(std::ceil(command.x + command.width)));
+            const int endY =
+                std::min(bottom, static_cast<int>(std::ceil(command.y + command.height)));
+            for (int y = firstY; y < endY; ++y)
+            {
+                for (int x = firstX; x < endX; ++x)
+                {
+                    addQuad(static_cast<float>(x), static_cast<float>(y), 1.0f, 1.0f, wallTile);
+                }
+            }
+            break;
+        }
+        case RenderCommand::Type::CIRCLE: {
+            // Size the quad so the circle in the food tile matches the requested radius
+            const float size = command.width / SpriteAtlas::FOOD_RADIUS;
+            if (isVisible(command.x - size / 2.0f, command.y - size / 2.0f, size, size))
+            {
+                addQuad(command.x - size / 2.0f, command.y - size / 2.0f, size, size, foodTile);
+            }
+            break;
+        }
+        case RenderCommand::Type::SPRITE:
+            if (isVisible(command.x, command.y, command.width, command.height))
+            {
+                addQuad(command.x,
+                        command.y,
+                        command.width,
+                        command.height,
+                        atlas.getTileRect(static_cast<SpriteId>(command.style)));
+            }
+            break;
+        case RenderCommand::Type::PARTICLE: // Untextured; drawn in their own batch
+        case RenderCommand::Type::TEXT:
+            break;
+        }
+    }
+}
+
+const sf::VertexArray& SpriteBatch::getVertices() const
+{
+    return vertices;
+}
+
+std::size_t SpriteBatch::getQuadCount() const
+{
+    return vertices.getVertexCount() / 4;
+}
+
+void SpriteBatch::addQuad(float x, float y, float width, float height, const sf::FloatRect& tile)
+{
+    const float left = origin.x + x * cellSize;
+    const float top = origin.y + y * cellSize;
+    const float right = left + width * cellSize;
+    const float bottom = top + height * cellSize;
+
+    const float textureLeft = tile.left + TEXEL_INSET;
+    const float textureTop = tile.top + TEXEL_INSET;
+    const float textureRight = tile.left + tile.width - TEXEL_INSET;
+    const float textureBottom = tile.top + tile.height - TEXEL_INSET;
+
+    vertices.append(sf::Vertex(sf::Vector2f(left, top), sf::Vector2f(textureLeft, textureTop)));
+    vertices.append(sf::Vertex(sf::Vector2f(right, top), sf::Vector2f(textureRight, textureTop)));
+    vertices.append(
+        sf::Vertex(sf::Vector2f(right, bottom), sf::Vector2f(textureRight, textureBottom)));
+    vertices.append(
+        sf::Vertex(sf::Vector2f(left, bottom), sf::Vector2f(textureLeft, textureBottom)));
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "renderer/RenderCommandBuffer.h"
+#include "renderer/SpriteAtlas.h"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Textured quads for the board part of a laid-out frame
+ *
+ * Turns the board-space commands of a RenderCommandBuffer into quads that all
+ * sample the same SpriteAtlas, so the board is drawn with a single draw call.
+ * Empty cells get the background tile, rectangles are tiled with the wall
+ * sprite one cell at a time (so themed tiles are not stretched), and circles
+ * use the food sprite. Only cells inside the visible range are emitted. The
+ * vertex storage is reused between frames.
+ */
+class SpriteBatch
+{
+  public:
+    /**
+     * @brief Constructor
+     */
+    SpriteBatch();
+
+    /**
+     * @brief Rebuild the quads for a frame
+     * @param commands Laid-out frame; text commands are ignored
+     * @param atlas Atlas the quads sample from
+     * @param origin Position of board cell (0, 0) in pixels
+     * @param cellSize Cell size in pixels
+     * @param visibleCells Board cells to emit (left/top cell and width/height in cells)
+     */
+    void build(const RenderCommandBuffer& commands,
+               const SpriteAtlas& atlas,
+               const sf::Vector2f& origin,
+               float cellSize,
+               const sf::IntRect& visibleCells);
+
+    /**
+     * @brief Get the quads of the last build
+     * @return Quad vertex array to draw with the atlas texture
+     */
+    [[nodiscard]] const sf::VertexArray& getVertices() const;
+
+    /**
+     * @brief Get the number of quads of the last build
+     * @return Quad count
+     */
+    [[nodiscard]] std::size_t getQuadCount() const;
+
+  private:
+    sf::VertexArray vertices;
+    sf::Vector2f origin;
+    float cellSize;
+
+    // Add one quad given in board cells
+    void addQuad(float x, float y, float width, float height, const sf::FloatRect& tile);
+};
+
+} // namespace GreedySnake
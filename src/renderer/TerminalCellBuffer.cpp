@@ -0,0 +1,139 @@
+#include "renderer/TerminalCellBuffer.h"
+#include <algorithm>
+
+namespace GreedySnake
+{
+
+void TerminalCellBuffer::resize(int newWidth, int newHeight)
+{
+    width = std::max(newWidth, 0);
+    height = std::max(newHeight, 0);
+
+    const size_t cellCount = static_cast<size_t>(width) * height;
+    front.assign(cellCount, TerminalCell());
+    back.assign(cellCount, TerminalCell());
+    forceRedraw = true;
+}
+
+int TerminalCellBuffer::getWidth() const
+{
+    return width;
+}
+
+int TerminalCellBuffer::getHeight() const
+{
+    return height;
+}
+
+void TerminalCellBuffer::clear()
+{
+    std::fill(back.begin(), back.end(), TerminalCell());
+}
+
+void TerminalCellBuffer::setCell(int x, int y, const TerminalCell& cell)
+{
+    if (x < 0 || y < 0 || x >= width || y >= height)
+    {
+        return;
+    }
+    back[static_cast<size_t>(y) * width + x] = cell;
+}
+
+TerminalCell TerminalCellBuffer::getCell(int x, int y) const
+{
+    if (x < 0 || y < 0 || x >= width || y >= height)
+    {
+        return TerminalCell();
+    }
+    return back[static_cast<size_t>(y) * width + x];
+}
+
+int TerminalCellBuffer::drawText(int x, int y, const std::string& text, short colorPair, bool bold)
+{
+    int column = x;
+    size_t index = 0;
+    while (index < text.size())
+    {
+        TerminalCell cell;
+        cell.character = decodeCharacter(text, index);
+        cell.colorPair = colorPair;
+        cell.bold = bold;
+        setCell(column, y, cell);
+        ++column;
+    }
+    return column - x;
+}
+
+int TerminalCellBuffer::getTextWidth(const std::string& text)
+{
+    int columns = 0;
+    size_t index = 0;
+    while (index < text.size())
+    {
+        decodeCharacter(text, index);
+        ++columns;
+    }
+    return columns;
+}
+
+void TerminalCellBuffer::invalidate()
+{
+    forceRedraw = true;
+}
+
+char TerminalCellBuffer::decodeCharacter(const std::string& text, size_t& index)
+{
+    const auto lead = static_cast<unsigned char>(text[index]);
+
+    // Plain ASCII
+    if (lead < 0x80)
+    {
+        ++index;
+        return static_cast<char>(lead);
+    }
+
+    // Determine the sequence length from the lead byte
+    size_t length = 1;
+    if ((lead & 0xE0) == 0xC0)
+    {
+        length = 2;
+    }
+    else if ((lead & 0xF0) == 0xE0)
+    {
+        length = 3;
+    }
+    else if ((lead & 0xF8) == 0xF0)
+    {
+        length = 4;
+    }
+
+    unsigned int codePoint = 0;
+    if (index + length <= text.size() && length > 1)
+    {
+        codePoint = lead & (0x7F >> length);
+        for (size_t i = 1; i < length; ++i)
+        {
+            codePoint = (codePoint << 6) | (static_cast<unsigned char>(text[index + i]) & 0x3F);
+        }
+    }
+    index = std::min(index + length, text.size());
+
+    // Map the symbols used by the menus to ASCII look-alikes
+    switch (codePoint)
+    {
+    case 0x2190: // ←
+        return '<';
+    case 0x2191: // ↑
+        return '^';
+    case 0x2192: // →
+        return '>';
+    case 0x2193: // ↓
+        return 'v';
+    case 0x21B5: // ↵
+        return '#';
+    default:
+        return '?';
+    }
+}
+
+} // namespace GreedySnake
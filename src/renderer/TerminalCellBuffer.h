@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief One character cell of a terminal screen
+ */
+struct TerminalCell
+{
+    char character = ' ';
+    short colorPair = 0; // Terminal color pair (0 = default colors)
+    bool bold = false;
+
+    bool operator==(const TerminalCell& other) const
+    {
+        return character == other.character && colorPair == other.colorPair && bold == other.bold;
+    }
+
+    bool operator!=(const TerminalCell& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/**
+ * @brief Double-buffered terminal screen that only emits changed cells
+ *
+ * A frame is composed into the back buffer; flush() compares it with the
+ * shadow copy of what is already on screen and hands only the differing
+ * cells to the output callback. This keeps per-frame output proportional to
+ * what changed, which matters on slow remote links.
+ */
+class TerminalCellBuffer
+{
+  public:
+    /**
+     * @brief Resize both buffers; the next flush redraws every cell
+     * @param width Width in columns
+     * @param height Height in rows
+     */
+    void resize(int width, int height);
+
+    /**
+     * @brief Get the width in columns
+     * @return Width of the buffer
+     */
+    [[nodiscard]] int getWidth() const;
+
+    /**
+     * @brief Get the height in rows
+     * @return Height of the buffer
+     */
+    [[nodiscard]] int getHeight() const;
+
+    /**
+     * @brief Reset the back buffer to blank cells
+     */
+    void clear();
+
+    /**
+     * @brief Set one cell of the back buffer (ignored if out of bounds)
+     * @param x Column
+     * @param y Row
+     * @param cell Cell contents
+     */
+    void setCell(int x, int y, const TerminalCell& cell);
+
+    /**
+     * @brief Get one cell of the back buffer
+     * @param x Column
+     * @param y Row
+     * @return Cell contents (a blank cell if out of bounds)
+     */
+    [[nodiscard]] TerminalCell getCell(int x, int y) const;
+
+    /**
+     * @brief Write UTF-8 text into the back buffer, clipped to the buffer
+     *
+     * Arrow and return symbols are mapped to ASCII look-alikes; any other
+     * non-ASCII character is shown as '?'.
+     *
+     * @param x Starting column
+     * @param y Row
+     * @param text UTF-8 text
+     * @param colorPair Color pair for the text
+     * @param bold Whether to draw the text in bold
+     * @return Number of columns written (including clipped ones)
+     */
+    int drawText(int x, int y, const std::string& text, short colorPair = 0, bool bold = false);
+
+    /**
+     * @brief Get the number of columns a UTF-8 text occupies when drawn
+     * @param text UTF-8 text
+     * @return Column count
+     */
+    [[nodiscard]] static int getTextWidth(const std::string& text);
+
+    /**
+     * @brief Decode one UTF-8 character into its ASCII look-alike
+     * @param text UTF-8 text
+     * @param index Position of the character; advanced past it
+     * @return ASCII character ('?' for symbols without a look-alike)
+     */
+    static char decodeCharacter(const std::string& text, size_t& index);
+
+    /**
+     * @brief Force the next flush to emit every cell
+     */
+    void invalidate();
+
+    /**
+     * @brief Emit the cells that differ from the screen and remember them as shown
+     * @tparam Emit Callable taking (int x, int y, const TerminalCell& cell)
+     * @param emit Output callback for each changed cell
+     * @return Number of cells emitted
+     */
+    template <typename Emit> size_t flush(Emit&& emit)
+    {
+        size_t changed = 0;
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                const size_t index = static_cast<size_t>(y) * width + x;
+                if (forceRedraw || back[index] != front[index])
+                {
+                    emit(x, y, back[index]);
+                    front[index] = back[index];
+                    ++changed;
+                }
+            }
+        }
+        forceRedraw = false;
+        return changed;
+    }
+
+  private:
+    int width = 0;
+    int height = 0;
+    bool forceRedraw = true;
+    std::vector<TerminalCell> front; // What is currently on screen
+    std::vector<TerminalCell> back;  // Frame being composed
+};
+
+} // namespace GreedySnake
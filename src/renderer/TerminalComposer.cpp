@@ -0,0 +1,188 @@
+#include "renderer/TerminalComposer.h"
+#include <algorithm>
+#include <cmath>
+
+namespace GreedySnake
+{
+
+namespace
+{
+// Rows reserved above and below the board for the score and status lines
+const int HEADER_ROWS = 1;
+const int FOOTER_ROWS = 1;
+
+// Terminal columns per board cell
+const int CELL_COLUMNS = 2;
+
+// Row of a menu title and rows per menu line below it
+const int MENU_TITLE_ROW = 2;
+const int MENU_LINE_ROWS = 2;
+} // namespace
+
+void TerminalComposer::compose(const RenderCommandBuffer& commands, TerminalCellBuffer& cells)
+{
+    cells.clear();
+
+    const int columns = cells.getWidth();
+    const int rows = cells.getHeight();
+    const int boardWidth = commands.getBoardWidth();
+    const int boardHeight = commands.getBoardHeight();
+    const int boardRows = rows - HEADER_ROWS - FOOTER_ROWS;
+    const int visibleWidth = std::max(1, std::min(boardWidth, columns / CELL_COLUMNS));
+    const int visibleHeight = std::max(1, std::min(boardHeight, boardRows));
+
+    // Center a board that fits; scroll one that doesn't so the focus stays in view
+    int firstX = 0;
+    int firstY = 0;
+    if (boardWidth > 0 && boardHeight > 0)
+    {
+        const int focusX = static_cast<int>(std::floor(commands.getFocusX()));
+        const int focusY = static_cast<int>(std::floor(commands.getFocusY()));
+        firstX = std::clamp(focusX - visibleWidth / 2, 0, std::max(0, boardWidth - visibleWidth));
+        firstY =
+            std::clamp(focusY - visibleHeight / 2, 0, std::max(0, boardHeight - visibleHeight));
+    }
+    const int originX = (columns - visibleWidth * CELL_COLUMNS) / 2 - firstX * CELL_COLUMNS;
+    const int originY = HEADER_ROWS + std::max(0, (boardRows - visibleHeight) / 2) - firstY;
+
+    auto putCell = [&](int x, int y, char character, short colorPair) {
+        if (x < firstX || x >= firstX + visibleWidth || y < firstY || y >= firstY + visibleHeight)
+        {
+            return;
+        }
+
+        TerminalCell cell;
+        cell.character = character;
+        cell.colorPair = colorPair;
+        const int column = originX + x * CELL_COLUMNS;
+        for (int i = 0; i < CELL_COLUMNS; ++i)
+        {
+            cells.setCell(column + i, originY + y, cell);
+        }
+    };
+
+    for (const RenderCommand& command : commands.getCommands())
+    {
+        switch (command.type)
+        {
+        case RenderCommand::Type::RECT: {
+            // Every cell the rectangle touches, clipped to the visible part of the board
+            const int left = std::max(firstX, static_cast<int>(std::floor(command.x)));
+            const int top = std::max(firstY, static_cast<int>(std::floor(command.y)));
+            const int right = std::min(firstX + visibleWidth,
+                                       static_cast<int>(std::ceil(command.x + command.width)));
+            const int bottom = std::min(firstY + visibleHeight,
+                                        static_cast<int>(std::ceil(command.y + command.height)));
+            for (int y = top; y < bottom; ++y)
+            {
+                for (int x = left; x < right; ++x)
+                {
+                    putCell(x, y, '#', WALL_COLOR);
+                }
+            }
+            break;
+        }
+        case RenderCommand::Type::CIRCLE:
+            putCell(static_cast<int>(std::floor(command.x)),
+                    static_cast<int>(std::floor(command.y)),
+                    '*',
+                    FOOD_COLOR);
+            break;
+        case RenderCommand::Type::SPRITE: {
+            // Sprites snap to the nearest cell; the terminal can't show sub-cell motion
+            const int x = static_cast<int>(std::lround(command.x));
+            const int y = static_cast<int>(std::lround(command.y));
+            switch (static_cast<SpriteId>(command.style))
+            {
+            case SpriteId::SNAKE_HEAD:
+                putCell(x, y, '@', SNAKE_HEAD_COLOR);
+                break;
+            case SpriteId::SNAKE_BODY:
+                putCell(x, y, 'o', SNAKE_BODY_COLOR);
+                break;
+            case SpriteId::FOOD:
+                putCell(x, y, '*', FOOD_COLOR);
+                break;
+            case SpriteId::WALL:
+                putCell(x, y, '#', WALL_COLOR);
+                break;
+            case SpriteId::BACKGROUND:
+                break;
+            }
+            break;
+        }
+        case RenderCommand::Type::PARTICLE:
+            // Far smaller than a terminal cell; they would only hide the board
+            break;
+        case RenderCommand::Type::TEXT:
+            drawText(commands, command, cells);
+            break;
+        }
+    }
+}
+
+void TerminalComposer::drawText(const RenderCommandBuffer& commands,
+                                const RenderCommand& command,
+                                TerminalCellBuffer& cells)
+{
+    const std::string& text = commands.getText(command);
+
+    short colorPair = TEXT_COLOR;
+    bool bold = false;
+    bool padded = false;
+    switch (static_cast<TextStyle>(command.style))
+    {
+    case TextStyle::HUD:
+    case TextStyle::TITLE:
+        bold = true;
+        break;
+    case TextStyle::BANNER:
+        // Padding keeps the message readable on top of the board
+        colorPair = HIGHLIGHT_COLOR;
+        bold = true;
+        padded = true;
+        break;
+    case TextStyle::ITEM:
+        break;
+    case TextStyle::SELECTED_ITEM:
+        colorPair = HIGHLIGHT_COLOR;
+        bold = true;
+        break;
+    case TextStyle::HINT:
+        colorPair = DIM_COLOR;
+        break;
+    }
+
+    switch (static_cast<TextAnchor>(command.anchor))
+    {
+    case TextAnchor::TOP_LEFT:
+        cells.drawText(0, static_cast<int>(std::lround(command.y)), text, colorPair, bold);
+        break;
+    case TextAnchor::TOP_CENTER:
+        drawCenteredText(cells,
+                         MENU_TITLE_ROW + static_cast<int>(std::lround(command.y * MENU_LINE_ROWS)),
+                         text,
+                         colorPair,
+                         bold);
+        break;
+    case TextAnchor::CENTER:
+        drawCenteredText(cells,
+                         cells.getHeight() / 2 + static_cast<int>(std::lround(command.y)),
+                         padded ? " " + text + " " : text,
+                         colorPair,
+                         bold);
+        break;
+    }
+}
+
+void TerminalComposer::drawCenteredText(TerminalCellBuffer& cells,
+                                        int row,
+                                        const std::string& text,
+                                        short colorPair,
+                                        bool bold)
+{
+    const int column = std::max(0, (cells.getWidth() - TerminalCellBuffer::getTextWidth(text)) / 2);
+    cells.drawText(column, row, text, colorPair, bold);
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "renderer/RenderCommandBuffer.h"
+#include "renderer/TerminalCellBuffer.h"
+#include <string>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Maps laid-out frames onto a grid of terminal cells
+ *
+ * Shared by every text-mode output (the local ncurses renderer and remote
+ * terminal sessions). Each board cell is two columns wide to keep the board
+ * roughly square, sprites snap to whole cells, and boards larger than the
+ * terminal scroll to keep the layout's focus in view.
+ */
+class TerminalComposer
+{
+  public:
+    /**
+     * @brief Color pairs used by composed frames
+     */
+    enum ColorPair : short
+    {
+        TEXT_COLOR = 1,
+        WALL_COLOR,
+        SNAKE_HEAD_COLOR,
+        SNAKE_BODY_COLOR,
+        FOOD_COLOR,
+        HIGHLIGHT_COLOR,
+        DIM_COLOR
+    };
+
+    /**
+     * @brief Compose a laid-out frame into the back buffer of a cell buffer
+     * @param commands Commands describing the frame
+     * @param cells Cell buffer to draw into; cleared first
+     */
+    static void compose(const RenderCommandBuffer& commands, TerminalCellBuffer& cells);
+
+  private:
+    // Write one text command into the cell buffer
+    static void drawText(const RenderCommandBuffer& commands,
+                         const RenderCommand& command,
+                         TerminalCellBuffer& cells);
+
+    // Write text centered on a row
+    static void drawCenteredText(TerminalCellBuffer& cells,
+                                 int row,
+                                 const std::string& text,
+                                 short colorPair,
+                                 bool bold = false);
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,223 @@
+#include "server/ArcadeLoadTest.h"
+#include "server/ArcadeSocket.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <iostream>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace GreedySnake
+{
+
+namespace
+{
+// Bare cursor-home sequence that ends every frame
+const char FRAME_END[] = "\x1b[H";
+const size_t FRAME_END_LENGTH = sizeof(FRAME_END) - 1;
+
+// Connections opened per loop iteration, so the server's backlog never overflows
+const int CONNECT_BATCH = 256;
+
+const std::chrono::milliseconds KEY_INTERVAL(100);
+const char KEYS[] = {'w', 'a', 's', 'd', 'r'};
+const int MAX_EVENTS = 256;
+} // namespace
+
+ArcadeLoadTest::ArcadeLoadTest(const std::string& address)
+    : address(address),
+      connectedCount(0),
+      droppedCount(0),
+      failedCount(0),
+      bytesReceived(0),
+      frameCount(0)
+{
+}
+
+bool ArcadeLoadTest::run(int sessionCount, float seconds)
+{
+    ArcadeSocket::raiseFileLimit();
+
+    const int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    clients.assign(static_cast<size_t>(std::max(sessionCount, 0)), Client());
+
+    const auto connectStart = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point playStart;
+    std::chrono::steady_clock::time_point playEnd;
+    uint64_t framesBeforePlay = 0;
+    uint64_t bytesBeforePlay = 0;
+    size_t nextClient = 0;
+    bool playing = false;
+    epoll_event events[MAX_EVENTS];
+
+    while (true)
+    {
+        // Open the next batch of connections
+        for (int i = 0; i < CONNECT_BATCH && nextClient < clients.size(); ++i)
+        {
+            Client& client = clients[nextClient];
+            client.socket = ArcadeSocket::connectTo(address);
+            if (client.socket < 0)
+            {
+                ++failedCount;
+            }
+            else
+            {
+                epoll_event event{};
+                event.events = EPOLLIN | EPOLLRDHUP;
+                event.data.u64 = nextClient;
+                epoll_ctl(epollFd, EPOLL_CTL_ADD, client.socket, &event);
+                client.open = true;
+                client.nextKey = std::chrono::steady_clock::now() + KEY_INTERVAL;
+                ++connectedCount;
+            }
+            ++nextClient;
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (!playing && nextClient == clients.size())
+        {
+            playing = true;
+            playStart = now;
+            playEnd = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                 std::chrono::duration<float>(seconds));
+            framesBeforePlay = frameCount;
+            bytesBeforePlay = bytesReceived;
+            std::cout << "Connected " << connectedCount << " sessions in "
+                      << std::chrono::duration<float>(now - connectStart).count() << " s"
+                      << std::endl;
+        }
+        if (playing && now >= playEnd)
+        {
+            break;
+        }
+
+        const int count = epoll_wait(epollFd, events, MAX_EVENTS, 10);
+        for (int i = 0; i < count; ++i)
+        {
+            Client& client = clients[events[i].data.u64];
+            if (client.open && !receive(client))
+            {
+                drop(client);
+            }
+        }
+
+        // Key presses, roughly one per client per interval
+        const auto keyTime = std::chrono::steady_clock::now();
+        for (Client& client : clients)
+        {
+            if (client.open && keyTime >= client.nextKey)
+            {
+                client.nextKey = keyTime + KEY_INTERVAL;
+                if (!sendKey(client))
+                {
+                    drop(client);
+                }
+            }
+        }
+    }
+
+    const float elapsed =
+        std::chrono::duration<float>(std::chrono::steady_clock::now() - playStart).count();
+    const size_t alive = connectedCount - droppedCount;
+    const float frames = static_cast<float>(frameCount - framesBeforePlay);
+    const float bytes = static_cast<float>(bytesReceived - bytesBeforePlay);
+
+    std::cout << "Sessions: " << alive << " alive, " << droppedCount << " dropped, "
+              << failedCount << " failed to connect" << std::endl;
+    if (elapsed > 0.0f && alive > 0)
+    {
+        std::cout << "Throughput: " << bytes / 1024.0f / elapsed << " KiB/s, "
+                  << frames / elapsed / alive << " frames/s per session" << std::endl;
+    }
+
+    for (Client& client : clients)
+    {
+        if (client.open)
+        {
+            drop(client);
+            --droppedCount; // Closed by us, not by the server
+        }
+    }
+    close(epollFd);
+    return connectedCount > 0;
+}
+
+size_t ArcadeLoadTest::getConnectedCount() const
+{
+    return connectedCount;
+}
+
+size_t ArcadeLoadTest::getDroppedCount() const
+{
+    return droppedCount;
+}
+
+size_t ArcadeLoadTest::getFailedCount() const
+{
+    return failedCount;
+}
+
+uint64_t ArcadeLoadTest::getBytesReceived() const
+{
+    return bytesReceived;
+}
+
+uint64_t ArcadeLoadTest::getFrameCount() const
+{
+    return frameCount;
+}
+
+bool ArcadeLoadTest::receive(Client& client)
+{
+    char buffer[16384];
+    while (true)
+    {
+        const ssize_t received = recv(client.socket, buffer, sizeof(buffer), 0);
+        if (received == 0)
+        {
+            return false;
+        }
+        if (received < 0)
+        {
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        }
+
+        bytesReceived += static_cast<uint64_t>(received);
+
+        // The terminator may be split across reads, so keep the partial match
+        for (ssize_t i = 0; i < received; ++i)
+        {
+            if (buffer[i] == FRAME_END[client.matched])
+            {
+                if (++client.matched == FRAME_END_LENGTH)
+                {
+                    ++frameCount;
+                    client.matched = 0;
+                }
+            }
+            else
+            {
+                client.matched = buffer[i] == FRAME_END[0] ? 1 : 0;
+            }
+        }
+    }
+}
+
+bool ArcadeLoadTest::sendKey(Client& client)
+{
+    const char key = KEYS[std::rand() % sizeof(KEYS)];
+    const ssize_t sent = send(client.socket, &key, 1, MSG_NOSIGNAL | MSG_DONTWAIT);
+    return sent == 1 || (sent < 0 && (errno == EAGAIN || errno == ENOTCONN));
+}
+
+void ArcadeLoadTest::drop(Client& client)
+{
+    close(client.socket);
+    client.socket = -1;
+    client.open = false;
+    ++droppedCount;
+}
+
+} // namespace GreedySnake
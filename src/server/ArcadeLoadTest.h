@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Load generator for ArcadeServer
+ *
+ * Opens many client connections from a single epoll loop, presses random
+ * direction keys on each of them and counts the frames that come back.
+ * Frames are recognised by the cursor-home sequence AnsiFrameEncoder ends
+ * them with.
+ */
+class ArcadeLoadTest
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param address Server address (see ArcadeSocket)
+     */
+    explicit ArcadeLoadTest(const std::string& address);
+
+    /**
+     * @brief Connect the sessions, play for a while and print a report
+     * @param sessionCount Number of connections to open
+     * @param seconds How long to play once connected
+     * @return True if at least one session connected
+     */
+    bool run(int sessionCount, float seconds);
+
+    /**
+     * @brief Get the number of sessions that connected
+     * @return Connected session count
+     */
+    [[nodiscard]] size_t getConnectedCount() const;
+
+    /**
+     * @brief Get the number of connected sessions the server closed
+     * @return Dropped session count
+     */
+    [[nodiscard]] size_t getDroppedCount() const;
+
+    /**
+     * @brief Get the number of sessions that could not connect
+     * @return Failed connection count
+     */
+    [[nodiscard]] size_t getFailedCount() const;
+
+    /**
+     * @brief Get the number of bytes received over all sessions
+     * @return Byte count
+     */
+    [[nodiscard]] uint64_t getBytesReceived() const;
+
+    /**
+     * @brief Get the number of frames received over all sessions
+     * @return Frame count
+     */
+    [[nodiscard]] uint64_t getFrameCount() const;
+
+  private:
+    /**
+     * @brief State of one client connection
+     */
+    struct Client
+    {
+        int socket = -1;
+        bool open = false;
+        size_t matched = 0; // Characters of the frame terminator matched so far
+        std::chrono::steady_clock::time_point nextKey;
+    };
+
+    std::string address;
+    std::vector<Client> clients;
+    size_t connectedCount;
+    size_t droppedCount; // Connected, then closed
+    size_t failedCount;  // Never connected
+    uint64_t bytesReceived;
+    uint64_t frameCount;
+
+    // Read everything available on a client; false if the connection ended
+    bool receive(Client& client);
+
+    // Press a random key on a client
+    bool sendKey(Client& client);
+
+    // Close a client connection
+    void drop(Client& client);
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,436 @@
+#include "server/ArcadeServer.h"
+#include "server/ArcadeSocket.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace GreedySnake
+{
+
+namespace
+{
+// Client terminal size assumed for every session
+const int TERMINAL_COLUMNS = 80;
+const int TERMINAL_ROWS = 24;
+
+const int MAX_EVENTS = 256;
+
+void wake(int eventFd)
+{
+    const uint64_t one = 1;
+    [[maybe_unused]] const ssize_t written = write(eventFd, &one, sizeof(one));
+}
+
+void drainWakeups(int eventFd)
+{
+    uint64_t count = 0;
+    [[maybe_unused]] const ssize_t received = read(eventFd, &count, sizeof(count));
+}
+} // namespace
+
+ArcadeServer::ArcadeServer(const std::string& address)
+    : address(address),
+      listenFd(-1),
+      wakeFd(-1),
+      workerCount(0),
+      boardWidth(20),
+      boardHeight(20),
+      tickPeriod(std::chrono::milliseconds(100)),
+      running(false),
+      nextWorker(0)
+{
+}
+
+ArcadeServer::~ArcadeServer()
+{
+    stop();
+    shutdown();
+}
+
+void ArcadeServer::setWorkerCount(int count)
+{
+    workerCount = std::max(count, 0);
+}
+
+void ArcadeServer::setTickRate(float ticksPerSecond)
+{
+    if (ticksPerSecond > 0.0f)
+    {
+        tickPeriod = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<float>(1.0f / ticksPerSecond));
+    }
+}
+
+void ArcadeServer::setBoardSize(int width, int height)
+{
+    boardWidth = width;
+    boardHeight = height;
+}
+
+bool ArcadeServer::start()
+{
+    if (listenFd >= 0)
+    {
+        return true;
+    }
+
+    ArcadeSocket::raiseFileLimit();
+
+    listenFd = ArcadeSocket::listenOn(address);
+    if (listenFd < 0)
+    {
+        return false;
+    }
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    int count = workerCount;
+    if (count == 0)
+    {
+        count = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    // Every worker ticks on the same schedule, counted from here
+    startTime = std::chrono::steady_clock::now();
+    running.store(true, std::memory_order_release);
+
+    for (int i = 0; i < count; ++i)
+    {
+        auto worker = std::make_unique<Worker>();
+        worker->epollFd = epoll_create1(EPOLL_CLOEXEC);
+        worker->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = worker->wakeFd;
+        epoll_ctl(worker->epollFd, EPOLL_CTL_ADD, worker->wakeFd, &event);
+
+        Worker& workerRef = *worker;
+        workers.push_back(std::move(worker));
+        workerRef.thread = std::thread(&ArcadeServer::workerLoop, this, std::ref(workerRef));
+    }
+
+    std::cout << "Arcade server listening on " << address << " with " << count << " workers"
+              << std::endl;
+    return true;
+}
+
+void ArcadeServer::run(float statsInterval)
+{
+    if (listenFd < 0)
+    {
+        return;
+    }
+
+    const int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = listenFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+    event.data.fd = wakeFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &event);
+
+    auto lastStats = std::chrono::steady_clock::now();
+    uint64_t lastBytes = getBytesSent();
+    epoll_event events[2];
+
+    while (running.load(std::memory_order_acquire))
+    {
+        const int count = epoll_wait(epollFd, events, 2, 1000);
+        for (int i = 0; i < count; ++i)
+        {
+            if (events[i].data.fd == listenFd)
+            {
+                acceptConnections();
+            }
+            else
+            {
+                drainWakeups(wakeFd);
+            }
+        }
+
+        // Periodic statistics
+        const auto now = std::chrono::steady_clock::now();
+        const float elapsed = std::chrono::duration<float>(now - lastStats).count();
+        if (statsInterval > 0.0f && elapsed >= statsInterval)
+        {
+            const uint64_t bytes = getBytesSent();
+            std::cout << "Sessions: " << getSessionCount()
+                      << ", late ticks: " << getLateTickCount()
+                      << ", sent: " << (bytes - lastBytes) / 1024.0f / elapsed << " KiB/s"
+                      << std::endl;
+            lastStats = now;
+            lastBytes = bytes;
+        }
+    }
+
+    close(epollFd);
+    shutdown();
+}
+
+void ArcadeServer::stop()
+{
+    // Only an atomic store and eventfd writes, so this is async-signal-safe
+    running.store(false, std::memory_order_release);
+    if (wakeFd >= 0)
+    {
+        wake(wakeFd);
+    }
+    for (const auto& worker : workers)
+    {
+        wake(worker->wakeFd);
+    }
+}
+
+int ArcadeServer::getPort() const
+{
+    return listenFd >= 0 ? ArcadeSocket::getLocalPort(listenFd) : 0;
+}
+
+size_t ArcadeServer::getSessionCount() const
+{
+    size_t count = 0;
+    for (const auto& worker : workers)
+    {
+        count += worker->sessionCount.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+uint64_t ArcadeServer::getLateTickCount() const
+{
+    uint64_t count = 0;
+    for (const auto& worker : workers)
+    {
+        count += worker->lateTicks.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+uint64_t ArcadeServer::getBytesSent() const
+{
+    uint64_t count = 0;
+    for (const auto& worker : workers)
+    {
+        count += worker->bytesSent.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+void ArcadeServer::acceptConnections()
+{
+    while (true)
+    {
+        const int socket = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (socket < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+            {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                std::cerr << "Failed to accept a connection: " << std::strerror(errno)
+                          << std::endl;
+            }
+            return;
+        }
+
+        // Frames are small and latency-sensitive; don't let Nagle hold them back
+        const int enable = 1;
+        setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+        // Round-robin keeps the workers evenly loaded
+        Worker& worker = *workers[nextWorker];
+        nextWorker = (nextWorker + 1) % workers.size();
+        {
+            std::lock_guard<std::mutex> lock(worker.pendingMutex);
+            worker.pendingSockets.push_back(socket);
+        }
+        wake(worker.wakeFd);
+    }
+}
+
+void ArcadeServer::workerLoop(Worker& worker)
+{
+    epoll_event events[MAX_EVENTS];
+    uint64_t lastTick = 0;
+
+    while (running.load(std::memory_order_acquire))
+    {
+        // Sleep until the next shared tick unless a socket needs attention first
+        const auto deadline = startTime + tickPeriod * (lastTick + 1);
+        const auto wait = deadline - std::chrono::steady_clock::now();
+        const int timeout = static_cast<int>(std::max<long long>(
+            0, std::chrono::ceil<std::chrono::milliseconds>(wait).count()));
+
+        const int count = epoll_wait(worker.epollFd, events, MAX_EVENTS, timeout);
+        for (int i = 0; i < count; ++i)
+        {
+            const int fd = events[i].data.fd;
+            if (fd == worker.wakeFd)
+            {
+                drainWakeups(worker.wakeFd);
+                adoptSockets(worker);
+                continue;
+            }
+
+            auto found = worker.sessions.find(fd);
+            if (found == worker.sessions.end())
+            {
+                continue;
+            }
+
+            SessionSlot& slot = found->second;
+            bool keep = (events[i].events & (EPOLLERR | EPOLLHUP)) == 0;
+            if (keep && (events[i].events & EPOLLIN) != 0)
+            {
+                keep = slot.session->receive() && !slot.session->isQuitRequested();
+            }
+            if (keep && (events[i].events & EPOLLOUT) != 0)
+            {
+                keep = flushSession(worker, slot);
+            }
+            if (!keep)
+            {
+                closeSession(worker, fd);
+            }
+        }
+
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            // Ticks that passed while this worker was busy are skipped, not replayed
+            const auto currentTick = static_cast<uint64_t>((now - startTime) / tickPeriod);
+            if (currentTick > lastTick + 1)
+            {
+                worker.lateTicks.fetch_add(currentTick - lastTick - 1, std::memory_order_relaxed);
+            }
+            lastTick = currentTick;
+            tickSessions(worker);
+        }
+    }
+}
+
+void ArcadeServer::adoptSockets(Worker& worker)
+{
+    std::vector<int> sockets;
+    {
+        std::lock_guard<std::mutex> lock(worker.pendingMutex);
+        sockets.swap(worker.pendingSockets);
+    }
+
+    for (int socket : sockets)
+    {
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.fd = socket;
+        if (epoll_ctl(worker.epollFd, EPOLL_CTL_ADD, socket, &event) < 0)
+        {
+            close(socket);
+            continue;
+        }
+
+        SessionSlot slot;
+        slot.session = std::make_unique<ArcadeSession>(
+            socket, boardWidth, boardHeight, TERMINAL_COLUMNS, TERMINAL_ROWS);
+        worker.sessions[socket] = std::move(slot);
+    }
+    worker.sessionCount.store(worker.sessions.size(), std::memory_order_relaxed);
+}
+
+void ArcadeServer::tickSessions(Worker& worker)
+{
+    std::vector<int>& closed = worker.closedSockets;
+    closed.clear();
+    for (auto& [socket, slot] : worker.sessions)
+    {
+        slot.session->tick();
+        slot.session->queueFrame();
+        if (!flushSession(worker, slot))
+        {
+            closed.push_back(socket);
+        }
+    }
+
+    for (int socket : closed)
+    {
+        closeSession(worker, socket);
+    }
+}
+
+bool ArcadeServer::flushSession(Worker& worker, SessionSlot& slot)
+{
+    const long sent = slot.session->flush();
+    if (sent < 0)
+    {
+        return false;
+    }
+    worker.bytesSent.fetch_add(static_cast<uint64_t>(sent), std::memory_order_relaxed);
+
+    // Only watch for writability while a backlog exists
+    const bool pending = slot.session->hasPendingOutput();
+    if (pending != slot.watchingWrites)
+    {
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLRDHUP | (pending ? static_cast<uint32_t>(EPOLLOUT) : 0u);
+        event.data.fd = slot.session->getSocket();
+        epoll_ctl(worker.epollFd, EPOLL_CTL_MOD, slot.session->getSocket(), &event);
+        slot.watchingWrites = pending;
+    }
+    return true;
+}
+
+void ArcadeServer::closeSession(Worker& worker, int socket)
+{
+    epoll_ctl(worker.epollFd, EPOLL_CTL_DEL, socket, nullptr);
+    worker.sessions.erase(socket); // The session closes the socket
+    worker.sessionCount.store(worker.sessions.size(), std::memory_order_relaxed);
+}
+
+void ArcadeServer::shutdown()
+{
+    for (const auto& worker : workers)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+
+    // Sessions say goodbye to their clients as they are destroyed
+    for (const auto& worker : workers)
+    {
+        worker->sessions.clear();
+        for (int socket : worker->pendingSockets)
+        {
+            close(socket);
+        }
+        close(worker->epollFd);
+        close(worker->wakeFd);
+    }
+    workers.clear();
+
+    if (listenFd >= 0)
+    {
+        close(listenFd);
+        listenFd = -1;
+        if (address.find('/') != std::string::npos)
+        {
+            unlink(address.c_str());
+        }
+    }
+    if (wakeFd >= 0)
+    {
+        close(wakeFd);
+        wakeFd = -1;
+    }
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "server/ArcadeSession.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Hosts many text-mode games from one process
+ *
+ * Clients connect over TCP or a Unix socket with a raw-mode terminal (for
+ * example `stty raw -echo; nc localhost 7777`) and each get their own Game.
+ * The accepting thread hands new connections round-robin to a pool of worker
+ * threads. Each worker owns its sessions and an epoll instance, so sessions
+ * are never shared between threads. All workers tick on the same global
+ * schedule. On every tick each session advances its game and sends the ANSI
+ * deltas of its frame.
+ */
+class ArcadeServer
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param address Unix socket path, "host:port" or "port" (see ArcadeSocket)
+     */
+    explicit ArcadeServer(const std::string& address);
+
+    /**
+     * @brief Destructor stops the server
+     */
+    ~ArcadeServer();
+
+    ArcadeServer(const ArcadeServer&) = delete;
+    ArcadeServer& operator=(const ArcadeServer&) = delete;
+
+    /**
+     * @brief Set the number of worker threads (before start())
+     * @param count Worker count; 0 uses one per hardware thread
+     */
+    void setWorkerCount(int count);
+
+    /**
+     * @brief Set the shared tick rate (before start())
+     * @param ticksPerSecond Game ticks per second
+     */
+    void setTickRate(float ticksPerSecond);
+
+    /**
+     * @brief Set the board size of new sessions (before start())
+     * @param width Board width in cells
+     * @param height Board height in cells
+     */
+    void setBoardSize(int width, int height);
+
+    /**
+     * @brief Open the listening socket and start the workers
+     * @return True if the server is running
+     */
+    bool start();
+
+    /**
+     * @brief Accept connections until stop() is called, printing statistics
+     * @param statsInterval Seconds between statistics lines; 0 disables them
+     */
+    void run(float statsInterval = 5.0f);
+
+    /**
+     * @brief Ask the server to stop; safe to call from a signal handler
+     */
+    void stop();
+
+    /**
+     * @brief Get the TCP port the server listens on
+     * @return Port number, or 0 for a Unix socket or before start()
+     */
+    [[nodiscard]] int getPort() const;
+
+    /**
+     * @brief Get the number of connected sessions
+     * @return Session count over all workers
+     */
+    [[nodiscard]] size_t getSessionCount() const;
+
+    /**
+     * @brief Get the number of ticks workers skipped because they fell behind
+     * @return Late tick count over all workers
+     */
+    [[nodiscard]] uint64_t getLateTickCount() const;
+
+    /**
+     * @brief Get the number of bytes sent to clients
+     * @return Byte count over all workers
+     */
+    [[nodiscard]] uint64_t getBytesSent() const;
+
+  private:
+    /**
+     * @brief A session and whether its socket is watched for writability
+     */
+    struct SessionSlot
+    {
+        std::unique_ptr<ArcadeSession> session;
+        bool watchingWrites = false;
+    };
+
+    /**
+     * @brief One worker thread and the sessions it owns
+     */
+    struct Worker
+    {
+        std::thread thread;
+        int epollFd = -1;
+        int wakeFd = -1; // eventfd signalling new connections or shutdown
+        std::mutex pendingMutex;
+        std::vector<int> pendingSockets; // Accepted, not yet adopted by the worker
+        std::unordered_map<int, SessionSlot> sessions;
+        std::vector<int> closedSockets; // Reused by tickSessions
+        std::atomic<size_t> sessionCount{0};
+        std::atomic<uint64_t> lateTicks{0};
+        std::atomic<uint64_t> bytesSent{0};
+    };
+
+    std::string address;
+    int listenFd;
+    int wakeFd; // eventfd waking the accepting thread on stop()
+    int workerCount;
+    int boardWidth;
+    int boardHeight;
+    std::chrono::steady_clock::duration tickPeriod;
+    std::chrono::steady_clock::time_point startTime;
+    std::atomic<bool> running;
+    std::vector<std::unique_ptr<Worker>> workers;
+    size_t nextWorker;
+
+    // Accept every pending connection and hand it to a worker
+    void acceptConnections();
+
+    // Worker thread entry point
+    void workerLoop(Worker& worker);
+
+    // Create sessions for the sockets handed to a worker
+    void adoptSockets(Worker& worker);
+
+    // Run one tick for all sessions of a worker
+    void tickSessions(Worker& worker);
+
+    // Send queued output and keep the write interest in sync with the backlog
+    bool flushSession(Worker& worker, SessionSlot& slot);
+
+    // Remove a session and close its connection
+    void closeSession(Worker& worker, int socket);
+
+    // Stop the workers and close all sockets
+    void shutdown();
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,219 @@
+#include "server/ArcadeSession.h"
+#include "renderer/AnsiFrameEncoder.h"
+#include "renderer/FrameLayout.h"
+#include "renderer/TerminalComposer.h"
+#include <cctype>
+#include <cerrno>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace GreedySnake
+{
+
+namespace
+{
+const char CTRL_C_KEY = 3;
+const char ESCAPE_KEY = 27;
+
+// Frames are skipped while more than this many bytes wait for a slow client
+const size_t MAX_PENDING_OUTPUT = 64 * 1024;
+
+// Bytes read from the socket per call
+const size_t RECEIVE_CHUNK = 256;
+} // namespace
+
+ArcadeSession::ArcadeSession(int socket, int boardWidth, int boardHeight, int columns, int rows)
+    : socket(socket),
+      game(boardWidth, boardHeight),
+      outputOffset(0),
+      escapeState(0),
+      quitRequested(false)
+{
+    game.initialize();
+    cells.resize(columns, rows);
+    AnsiFrameEncoder::beginSession(output);
+}
+
+ArcadeSession::~ArcadeSession()
+{
+    if (socket < 0)
+    {
+        return;
+    }
+
+    // Restore the client's terminal if the socket still takes data
+    std::string goodbye;
+    AnsiFrameEncoder::endSession(goodbye);
+    send(socket, goodbye.data(), goodbye.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+    close(socket);
+}
+
+int ArcadeSession::getSocket() const
+{
+    return socket;
+}
+
+bool ArcadeSession::receive()
+{
+    char buffer[RECEIVE_CHUNK];
+    while (true)
+    {
+        const ssize_t received = recv(socket, buffer, sizeof(buffer), 0);
+        if (received > 0)
+        {
+            handleKeys(buffer, static_cast<size_t>(received));
+            continue;
+        }
+        if (received == 0)
+        {
+            return false; // Client hung up
+        }
+        if (errno == EINTR)
+        {
+            continue;
+        }
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+}
+
+void ArcadeSession::handleKeys(const char* data, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        const char key = data[i];
+
+        // Arrow keys arrive as ESC [ A..D; after a bare ESC the key is handled normally
+        if (escapeState == 1)
+        {
+            escapeState = 0;
+            if (key == '[')
+            {
+                escapeState = 2;
+                continue;
+            }
+        }
+        if (escapeState == 2)
+        {
+            escapeState = 0;
+            switch (key)
+            {
+            case 'A':
+                game.processKeyPress('w');
+                break;
+            case 'B':
+                game.processKeyPress('s');
+                break;
+            case 'C':
+                game.processKeyPress('d');
+                break;
+            case 'D':
+                game.processKeyPress('a');
+                break;
+            default:
+                break;
+            }
+            continue;
+        }
+
+        switch (std::tolower(static_cast<unsigned char>(key)))
+        {
+        case ESCAPE_KEY:
+            escapeState = 1;
+            break;
+        case 'w':
+        case 'a':
+        case 's':
+        case 'd':
+        case 'p':
+        case 'r':
+            game.processKeyPress(std::tolower(static_cast<unsigned char>(key)));
+            break;
+        case 'q':
+        case CTRL_C_KEY:
+            quitRequested = true;
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void ArcadeSession::tick()
+{
+    // Terminals send a sequence in one go; an ESC still open a tick later was a bare ESC
+    escapeState = 0;
+
+    if (!game.isPaused() && !game.isGameOver())
+    {
+        game.update();
+    }
+}
+
+size_t ArcadeSession::queueFrame()
+{
+    // Let a slow client catch up; the cell buffer keeps track of what it was sent
+    if (output.size() - outputOffset > MAX_PENDING_OUTPUT)
+    {
+        return 0;
+    }
+
+    snapshot.captureGame(game);
+    FrameLayout::layoutGame(snapshot, commands);
+    TerminalComposer::compose(commands, cells);
+
+    const size_t before = output.size();
+    AnsiFrameEncoder::encodeFrame(cells, output);
+    return output.size() - before;
+}
+
+long ArcadeSession::flush()
+{
+    size_t sent = 0;
+    while (outputOffset < output.size())
+    {
+        const ssize_t written = send(socket,
+                                     output.data() + outputOffset,
+                                     output.size() - outputOffset,
+                                     MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (written > 0)
+        {
+            outputOffset += static_cast<size_t>(written);
+            sent += static_cast<size_t>(written);
+            continue;
+        }
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            break;
+        }
+        return -1;
+    }
+
+    // Reuse the buffer from the start once everything went out
+    if (outputOffset == output.size())
+    {
+        output.clear();
+        outputOffset = 0;
+    }
+    return static_cast<long>(sent);
+}
+
+bool ArcadeSession::hasPendingOutput() const
+{
+    return outputOffset < output.size();
+}
+
+bool ArcadeSession::isQuitRequested() const
+{
+    return quitRequested;
+}
+
+const Game& ArcadeSession::getGame() const
+{
+    return game;
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "game/Game.h"
+#include "renderer/RenderCommandBuffer.h"
+#include "renderer/RenderSnapshot.h"
+#include "renderer/TerminalCellBuffer.h"
+#include <cstddef>
+#include <string>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief One remote player of the terminal arcade
+ *
+ * Owns the connection, the player's Game and the terminal the client is
+ * assumed to have. Frames are laid out and composed exactly like the local
+ * ncurses renderer does, but sent as ANSI deltas, so a tick costs only the
+ * bytes of the cells that changed. When the client reads too slowly, new
+ * frames are skipped until its backlog drains; the next frame then carries
+ * every change since the last one it received.
+ */
+class ArcadeSession
+{
+  public:
+    /**
+     * @brief Constructor; the session takes ownership of the socket
+     * @param socket Connected, non-blocking socket
+     * @param boardWidth Board width in cells
+     * @param boardHeight Board height in cells
+     * @param columns Client terminal width
+     * @param rows Client terminal height
+     */
+    ArcadeSession(int socket, int boardWidth, int boardHeight, int columns, int rows);
+
+    /**
+     * @brief Destructor restores the client terminal (best effort) and closes the socket
+     */
+    ~ArcadeSession();
+
+    ArcadeSession(const ArcadeSession&) = delete;
+    ArcadeSession& operator=(const ArcadeSession&) = delete;
+
+    /**
+     * @brief Get the socket
+     * @return Socket descriptor
+     */
+    [[nodiscard]] int getSocket() const;
+
+    /**
+     * @brief Read everything the client sent and apply its keys
+     * @return False if the connection was closed or failed
+     */
+    bool receive();
+
+    /**
+     * @brief Apply keys received from the client
+     *
+     * WASD and arrow keys steer, P pauses, R restarts after a game over,
+     * Q or Ctrl+C ends the session.
+     *
+     * @param data Raw bytes from the client
+     * @param size Number of bytes
+     */
+    void handleKeys(const char* data, size_t size);
+
+    /**
+     * @brief Advance the game by one tick unless it is paused or over
+     *
+     * Also drops an unfinished escape sequence, so a bare ESC never holds on
+     * to the keys that follow it.
+     */
+    void tick();
+
+    /**
+     * @brief Compose the current frame and queue its changes for sending
+     * @return Number of bytes queued (0 if nothing changed or the frame was skipped)
+     */
+    size_t queueFrame();
+
+    /**
+     * @brief Send as much queued output as the socket accepts
+     * @return Number of bytes sent, or -1 if the connection failed
+     */
+    long flush();
+
+    /**
+     * @brief Check if output is waiting for the socket to become writable
+     * @return True if queued bytes remain
+     */
+    [[nodiscard]] bool hasPendingOutput() const;
+
+    /**
+     * @brief Check if the player asked to leave
+     * @return True once Q or Ctrl+C was received
+     */
+    [[nodiscard]] bool isQuitRequested() const;
+
+    /**
+     * @brief Get the player's game
+     * @return Reference to the game
+     */
+    [[nodiscard]] const Game& getGame() const;
+
+  private:
+    int socket;
+    Game game;
+    RenderSnapshot snapshot;
+    RenderCommandBuffer commands;
+    TerminalCellBuffer cells;
+    std::string output;  // Queued bytes; sending resumes at outputOffset
+    size_t outputOffset;
+    int escapeState;     // Progress through an arrow key escape sequence
+    bool quitRequested;
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,177 @@
+#include "server/ArcadeSocket.h"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <netinet/in.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace GreedySnake
+{
+
+namespace
+{
+const int LISTEN_BACKLOG = 4096;
+
+/**
+ * @brief A parsed socket address
+ */
+struct ParsedAddress
+{
+    sockaddr_storage storage;
+    socklen_t length;
+    int family;
+};
+
+bool parseAddress(const std::string& address, ParsedAddress& parsed)
+{
+    std::memset(&parsed.storage, 0, sizeof(parsed.storage));
+
+    if (address.find('/') != std::string::npos)
+    {
+        auto* unixAddress = reinterpret_cast<sockaddr_un*>(&parsed.storage);
+        if (address.size() >= sizeof(unixAddress->sun_path))
+        {
+            std::cerr << "Socket path too long: " << address << std::endl;
+            return false;
+        }
+        unixAddress->sun_family = AF_UNIX;
+        std::memcpy(unixAddress->sun_path, address.c_str(), address.size() + 1);
+        parsed.length = sizeof(sockaddr_un);
+        parsed.family = AF_UNIX;
+        return true;
+    }
+
+    // "host:port" or just "port" on the loopback interface
+    std::string host = "127.0.0.1";
+    std::string port = address;
+    const size_t colon = address.rfind(':');
+    if (colon != std::string::npos)
+    {
+        host = address.substr(0, colon);
+        port = address.substr(colon + 1);
+    }
+
+    auto* inetAddress = reinterpret_cast<sockaddr_in*>(&parsed.storage);
+    inetAddress->sin_family = AF_INET;
+    char* end = nullptr;
+    const long portNumber = std::strtol(port.c_str(), &end, 10);
+    if (port.empty() || *end != '\0' || portNumber < 0 || portNumber > 65535 ||
+        inet_pton(AF_INET, host.c_str(), &inetAddress->sin_addr) != 1)
+    {
+        std::cerr << "Invalid address: " << address << std::endl;
+        return false;
+    }
+    inetAddress->sin_port = htons(static_cast<uint16_t>(portNumber));
+    parsed.length = sizeof(sockaddr_in);
+    parsed.family = AF_INET;
+    return true;
+}
+} // namespace
+
+int ArcadeSocket::listenOn(const std::string& address)
+{
+    ParsedAddress parsed;
+    if (!parseAddress(address, parsed))
+    {
+        return -1;
+    }
+
+    const int socketFd = socket(parsed.family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (socketFd < 0)
+    {
+        std::cerr << "Failed to create socket: " << std::strerror(errno) << std::endl;
+        return -1;
+    }
+
+    if (parsed.family == AF_UNIX)
+    {
+        // A stale socket file from an earlier run would make bind() fail
+        unlink(address.c_str());
+    }
+    else
+    {
+        const int enable = 1;
+        setsockopt(socketFd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+    }
+
+    if (bind(socketFd, reinterpret_cast<sockaddr*>(&parsed.storage), parsed.length) < 0 ||
+        listen(socketFd, LISTEN_BACKLOG) < 0)
+    {
+        std::cerr << "Failed to listen on " << address << ": " << std::strerror(errno)
+                  << std::endl;
+        close(socketFd);
+        return -1;
+    }
+
+    return socketFd;
+}
+
+int ArcadeSocket::connectTo(const std::string& address)
+{
+    ParsedAddress parsed;
+    if (!parseAddress(address, parsed))
+    {
+        return -1;
+    }
+
+    const int socketFd = socket(parsed.family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (socketFd < 0)
+    {
+        std::cerr << "Failed to create socket: " << std::strerror(errno) << std::endl;
+        return -1;
+    }
+
+    if (connect(socketFd, reinterpret_cast<sockaddr*>(&parsed.storage), parsed.length) < 0 &&
+        errno != EINPROGRESS && errno != EAGAIN)
+    {
+        std::cerr << "Failed to connect to " << address << ": " << std::strerror(errno)
+                  << std::endl;
+        close(socketFd);
+        return -1;
+    }
+
+    return socketFd;
+}
+
+int ArcadeSocket::getLocalPort(int socket)
+{
+    sockaddr_storage storage;
+    socklen_t length = sizeof(storage);
+    if (getsockname(socket, reinterpret_cast<sockaddr*>(&storage), &length) < 0 ||
+        storage.ss_family != AF_INET)
+    {
+        return 0;
+    }
+    return ntohs(reinterpret_cast<sockaddr_in*>(&storage)->sin_port);
+}
+
+bool ArcadeSocket::setNonBlocking(int socket)
+{
+    const int flags = fcntl(socket, F_GETFL, 0);
+    return flags >= 0 && fcntl(socket, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+long ArcadeSocket::raiseFileLimit()
+{
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) != 0)
+    {
+        return -1;
+    }
+
+    if (limit.rlim_cur < limit.rlim_max)
+    {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+        getrlimit(RLIMIT_NOFILE, &limit);
+    }
+    return static_cast<long>(limit.rlim_cur);
+}
+
+} // namespace GreedySnake
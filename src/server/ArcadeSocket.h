@@ -0,0 +1,56 @@
+#pragma once
+
+#include <string>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Socket helpers shared by the arcade server and its load-test client
+ *
+ * Addresses are either a Unix socket path (anything containing '/') or a TCP
+ * "host:port" / "port"; a bare port means the loopback interface. All sockets
+ * are non-blocking and errors are reported on std::cerr with -1 returned.
+ */
+class ArcadeSocket
+{
+  public:
+    /**
+     * @brief Open a listening socket
+     * @param address Unix socket path, "host:port" or "port" (0 picks a free port)
+     * @return Listening socket, or -1 on failure
+     */
+    static int listenOn(const std::string& address);
+
+    /**
+     * @brief Start connecting to a listening socket
+     * @param address Unix socket path, "host:port" or "port"
+     * @return Socket whose connection may still be in progress, or -1 on failure
+     */
+    static int connectTo(const std::string& address);
+
+    /**
+     * @brief Get the TCP port a socket is bound to
+     * @param socket Bound socket
+     * @return Port number, or 0 for non-TCP sockets
+     */
+    static int getLocalPort(int socket);
+
+    /**
+     * @brief Make a socket non-blocking
+     * @param socket Socket to change
+     * @return True on success
+     */
+    static bool setNonBlocking(int socket);
+
+    /**
+     * @brief Raise the open file limit to the hard limit
+     *
+     * Thousands of sessions need more descriptors than the usual default of 1024.
+     *
+     * @return The new soft limit
+     */
+    static long raiseFileLimit();
+};
+
+} // namespace GreedySnake
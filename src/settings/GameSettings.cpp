@@ -9,6 +9,7 @@ GameSettings::GameSettings()
     : gameSpeed(5),      // Medium speed by default
       boardWidth(20),    // Default board width
       boardHeight(20),   // Default board height
+      foodCount(1),      // A single food item by default
       borders(true),     // Border collisions enabled by default
       walls(false),      // Walls disabled by default
       soundEnabled(true) // Sound enabled by default
@@ -45,6 +46,16 @@ void GameSettings::setBoardHeight(int height)
     boardHeight = clamp(height, 10, 100); // Minimum size 10, maximum reasonable size 100
 }
 
+int GameSettings::getFoodCount() const
+{
+    return foodCount;
+}
+
+void GameSettings::setFoodCount(int count)
+{
+    foodCount = clamp(count, 1, 5000); // Feeding frenzy boards hold thousands
+}
+
 bool GameSettings::hasBorders() const
 {
     return borders;
@@ -89,6 +100,7 @@ bool GameSettings::saveToFile(const std::string& filename) const
         file << "gameSpeed=" << gameSpeed << '\n';
         file << "boardWidth=" << boardWidth << '\n';
         file << "boardHeight=" << boardHeight << '\n';
+        file << "foodCount=" << foodCount << '\n';
         file << "borders=" << (borders ? "true" : "false") << '\n';
         file << "walls=" << (walls ? "true" : "false") << '\n';
         file << "soundEnabled=" << (soundEnabled ? "true" : "false") << '\n';
@@ -160,6 +172,17 @@ bool GameSettings::loadFromFile(const std::string& filename)
                     // Ignore conversion errors
                 }
             }
+            else if (key == "foodCount")
+            {
+                try
+                {
+                    setFoodCount(std::stoi(value));
+                }
+                catch (...)
+                {
+                    // Ignore conversion errors
+                }
+            }
             else if (key == "borders")
             {
                 setBorders(value == "true");
@@ -57,6 +57,18 @@ class GameSettings
      */
     void setBoardHeight(int height);
 
+    /**
+     * @brief Get the number of food items on the board at once
+     * @return The food count
+     */
+    [[nodiscard]] int getFoodCount() const;
+
+    /**
+     * @brief Set the number of food items on the board at once
+     * @param count The new food count (1-5000, will be clamped to this range)
+     */
+    void setFoodCount(int count);
+
     /**
      * @brief Check if border collisions are enabled
      * @return True if borders are enabled, false otherwise
@@ -111,6 +123,7 @@ class GameSettings
     int gameSpeed;     // Game speed (1-10)
     int boardWidth;    // Board width
     int boardHeight;   // Board height
+    int foodCount;     // Food items on the board at once
     bool borders;      // Border collisions enabled
     bool walls;        // Walls enabled
     bool soundEnabled; // Sound enabled
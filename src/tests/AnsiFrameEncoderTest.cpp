@@ -0,0 +1,46 @@
+#include "renderer/AnsiFrameEncoder.h"
+#include "renderer/TerminalComposer.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+// Test that a frame moves the cursor only where needed and sets colors once per run
+TEST(AnsiFrameEncoderTest, EncodesChangedCells)
+{
+    TerminalCellBuffer cells;
+    cells.resize(4, 2);
+    std::string output;
+    AnsiFrameEncoder::encodeFrame(cells, output);
+
+    cells.drawText(1, 1, "ab", TerminalComposer::FOOD_COLOR, true);
+    output.clear();
+    EXPECT_EQ(AnsiFrameEncoder::encodeFrame(cells, output), 2u);
+    EXPECT_EQ(output, "\x1b[2;2H\x1b[0;1;31mab\x1b[0m\x1b[H");
+}
+
+// Test that encoding an unchanged frame produces nothing
+TEST(AnsiFrameEncoderTest, UnchangedFrameIsEmpty)
+{
+    TerminalCellBuffer cells;
+    cells.resize(4, 2);
+    cells.drawText(0, 0, "hi", TerminalComposer::TEXT_COLOR);
+    std::string output;
+    EXPECT_EQ(AnsiFrameEncoder::encodeFrame(cells, output), 8u);
+
+    output.clear();
+    EXPECT_EQ(AnsiFrameEncoder::encodeFrame(cells, output), 0u);
+    EXPECT_TRUE(output.empty());
+}
+
+// Test the session start and end sequences
+TEST(AnsiFrameEncoderTest, SessionSequences)
+{
+    std::string output;
+    AnsiFrameEncoder::beginSession(output);
+    EXPECT_EQ(output.find("\x1b[?25l"), 0u);
+    EXPECT_NE(output.find("\x1b[2J"), std::string::npos);
+
+    output.clear();
+    AnsiFrameEncoder::endSession(output);
+    EXPECT_NE(output.find("\x1b[?25h"), std::string::npos);
+}
@@ -0,0 +1,103 @@
+#include "server/ArcadeLoadTest.h"
+#include "server/ArcadeServer.h"
+#include "server/ArcadeSocket.h"
+#include <chrono>
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace GreedySnake;
+
+namespace
+{
+// Wait until a condition holds or a second has passed
+template <typename Condition> bool waitFor(Condition condition)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+} // namespace
+
+// Test that a client connecting over TCP gets a session streaming frames
+TEST(ArcadeServerTest, StreamsFramesOverTcp)
+{
+    ArcadeServer server("127.0.0.1:0");
+    server.setWorkerCount(2);
+    server.setTickRate(50.0f);
+    ASSERT_TRUE(server.start());
+    ASSERT_GT(server.getPort(), 0);
+
+    std::thread acceptor([&server]() { server.run(0.0f); });
+
+    const int client = ArcadeSocket::connectTo("127.0.0.1:" + std::to_string(server.getPort()));
+    ASSERT_GE(client, 0);
+    EXPECT_TRUE(waitFor([&server]() { return server.getSessionCount() == 1; }));
+
+    std::string received;
+    EXPECT_TRUE(waitFor([&]() {
+        char buffer[4096];
+        const ssize_t count = recv(client, buffer, sizeof(buffer), 0);
+        if (count > 0)
+        {
+            received.append(buffer, static_cast<size_t>(count));
+        }
+        return received.find("Score:") != std::string::npos;
+    }));
+    EXPECT_GT(server.getBytesSent(), 0u);
+
+    // Quitting ends the session
+    ASSERT_EQ(send(client, "q", 1, MSG_NOSIGNAL), 1);
+    EXPECT_TRUE(waitFor([&server]() { return server.getSessionCount() == 0; }));
+
+    server.stop();
+    acceptor.join();
+    close(client);
+}
+
+// Test that the server also listens on Unix sockets and cleans up the path
+TEST(ArcadeServerTest, ListensOnUnixSocket)
+{
+    const std::string path = "/tmp/greedy_snake_arcade_test.sock";
+    {
+        ArcadeServer server(path);
+        ASSERT_TRUE(server.start());
+        EXPECT_EQ(server.getPort(), 0);
+
+        const int client = ArcadeSocket::connectTo(path);
+        ASSERT_GE(client, 0);
+        close(client);
+    }
+    EXPECT_NE(access(path.c_str(), F_OK), 0);
+}
+
+// Test that the load test tells failed connections apart from dropped sessions
+TEST(ArcadeServerTest, LoadTestCountsFailedConnections)
+{
+    ArcadeLoadTest unreachable("/tmp/greedy_snake_no_such_server.sock");
+    EXPECT_FALSE(unreachable.run(3, 0.0f));
+    EXPECT_EQ(unreachable.getConnectedCount(), 0u);
+    EXPECT_EQ(unreachable.getFailedCount(), 3u);
+    EXPECT_EQ(unreachable.getDroppedCount(), 0u);
+
+    ArcadeServer server("127.0.0.1:0");
+    ASSERT_TRUE(server.start());
+    std::thread acceptor([&server]() { server.run(0.0f); });
+
+    ArcadeLoadTest loadTest("127.0.0.1:" + std::to_string(server.getPort()));
+    EXPECT_TRUE(loadTest.run(3, 0.2f));
+    EXPECT_EQ(loadTest.getConnectedCount(), 3u);
+    EXPECT_EQ(loadTest.getFailedCount(), 0u);
+    EXPECT_EQ(loadTest.getDroppedCount(), 0u);
+
+    server.stop();
+    acceptor.join();
+}
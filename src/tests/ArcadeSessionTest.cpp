@@ -0,0 +1,91 @@
+#include "server/ArcadeSession.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace GreedySnake;
+
+// A session talking to the test over a socket pair
+class ArcadeSessionTest : public ::testing::Test
+{
+  protected:
+    int client = -1;
+    std::unique_ptr<ArcadeSession> session;
+
+    void SetUp() override
+    {
+        int sockets[2];
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, sockets), 0);
+        client = sockets[0];
+        session = std::make_unique<ArcadeSession>(sockets[1], 20, 20, 80, 24);
+    }
+
+    void TearDown() override
+    {
+        session.reset();
+        close(client);
+    }
+
+    // Read everything the session sent so far
+    std::string readAll() const
+    {
+        std::string received;
+        char buffer[4096];
+        ssize_t count;
+        while ((count = recv(client, buffer, sizeof(buffer), 0)) > 0)
+        {
+            received.append(buffer, static_cast<size_t>(count));
+        }
+        return received;
+    }
+};
+
+// Test that the first frame is drawn in full and an unchanged one is not sent
+TEST_F(ArcadeSessionTest, SendsFrameDeltas)
+{
+    EXPECT_GT(session->queueFrame(), 0u);
+    EXPECT_GT(session->flush(), 0);
+    EXPECT_FALSE(session->hasPendingOutput());
+
+    const std::string frame = readAll();
+    EXPECT_NE(frame.find("Score: 0"), std::string::npos);
+
+    EXPECT_EQ(session->queueFrame(), 0u);
+}
+
+// Test key handling from the client socket
+TEST_F(ArcadeSessionTest, HandlesKeys)
+{
+    const std::string keys = "\x1b[Ap";
+    ASSERT_EQ(send(client, keys.data(), keys.size(), 0), static_cast<ssize_t>(keys.size()));
+    EXPECT_TRUE(session->receive());
+
+    EXPECT_EQ(session->getGame().getSnake().getCurrentDirection(), Direction::UP);
+    EXPECT_TRUE(session->getGame().isPaused());
+    EXPECT_FALSE(session->isQuitRequested());
+
+    session->handleKeys("q", 1);
+    EXPECT_TRUE(session->isQuitRequested());
+}
+
+// Test that a bare ESC does not swallow the key after it
+TEST_F(ArcadeSessionTest, BareEscapeKeepsNextKey)
+{
+    session->handleKeys("\x1bp", 2);
+    EXPECT_TRUE(session->getGame().isPaused());
+
+    // An ESC left open until the next tick is dropped too
+    session->handleKeys("\x1b", 1);
+    session->tick();
+    session->handleKeys("p", 1);
+    EXPECT_FALSE(session->getGame().isPaused());
+}
+
+// Test that a hang-up is reported
+TEST_F(ArcadeSessionTest, DetectsHangUp)
+{
+    EXPECT_TRUE(session->receive());
+    shutdown(client, SHUT_WR);
+    EXPECT_FALSE(session->receive());
+}
@@ -0,0 +1,83 @@
+#include "audio/AudioEngine.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+using namespace GreedySnake;
+
+// Test that every effect synthesizes a short, non-silent, click-free buffer
+TEST(AudioEngineTest, GeneratesSamplesForEveryEffect)
+{
+    for (size_t effect = 0; effect < AudioEngine::EFFECT_COUNT; ++effect)
+    {
+        const std::vector<int16_t> samples =
+            AudioEngine::generateSamples(static_cast<SoundEffect>(effect));
+        ASSERT_FALSE(samples.empty()) << "effect " << effect;
+        EXPECT_LE(samples.size(), AudioEngine::SAMPLE_RATE) << "effect " << effect;
+
+        const auto loudest = std::max_element(
+            samples.begin(), samples.end(), [](int16_t a, int16_t b) {
+                return std::abs(a) < std::abs(b);
+            });
+        EXPECT_GT(std::abs(*loudest), 1000) << "effect " << effect;
+
+        // Faded in and out
+        EXPECT_EQ(samples.front(), 0) << "effect " << effect;
+        EXPECT_LT(std::abs(samples.back()), 1000) << "effect " << effect;
+    }
+
+    EXPECT_TRUE(AudioEngine::generateSamples(SoundEffect::COUNT).empty());
+}
+
+// Test that effects are only queued while sound is enabled
+TEST(AudioEngineTest, DisabledEngineIgnoresEffects)
+{
+    AudioEngine audio;
+    EXPECT_FALSE(audio.isEnabled());
+    audio.play(SoundEffect::EAT);
+    EXPECT_EQ(audio.getPendingCount(), 0u);
+
+    audio.setEnabled(true);
+    EXPECT_TRUE(audio.isEnabled());
+    audio.play(SoundEffect::EAT);
+    audio.play(SoundEffect::TURN);
+    EXPECT_EQ(audio.getPendingCount(), 2u);
+    EXPECT_EQ(audio.getDroppedCount(), 0u);
+}
+
+// Test that a full queue drops effects instead of blocking the caller
+TEST(AudioEngineTest, DropsEffectsWhenQueueIsFull)
+{
+    AudioEngine audio;
+    audio.setEnabled(true);
+
+    // Without a mixer thread nothing drains the queue
+    const size_t attempts = AudioEngine::QUEUE_SIZE * 2;
+    for (size_t i = 0; i < attempts; ++i)
+    {
+        audio.play(SoundEffect::MENU_MOVE);
+    }
+    EXPECT_EQ(audio.getPendingCount(), AudioEngine::QUEUE_SIZE);
+    EXPECT_EQ(audio.getDroppedCount(), attempts - AudioEngine::QUEUE_SIZE);
+}
+
+// Test that the mixer thread drains queued effects into voices
+TEST(AudioEngineTest, MixerDrainsQueue)
+{
+    AudioEngine audio;
+    ASSERT_TRUE(audio.initialize());
+    audio.setEnabled(true);
+    for (int i = 0; i < 10; ++i)
+    {
+        audio.play(SoundEffect::EAT);
+    }
+
+    for (int i = 0; i < 1000 && audio.getPendingCount() > 0; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(audio.getPendingCount(), 0u);
+    audio.shutdown();
+}
@@ -0,0 +1,41 @@
+#include "game/Autopilot.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+class AutopilotTest : public ::testing::Test
+{
+  protected:
+    Game game{20, 20, 3};
+
+    void SetUp() override
+    {
+        game.initialize();
+    }
+};
+
+// The autopilot turns before running into the wall ahead
+TEST_F(AutopilotTest, AvoidsWallAhead)
+{
+    const int lastColumn = game.getBoard().getWidth() - 2;
+    while (!game.isGameOver() && game.getSnake().getHead().x < lastColumn)
+    {
+        game.update();
+    }
+    ASSERT_FALSE(game.isGameOver());
+    ASSERT_EQ(game.getSnake().getCurrentDirection(), Direction::RIGHT);
+
+    EXPECT_NE(Autopilot::chooseDirection(game), Direction::RIGHT);
+    EXPECT_NE(Autopilot::chooseDirection(game), Direction::LEFT);
+}
+
+// Left to itself, a steered game reaches food
+TEST_F(AutopilotTest, SteeredGameEats)
+{
+    for (int tick = 0; tick < 500 && !game.isGameOver() && game.getScore() == 0; ++tick)
+    {
+        Autopilot::steer(game);
+        game.update();
+    }
+    EXPECT_GT(game.getScore(), 0);
+}
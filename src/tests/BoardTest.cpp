@@ -79,4 +79,52 @@ TEST_F(BoardTest, Reset)
     // Check that cells are now EMPTY
     EXPECT_EQ(standardBoard.getCellType(Position(1, 1)), CellType::EMPTY);
     EXPECT_EQ(standardBoard.getCellType(Position(5, 5)), CellType::EMPTY);
-}
\ No newline at end of file
+}
+
+// Test resizing the board
+TEST_F(BoardTest, Resize)
+{
+    standardBoard.resize(6, 4);
+    standardBoard.reset();
+    EXPECT_EQ(standardBoard.getWidth(), 6);
+    EXPECT_EQ(standardBoard.getHeight(), 4);
+    EXPECT_EQ(standardBoard.getCellType(Position(5, 3)), CellType::WALL);
+    EXPECT_EQ(standardBoard.getCellType(Position(4, 2)), CellType::EMPTY);
+    EXPECT_FALSE(standardBoard.isWithinBounds(Position(6, 0)));
+
+    // Same size keeps the cells until the next reset
+    standardBoard.setCellType(Position(2, 2), CellType::FOOD);
+    standardBoard.resize(6, 4);
+    EXPECT_EQ(standardBoard.getCellType(Position(2, 2)), CellType::FOOD);
+}
+
+// Test that the empty cell list follows the grid
+TEST_F(BoardTest, EmptyCells)
+{
+    Board board(5, 5);
+    EXPECT_EQ(board.getEmptyCellCount(), 9u);
+
+    board.setCellType(Position(1, 1), CellType::SNAKE);
+    board.setCellType(Position(2, 2), CellType::FOOD);
+    board.setCellType(Position(2, 2), CellType::SNAKE);
+    EXPECT_EQ(board.getEmptyCellCount(), 7u);
+    board.setCellType(Position(1, 1), CellType::EMPTY);
+    board.setCellType(Position(1, 1), CellType::EMPTY);
+    EXPECT_EQ(board.getEmptyCellCount(), 8u);
+
+    // Every listed cell is empty and listed once
+    std::vector<bool> seen(25, false);
+    for (size_t i = 0; i < board.getEmptyCellCount(); ++i)
+    {
+        const Position cell = board.getEmptyCell(i);
+        EXPECT_EQ(board.getCellType(cell), CellType::EMPTY);
+        EXPECT_FALSE(seen[cell.y * 5 + cell.x]);
+        seen[cell.y * 5 + cell.x] = true;
+    }
+
+    board.reset();
+    EXPECT_EQ(board.getEmptyCellCount(), 9u);
+    board.resize(6, 4);
+    board.reset();
+    EXPECT_EQ(board.getEmptyCellCount(), 8u);
+}
@@ -0,0 +1,109 @@
+#include "game/EntityStore.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+// Test that components are stored densely in creation order
+TEST(EntityStoreTest, CreateAndRead)
+{
+    EntityStore store;
+    EXPECT_EQ(store.size(), 0u);
+
+    const EntityStore::EntityId food = store.create(EntityKind::FOOD, Position(1, 2), 5, 0);
+    const EntityStore::EntityId rock = store.create(EntityKind::OBSTACLE, Position(3, 4), 0, 40);
+    EXPECT_NE(food, EntityStore::INVALID_ENTITY);
+    EXPECT_NE(food, rock);
+    ASSERT_EQ(store.size(), 2u);
+
+    EXPECT_EQ(store.getIds()[0], food);
+    EXPECT_EQ(store.getPositions()[0], Position(1, 2));
+    EXPECT_EQ(store.getKinds()[0], EntityKind::FOOD);
+    EXPECT_EQ(store.getValues()[0], 5);
+    EXPECT_EQ(store.getExpiries()[0], EntityStore::NO_EXPIRY);
+    EXPECT_EQ(store.getKinds()[1], EntityKind::OBSTACLE);
+    EXPECT_EQ(store.getExpiries()[1], 40u);
+
+    EXPECT_EQ(store.indexOf(rock), 1u);
+    EXPECT_EQ(store.countKind(EntityKind::FOOD), 1u);
+    EXPECT_EQ(store.countKind(EntityKind::OBSTACLE), 1u);
+}
+
+// Test that removal keeps the arrays packed and other ids valid
+TEST(EntityStoreTest, DestroyMovesLastIntoPlace)
+{
+    EntityStore store;
+    const EntityStore::EntityId first = store.create(EntityKind::FOOD, Position(1, 1), 1, 0);
+    const EntityStore::EntityId second = store.create(EntityKind::FOOD, Position(2, 2), 2, 0);
+    const EntityStore::EntityId third = store.create(EntityKind::FOOD, Position(3, 3), 3, 0);
+
+    EXPECT_TRUE(store.destroy(first));
+    EXPECT_FALSE(store.destroy(first));
+    EXPECT_FALSE(store.contains(first));
+    ASSERT_EQ(store.size(), 2u);
+
+    // The last entity took the freed index
+    EXPECT_EQ(store.indexOf(third), 0u);
+    EXPECT_EQ(store.getPositions()[0], Position(3, 3));
+    EXPECT_EQ(store.getValues()[0], 3);
+    EXPECT_EQ(store.indexOf(second), 1u);
+    EXPECT_EQ(store.indexOf(first), store.size());
+
+    store.setPosition(store.indexOf(second), Position(5, 5));
+    EXPECT_EQ(store.getPositions()[1], Position(5, 5));
+}
+
+// Test that recycled slots don't revive old ids
+TEST(EntityStoreTest, StaleIds)
+{
+    EntityStore store;
+    const EntityStore::EntityId old = store.create(EntityKind::FOOD, Position(1, 1), 1, 0);
+    store.destroyAt(0);
+    const EntityStore::EntityId reused = store.create(EntityKind::OBSTACLE, Position(2, 2), 0, 0);
+    EXPECT_NE(old, reused);
+    EXPECT_FALSE(store.contains(old));
+    EXPECT_TRUE(store.contains(reused));
+    EXPECT_FALSE(store.contains(EntityStore::INVALID_ENTITY));
+
+    store.clear();
+    EXPECT_EQ(store.size(), 0u);
+    EXPECT_FALSE(store.contains(reused));
+}
+
+// Test that a slot recycled many times still rejects its old ids
+TEST(EntityStoreTest, StaleIdsAfterManyReuses)
+{
+    EntityStore store;
+    const EntityStore::EntityId first = store.create(EntityKind::FOOD, Position(1, 1), 1, 0);
+    store.destroyAt(0);
+    for (int i = 0; i < 1000; ++i)
+    {
+        store.destroy(store.create(EntityKind::FOOD, Position(1, 1), 1, 0));
+    }
+    const EntityStore::EntityId latest = store.create(EntityKind::FOOD, Position(1, 1), 1, 0);
+    EXPECT_FALSE(store.contains(first));
+    EXPECT_TRUE(store.contains(latest));
+}
+
+// Test holding many entities
+TEST(EntityStoreTest, ManyEntities)
+{
+    EntityStore store;
+    std::vector<EntityStore::EntityId> ids;
+    for (int i = 0; i < 1000; ++i)
+    {
+        ids.push_back(store.create(EntityKind::FOOD, Position(i % 50, i / 50), i, 0));
+    }
+
+    // Remove every other one; the rest keep their components
+    for (size_t i = 0; i < ids.size(); i += 2)
+    {
+        EXPECT_TRUE(store.destroy(ids[i]));
+    }
+    ASSERT_EQ(store.size(), 500u);
+    for (size_t i = 1; i < ids.size(); i += 2)
+    {
+        const size_t index = store.indexOf(ids[i]);
+        ASSERT_LT(index, store.size());
+        EXPECT_EQ(store.getValues()[index], static_cast<int>(i));
+    }
+}
@@ -12,6 +12,15 @@ class FoodTest : public ::testing::Test
     Board board{10, 10};
     Snake snake{Position(5, 5), 3, Direction::RIGHT};
     Food food{1};
+
+    // Mark the snake on the board, as the game does
+    void placeSnake()
+    {
+        for (const auto& pos : snake.getBody())
+        {
+            board.setCellType(pos, CellType::SNAKE);
+        }
+    }
 };
 
 // Test food initialization
@@ -29,9 +38,10 @@ TEST_F(FoodTest, GeneratePosition)
 {
     // Reset the board to ensure it's empty
     board.reset();
+    placeSnake();
 
     // Generate food position
-    EXPECT_TRUE(food.generatePosition(board, snake));
+    EXPECT_TRUE(food.generatePosition(board));
 
     // Check that the food position is within bounds
     Position foodPos = food.getPosition();
@@ -46,6 +56,7 @@ TEST_F(FoodTest, GeneratePositionNearlyFull)
 {
     // Reset the board
     board.reset();
+    placeSnake();
 
     // Create a set of positions to leave empty
     std::vector<Position> emptyPositions;
@@ -72,7 +83,7 @@ TEST_F(FoodTest, GeneratePositionNearlyFull)
                 }
             }
 
-            // Also keep the snake positions empty
+            // Also keep the snake on the board
             if (keepEmpty || snake.containsPosition(pos))
             {
                 continue;
@@ -84,7 +95,7 @@ TEST_F(FoodTest, GeneratePositionNearlyFull)
     }
 
     // Generate food position
-    EXPECT_TRUE(food.generatePosition(board, snake));
+    EXPECT_TRUE(food.generatePosition(board));
 
     // Food should be placed on one of our empty positions
     Position foodPos = food.getPosition();
@@ -100,14 +111,9 @@ TEST_F(FoodTest, GeneratePositionNearlyFull)
         }
     }
 
-    // If food is not on our empty positions, check it's not on the snake
-    if (!isOnValidPos)
-    {
-        EXPECT_FALSE(snake.containsPosition(foodPos));
-
-        // And check it's on an empty cell
-        EXPECT_EQ(board.getCellType(foodPos), CellType::EMPTY);
-    }
+    // The snake's cells are taken, so only our empty positions remain
+    EXPECT_TRUE(isOnValidPos);
+    EXPECT_FALSE(snake.containsPosition(foodPos));
 }
 
 // Test food generation when there's no valid position
@@ -126,5 +132,5 @@ TEST_F(FoodTest, GeneratePositionNoValidSpot)
     }
 
     // Try to generate food position - should fail
-    EXPECT_FALSE(food.generatePosition(board, snake));
+    EXPECT_FALSE(food.generatePosition(board));
 }
\ No newline at end of file
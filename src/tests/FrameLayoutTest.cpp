@@ -0,0 +1,121 @@
+#include "renderer/FrameLayout.h"
+#include "game/Game.h"
+#include "renderer/SoftwareRenderer.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+namespace
+{
+// Count the commands of one type
+size_t countCommands(const RenderCommandBuffer& commands, RenderCommand::Type type)
+{
+    size_t count = 0;
+    for (const RenderCommand& command : commands.getCommands())
+    {
+        if (command.type == type)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+} // namespace
+
+// Test the commands of a gameplay frame
+TEST(FrameLayoutTest, LaysOutGame)
+{
+    Game game(20, 15, 3);
+    game.initialize();
+
+    RenderSnapshot snapshot;
+    snapshot.captureGame(game);
+    RenderCommandBuffer commands;
+    FrameLayout::layoutGame(snapshot, commands);
+
+    ASSERT_TRUE(commands.hasBoard());
+    EXPECT_EQ(commands.getTick(), game.getTickCount());
+    EXPECT_EQ(commands.getBoardWidth(), 20);
+    EXPECT_EQ(commands.getBoardHeight(), 15);
+
+    // The camera focus is the center of the head cell
+    const Position head = game.getSnake().getHead();
+    EXPECT_FLOAT_EQ(commands.getFocusX(), head.x + 0.5f);
+    EXPECT_FLOAT_EQ(commands.getFocusY(), head.y + 0.5f);
+
+    EXPECT_EQ(countCommands(commands, RenderCommand::Type::RECT), 4u); // Border walls
+    EXPECT_EQ(countCommands(commands, RenderCommand::Type::CIRCLE), 1u);
+    EXPECT_EQ(countCommands(commands, RenderCommand::Type::SPRITE),
+              game.getSnake().getBody().size());
+
+    // The head is drawn last among the sprites so it stays on top
+    const RenderCommand* lastSprite = nullptr;
+    for (const RenderCommand& command : commands.getCommands())
+    {
+        if (command.type == RenderCommand::Type::SPRITE)
+        {
+            lastSprite = &command;
+        }
+    }
+    ASSERT_NE(lastSprite, nullptr);
+    EXPECT_EQ(static_cast<SpriteId>(lastSprite->style), SpriteId::SNAKE_HEAD);
+
+    const RenderCommand& score = commands.getCommands().back();
+    EXPECT_EQ(score.type, RenderCommand::Type::TEXT);
+    EXPECT_EQ(commands.getText(score), "Score: 0");
+}
+
+// Test the banner shown when the game is paused
+TEST(FrameLayoutTest, LaysOutPausedBanner)
+{
+    Game game(20, 15, 3);
+    game.initialize();
+    game.pause();
+
+    RenderSnapshot snapshot;
+    snapshot.captureGame(game);
+    RenderCommandBuffer commands;
+    FrameLayout::layoutGame(snapshot, commands);
+
+    const RenderCommand& banner = commands.getCommands().back();
+    EXPECT_EQ(static_cast<TextStyle>(banner.style), TextStyle::BANNER);
+    EXPECT_EQ(static_cast<TextAnchor>(banner.anchor), TextAnchor::CENTER);
+    EXPECT_EQ(commands.getText(banner), "Paused. Press P to resume");
+}
+
+// Test the commands of a menu frame
+TEST(FrameLayoutTest, LaysOutMenu)
+{
+    RenderCommandBuffer commands;
+    FrameLayout::layoutMenu("Main Menu", {"Start Game", "Exit"}, 1, "Hint", commands);
+
+    EXPECT_FALSE(commands.hasBoard());
+    const std::vector<RenderCommand>& list = commands.getCommands();
+    ASSERT_EQ(list.size(), 4u);
+    EXPECT_EQ(static_cast<TextStyle>(list[0].style), TextStyle::TITLE);
+    EXPECT_EQ(commands.getText(list[1]), "  Start Game");
+    EXPECT_EQ(static_cast<TextStyle>(list[2].style), TextStyle::SELECTED_ITEM);
+    EXPECT_EQ(commands.getText(list[2]), "> Exit");
+    EXPECT_GT(list[2].y, list[1].y);
+    EXPECT_EQ(static_cast<TextStyle>(list[3].style), TextStyle::HINT);
+    EXPECT_GT(list[3].y, list[2].y);
+}
+
+// Test that one laid-out frame replays identically in several backends
+TEST(FrameLayoutTest, SameCommandsForEveryBackend)
+{
+    Game game(20, 20, 3);
+    game.initialize();
+
+    RenderSnapshot snapshot;
+    snapshot.captureGame(game);
+    RenderCommandBuffer commands;
+    FrameLayout::layoutGame(snapshot, commands);
+
+    SoftwareRenderer direct(120, 120);
+    direct.render(game);
+    SoftwareRenderer replayed(120, 120);
+    replayed.renderCommands(commands);
+
+    EXPECT_EQ(direct.getFrame().getPixels(), replayed.getFrame().getPixels());
+}
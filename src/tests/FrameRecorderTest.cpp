@@ -0,0 +1,128 @@
+#include "renderer/FrameRecorder.h"
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace GreedySnake;
+
+class FrameRecorderTest : public ::testing::Test
+{
+  protected:
+    std::string videoPath = ::testing::TempDir() + "frame_recorder_test.y4m";
+
+    void TearDown() override
+    {
+        std::remove(videoPath.c_str());
+    }
+
+    static std::vector<uint8_t> solidFrame(int width, int height, uint8_t r, uint8_t g, uint8_t b)
+    {
+        std::vector<uint8_t> pixels;
+        for (int i = 0; i < width * height; ++i)
+        {
+            pixels.insert(pixels.end(), {r, g, b, 255});
+        }
+        return pixels;
+    }
+};
+
+// Test writing an uncompressed video
+TEST_F(FrameRecorderTest, WritesY4m)
+{
+    FrameRecorder recorder;
+    ASSERT_TRUE(recorder.start(videoPath, FrameRecorder::Format::Y4M, 4, 2, 25));
+    EXPECT_TRUE(recorder.isRecording());
+
+    std::vector<uint8_t> white = solidFrame(4, 2, 255, 255, 255);
+    std::vector<uint8_t> black = solidFrame(4, 2, 0, 0, 0);
+    EXPECT_TRUE(recorder.captureFrame(white.data()));
+    EXPECT_TRUE(recorder.captureFrame(black.data()));
+    recorder.stop();
+
+    EXPECT_FALSE(recorder.isRecording());
+    EXPECT_EQ(recorder.getCapturedFrameCount(), 2u);
+    EXPECT_EQ(recorder.getEncodedFrameCount(), 2u);
+    EXPECT_EQ(recorder.getDroppedFrameCount(), 0u);
+
+    std::ifstream file(videoPath, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    const std::string header = "YUV4MPEG2 W4 H2 F25:1 Ip A1:1 C444\n";
+    ASSERT_EQ(contents.size(), header.size() + 2 * (6 + 4 * 2 * 3));
+    EXPECT_EQ(contents.compare(0, header.size(), header), 0);
+
+    // Limited-range luma: white is 235, black is 16; chroma is neutral
+    const size_t firstFrame = header.size() + 6;
+    EXPECT_EQ(static_cast<uint8_t>(contents[firstFrame]), 235);
+    EXPECT_EQ(static_cast<uint8_t>(contents[firstFrame + 8]), 128);
+    const size_t secondFrame = firstFrame + 24 + 6;
+    EXPECT_EQ(static_cast<uint8_t>(contents[secondFrame]), 16);
+}
+
+// Test that bottom-up frames are flipped
+TEST_F(FrameRecorderTest, FlipsBottomUpFrames)
+{
+    FrameRecorder recorder;
+    ASSERT_TRUE(recorder.start(videoPath, FrameRecorder::Format::Y4M, 1, 2, 30));
+
+    // Bottom row white, top row black, stored bottom row first
+    const uint8_t pixels[] = {255, 255, 255, 255, 0, 0, 0, 255};
+    recorder.captureFrame(pixels, true);
+    recorder.stop();
+
+    std::ifstream file(videoPath, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    const size_t luma = contents.size() - 6; // Y plane of the only frame
+    EXPECT_EQ(static_cast<uint8_t>(contents[luma]), 16);
+    EXPECT_EQ(static_cast<uint8_t>(contents[luma + 1]), 235);
+}
+
+// Test that frames are dropped instead of blocking when the pool is exhausted
+TEST_F(FrameRecorderTest, DropsFramesWhenPoolIsExhausted)
+{
+    FrameRecorder recorder(2);
+    ASSERT_TRUE(recorder.start(videoPath, FrameRecorder::Format::Y4M, 2, 2));
+
+    uint8_t* first = recorder.acquireFrame();
+    uint8_t* second = recorder.acquireFrame();
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(recorder.acquireFrame(), nullptr);
+    EXPECT_EQ(recorder.getDroppedFrameCount(), 1u);
+
+    // Buffers return to the pool once encoded
+    recorder.submitFrame(first);
+    recorder.submitFrame(second);
+    recorder.stop();
+    EXPECT_EQ(recorder.getEncodedFrameCount(), 2u);
+}
+
+// Frames that can't be read back count as dropped while recording
+TEST_F(FrameRecorderTest, CountsFramesThatCannotBeRead)
+{
+    FrameRecorder recorder(2);
+    recorder.dropFrame();
+    EXPECT_EQ(recorder.getDroppedFrameCount(), 0u);
+
+    ASSERT_TRUE(recorder.start(videoPath, FrameRecorder::Format::Y4M, 2, 2));
+    recorder.dropFrame();
+    EXPECT_EQ(recorder.getDroppedFrameCount(), 1u);
+    recorder.stop();
+    EXPECT_EQ(recorder.getEncodedFrameCount(), 0u);
+}
+
+// Test the capture cadence and invalid configurations
+TEST_F(FrameRecorderTest, FrameDueAndInvalidStart)
+{
+    FrameRecorder recorder;
+    EXPECT_FALSE(recorder.isFrameDue());
+    EXPECT_EQ(recorder.acquireFrame(), nullptr);
+    EXPECT_FALSE(recorder.start(videoPath, FrameRecorder::Format::Y4M, 0, 10));
+
+    ASSERT_TRUE(recorder.start(videoPath, FrameRecorder::Format::Y4M, 2, 2, 1));
+    EXPECT_TRUE(recorder.isFrameDue());
+    EXPECT_FALSE(recorder.isFrameDue()); // Next frame is a second away
+    EXPECT_FALSE(recorder.start(videoPath, FrameRecorder::Format::Y4M, 2, 2));
+}
@@ -0,0 +1,73 @@
+#include "game/FrameScheduler.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+class FrameSchedulerTest : public ::testing::Test
+{
+  protected:
+    FrameScheduler scheduler{100.0f};
+};
+
+// Test the frame interval derived from the refresh rate
+TEST_F(FrameSchedulerTest, FrameInterval)
+{
+    EXPECT_NEAR(scheduler.getFrameInterval(), 0.01f, 1e-5f);
+
+    scheduler.setRefreshRate(50.0f);
+    EXPECT_NEAR(scheduler.getFrameInterval(), 0.02f, 1e-5f);
+
+    // Nonsensical rates are clamped
+    scheduler.setRefreshRate(0.0f);
+    EXPECT_NEAR(scheduler.getFrameInterval(), 1.0f, 1e-5f);
+}
+
+// Test that a pending tick pulls the deadline forward
+TEST_F(FrameSchedulerTest, DeadlineFollowsEarlierTick)
+{
+    // Establish the refresh phase
+    scheduler.waitForNextFrame(-1.0f);
+
+    auto now = FrameScheduler::Clock::now();
+    auto refreshDeadline = scheduler.getNextDeadline(now, -1.0f);
+    auto tickDeadline = scheduler.getNextDeadline(now, 0.001f);
+    auto lateTickDeadline = scheduler.getNextDeadline(now, 1.0f);
+
+    EXPECT_LT(tickDeadline, refreshDeadline);
+    EXPECT_EQ(lateTickDeadline, refreshDeadline);
+}
+
+// Test that waiting never returns before the deadline
+TEST_F(FrameSchedulerTest, WaitUntilIsNeverEarly)
+{
+    auto deadline = FrameScheduler::Clock::now() + std::chrono::milliseconds(5);
+    scheduler.waitUntil(deadline);
+    EXPECT_GE(FrameScheduler::Clock::now(), deadline);
+}
+
+// Test frame-time statistics
+TEST_F(FrameSchedulerTest, FrameTimeStatistics)
+{
+    // No samples yet
+    EXPECT_EQ(scheduler.getAverageFrameTime(), 0.0f);
+    EXPECT_EQ(scheduler.getFrameTimeJitter(), 0.0f);
+
+    // The first frame has no predecessor and returns a zero delta
+    EXPECT_EQ(scheduler.waitForNextFrame(-1.0f), 0.0f);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        float deltaTime = scheduler.waitForNextFrame(-1.0f);
+        EXPECT_GE(deltaTime, 0.0f);
+    }
+
+    // Frames are paced close to the refresh interval
+    EXPECT_GT(scheduler.getAverageFrameTime(), 0.005f);
+    EXPECT_LT(scheduler.getAverageFrameTime(), 0.05f);
+    EXPECT_GE(scheduler.getFrameTimeJitter(), 0.0f);
+    EXPECT_GE(scheduler.getLastWakeLateness(), 0.0f);
+
+    // Reset clears the samples
+    scheduler.reset();
+    EXPECT_EQ(scheduler.getAverageFrameTime(), 0.0f);
+}
@@ -132,4 +132,41 @@ TEST_F(GamePlayStateTest, Update)
 
     // Game should still be running
     EXPECT_FALSE(gamePlayState->isGameOver());
-}
\ No newline at end of file
+}
+
+// Test tick scheduling information
+TEST_F(GamePlayStateTest, TimeUntilTick)
+{
+    // A running game always has a pending tick within one update interval
+    float timeUntilTick = gamePlayState->getTimeUntilTick();
+    EXPECT_GE(timeUntilTick, 0.0f);
+    EXPECT_LE(timeUntilTick, 1.0f / settings->getGameSpeed());
+
+    // A paused game has no pending tick
+    gamePlayState->processInput(Input::PAUSE);
+    EXPECT_LT(gamePlayState->getTimeUntilTick(), 0.0f);
+}
+
+// Test that a reused state takes the settings it is reset with
+TEST_F(GamePlayStateTest, ResetRebindsSettings)
+{
+    GameSettings faster;
+    faster.setGameSpeed(10);
+
+    gamePlayState->exit();
+    gamePlayState->reset(stateManager.get(), &faster);
+    gamePlayState->enter();
+    EXPECT_LE(gamePlayState->getTimeUntilTick(), 1.0f / faster.getGameSpeed());
+}
+
+// Test the interpolation factor between ticks
+TEST_F(GamePlayStateTest, InterpolationAlpha)
+{
+    float alpha = gamePlayState->getInterpolationAlpha();
+    EXPECT_GE(alpha, 0.0f);
+    EXPECT_LE(alpha, 1.0f);
+
+    // A paused game shows the current tick without interpolation
+    gamePlayState->processInput(Input::PAUSE);
+    EXPECT_EQ(gamePlayState->getInterpolationAlpha(), 1.0f);
+}
@@ -1,4 +1,5 @@
 #include "game/Game.h"
+#include <algorithm>
 #include <gtest/gtest.h>
 
 using namespace GreedySnake;
@@ -130,4 +131,349 @@ TEST_F(GameTest, KeyPressHandling)
 
     // Direction should have changed
     EXPECT_NE(game.getSnake().getCurrentDirection(), initialDirection);
-}
\ No newline at end of file
+}
+
+// Test that two turns pressed within one tick are both taken, one per tick
+TEST_F(GameTest, QueuedTurnsTakeOneTickEach)
+{
+    ASSERT_EQ(game.getSnake().getCurrentDirection(), Direction::RIGHT);
+    const Position start = game.getSnake().getHead();
+
+    // Quick UP then LEFT: a U-turn over two ticks, not a reversal into the neck
+    game.processKeyPress(119); // W (UP)
+    game.processKeyPress(97);  // A (LEFT)
+    EXPECT_EQ(game.getSnake().getCurrentDirection(), Direction::UP);
+    EXPECT_EQ(game.getInputHandler().getQueuedCount(), 1u);
+
+    ASSERT_TRUE(game.update());
+    EXPECT_EQ(game.getSnake().getHead(), Position(start.x, start.y - 1));
+    EXPECT_EQ(game.getSnake().getCurrentDirection(), Direction::LEFT);
+
+    ASSERT_TRUE(game.update());
+    EXPECT_EQ(game.getSnake().getHead(), Position(start.x - 1, start.y - 1));
+    EXPECT_FALSE(game.isGameOver());
+    EXPECT_EQ(game.getInputHandler().getDroppedCount(), 0u);
+}
+
+// Test that the move consuming a turn reports its key press time
+TEST_F(GameTest, ReportsConsumedTurn)
+{
+    const auto pressedAt = InputHandler::Clock::now();
+    ASSERT_TRUE(game.update());
+    EXPECT_EQ(game.getTickCount(), 1u);
+    EXPECT_FALSE(game.wasLastMoveTurn());
+
+    game.processKeyPress(115, pressedAt); // S (DOWN)
+    ASSERT_TRUE(game.update());
+    EXPECT_EQ(game.getTickCount(), 2u);
+    EXPECT_TRUE(game.wasLastMoveTurn());
+    EXPECT_EQ(game.getLastTurnPressTime(), pressedAt);
+
+    ASSERT_TRUE(game.update());
+    EXPECT_FALSE(game.wasLastMoveTurn());
+}
+
+// Test that a resized game restarts in the middle of the new board
+TEST_F(GameTest, ResizeBeforeRestart)
+{
+    game.resize(30, 16);
+    game.initialize();
+    EXPECT_EQ(game.getBoard().getWidth(), 30);
+    EXPECT_EQ(game.getBoard().getHeight(), 16);
+    EXPECT_EQ(game.getSnake().getHead(), Position(15, 8));
+    EXPECT_TRUE(game.update());
+}
+
+// Test that replaying the event stream reproduces the board
+TEST_F(GameTest, EventsMirrorBoard)
+{
+    // Start from the initialized board; FOOD_SPAWNED is the only event so far
+    ASSERT_EQ(game.getEvents().size(), 1u);
+    EXPECT_EQ(game.getEvents()[0].type, GameEvent::Type::FOOD_SPAWNED);
+    EXPECT_EQ(game.getEvents()[0].position, game.getFood().getPosition());
+
+    std::vector<CellType> mirror;
+    for (int y = 0; y < 10; ++y)
+    {
+        for (int x = 0; x < 10; ++x)
+        {
+            mirror.push_back(game.getBoard().getCellType(Position(x, y)));
+        }
+    }
+
+    // Chase the food until the game ends
+    int eaten = 0;
+    for (int tick = 0; tick < 200 && !game.isGameOver(); ++tick)
+    {
+        const Position head = game.getSnake().getHead();
+        const Position food = game.getFood().getPosition();
+        const int key = food.x > head.x   ? 'd'
+                        : food.x < head.x ? 'a'
+                        : food.y > head.y ? 's'
+                                          : 'w';
+        game.processKeyPress(key);
+        game.update();
+
+        for (const GameEvent& event : game.getEvents())
+        {
+            auto& cell = mirror[event.position.y * 10 + event.position.x];
+            switch (event.type)
+            {
+            case GameEvent::Type::HEAD_MOVED:
+                cell = CellType::SNAKE;
+                break;
+            case GameEvent::Type::TAIL_VACATED:
+            case GameEvent::Type::ENTITY_EXPIRED:
+                cell = CellType::EMPTY;
+                break;
+            case GameEvent::Type::OBSTACLE_PLACED:
+                cell = CellType::WALL;
+                break;
+            case GameEvent::Type::FOOD_SPAWNED:
+                cell = CellType::FOOD;
+                break;
+            case GameEvent::Type::FOOD_EATEN:
+                EXPECT_EQ(event.value, game.getFood().getValue());
+                ++eaten;
+                break;
+            case GameEvent::Type::DIED:
+                EXPECT_EQ(event.value, game.getScore());
+                EXPECT_TRUE(game.isGameOver());
+                break;
+            }
+        }
+        EXPECT_EQ(game.getEvents().back().type == GameEvent::Type::DIED, game.isGameOver());
+
+        for (int y = 0; y < 10; ++y)
+        {
+            for (int x = 0; x < 10; ++x)
+            {
+                ASSERT_EQ(mirror[y * 10 + x], game.getBoard().getCellType(Position(x, y)))
+                    << "tick " << tick << " at " << x << "," << y;
+            }
+        }
+    }
+    EXPECT_EQ(game.getScore(), eaten);
+}
+
+// Test the events of running into a wall
+TEST_F(GameTest, EventsOnDeath)
+{
+    // The snake starts in the middle heading right, towards the wall
+    while (game.update())
+    {
+        // The tail stays put on the move after eating, so the head may come first
+        const std::vector<GameEvent>& events = game.getEvents();
+        auto moved = std::find_if(events.begin(), events.end(), [](const GameEvent& event) {
+            return event.type == GameEvent::Type::HEAD_MOVED;
+        });
+        ASSERT_NE(moved, events.end());
+        EXPECT_EQ(moved->position, game.getSnake().getHead());
+    }
+
+    const std::vector<GameEvent>& events = game.getEvents();
+    ASSERT_FALSE(events.empty());
+    EXPECT_EQ(events.back().type, GameEvent::Type::DIED);
+    EXPECT_EQ(events.back().position, Position(9, 5));
+
+    // Nothing happens after the game is over
+    EXPECT_FALSE(game.update());
+    EXPECT_EQ(game.getEvents().back().type, GameEvent::Type::DIED);
+}
+
+namespace
+{
+void countFired(void* context, TimerWheel::TimerId)
+{
+    ++*static_cast<int*>(context);
+}
+} // namespace
+
+// Test that game timers run on ticks and are cancelled by a restart
+TEST_F(GameTest, TimersFireFromUpdate)
+{
+    int fired = 0;
+    game.scheduleTimer(2, countFired, &fired);
+    EXPECT_NE(game.scheduleTimer(3, countFired, &fired), TimerWheel::INVALID_TIMER);
+
+    game.update();
+    EXPECT_EQ(fired, 0);
+    game.update();
+    EXPECT_EQ(fired, 1);
+    EXPECT_EQ(game.getTimers().getPendingCount(), 1u);
+
+    game.initialize();
+    EXPECT_EQ(game.getTimers().getPendingCount(), 0u);
+    game.update();
+    EXPECT_EQ(fired, 1);
+}
+
+// Test that food lives in the entity store
+TEST_F(GameTest, FoodIsAnEntity)
+{
+    const EntityStore& entities = game.getEntities();
+    ASSERT_EQ(entities.size(), 1u);
+    EXPECT_EQ(entities.getKinds()[0], EntityKind::FOOD);
+    EXPECT_EQ(entities.getPositions()[0], game.getFood().getPosition());
+    EXPECT_EQ(entities.getValues()[0], game.getFood().getValue());
+
+    // Generating food adds another item
+    ASSERT_TRUE(game.generateFood());
+    ASSERT_EQ(entities.size(), 2u);
+    EXPECT_EQ(entities.getPositions()[1], game.getFood().getPosition());
+    EXPECT_EQ(game.getBoard().getCellType(game.getFood().getPosition()), CellType::FOOD);
+}
+
+// Test extra food, obstacles and entity lifetimes
+TEST_F(GameTest, SpawnedEntities)
+{
+    // The snake heads right from (5, 5); only place food by hand
+    game.setFoodCount(0);
+    game.initialize();
+
+    // Occupied cells are refused
+    EXPECT_EQ(game.spawnEntity(EntityKind::FOOD, game.getSnake().getHead()),
+              EntityStore::INVALID_ENTITY);
+    EXPECT_EQ(game.spawnEntity(EntityKind::FOOD, Position(0, 0)), EntityStore::INVALID_ENTITY);
+
+    // Bonus food in the snake's path, and an obstacle that expires before the snake gets there
+    ASSERT_NE(game.spawnEntity(EntityKind::FOOD, Position(6, 5), 5), EntityStore::INVALID_ENTITY);
+    ASSERT_NE(game.spawnEntity(EntityKind::OBSTACLE, Position(8, 5), 0, 2),
+              EntityStore::INVALID_ENTITY);
+    EXPECT_EQ(game.getBoard().getCellType(Position(8, 5)), CellType::WALL);
+    EXPECT_EQ(game.getEntities().size(), 2u);
+    EXPECT_EQ(game.getTimers().getPendingCount(), 1u);
+
+    // Eating bonus food scores its value and, beyond the food count, doesn't bring it back
+    ASSERT_TRUE(game.update());
+    EXPECT_EQ(game.getScore(), 5);
+    EXPECT_EQ(game.getEntities().countKind(EntityKind::FOOD), 0u);
+
+    // The obstacle is gone after its two moves
+    ASSERT_TRUE(game.update());
+    EXPECT_EQ(game.getEvents().back().type, GameEvent::Type::ENTITY_EXPIRED);
+    EXPECT_EQ(game.getEvents().back().position, Position(8, 5));
+    EXPECT_EQ(game.getBoard().getCellType(Position(8, 5)), CellType::EMPTY);
+    EXPECT_EQ(game.getTimers().getPendingCount(), 0u);
+    EXPECT_TRUE(game.update());
+    EXPECT_EQ(game.getSnake().getHead(), Position(8, 5));
+}
+
+// Test that eating timed food cancels its lifetime
+TEST_F(GameTest, EatenFoodCancelsLifetime)
+{
+    game.setFoodCount(0);
+    game.initialize();
+    ASSERT_NE(game.spawnEntity(EntityKind::FOOD, Position(6, 5), 2, 3),
+              EntityStore::INVALID_ENTITY);
+    EXPECT_EQ(game.getEntities().getExpiries()[0], 3u);
+    EXPECT_EQ(game.getTimers().getPendingCount(), 1u);
+
+    ASSERT_TRUE(game.update());
+    EXPECT_EQ(game.getScore(), 2);
+    EXPECT_EQ(game.getTimers().getPendingCount(), 0u);
+
+    // Nothing expires later in the cell the food was in
+    ASSERT_TRUE(game.update());
+    ASSERT_TRUE(game.update());
+    for (const GameEvent& event : game.getEvents())
+    {
+        EXPECT_NE(event.type, GameEvent::Type::ENTITY_EXPIRED);
+    }
+}
+
+// Test that expired food is replaced up to the food count
+TEST_F(GameTest, ExpiredFoodIsReplaced)
+{
+    game.setFoodCount(0);
+    game.initialize();
+    ASSERT_NE(game.spawnEntity(EntityKind::FOOD, Position(2, 8), 1, 2),
+              EntityStore::INVALID_ENTITY);
+    game.setFoodCount(1);
+
+    ASSERT_TRUE(game.update());
+    ASSERT_TRUE(game.update());
+    const std::vector<GameEvent>& events = game.getEvents();
+    ASSERT_GE(events.size(), 2u);
+    EXPECT_EQ(events[events.size() - 2].type, GameEvent::Type::ENTITY_EXPIRED);
+    EXPECT_EQ(events.back().type, GameEvent::Type::FOOD_SPAWNED);
+    EXPECT_EQ(game.getEntities().countKind(EntityKind::FOOD), 1u);
+    EXPECT_EQ(game.getBoard().getCellType(events.back().position), CellType::FOOD);
+    EXPECT_FALSE(game.isGameOver());
+}
+
+// Test that a tick full of expiries and refills doesn't grow the event buffer
+TEST_F(GameTest, EventBufferCoversWorstTick)
+{
+    game.setFoodCount(0);
+    game.initialize();
+    for (int x = 1; x <= 8; ++x)
+    {
+        ASSERT_NE(game.spawnEntity(EntityKind::FOOD, Position(x, 2), 1, 1),
+                  EntityStore::INVALID_ENTITY);
+        ASSERT_NE(game.spawnEntity(EntityKind::FOOD, Position(x, 7), 1, 1),
+                  EntityStore::INVALID_ENTITY);
+    }
+    game.setFoodCount(16);
+
+    const GameEvent* buffer = game.getEvents().data();
+    ASSERT_TRUE(game.update());
+    EXPECT_EQ(game.getEvents().data(), buffer);
+    EXPECT_EQ(game.getEntities().countKind(EntityKind::FOOD), 16u);
+}
+
+// Test that running into an obstacle ends the game
+TEST_F(GameTest, ObstacleBlocksSnake)
+{
+    game.setFoodCount(0);
+    game.initialize();
+    ASSERT_NE(game.spawnEntity(EntityKind::OBSTACLE, Position(6, 5)), EntityStore::INVALID_ENTITY);
+    EXPECT_FALSE(game.update());
+    EXPECT_TRUE(game.isGameOver());
+}
+
+// Test a board holding many food items at once
+TEST_F(GameTest, ManyFoodItems)
+{
+    Game frenzy(40, 40, 3);
+    frenzy.setFoodCount(500);
+    frenzy.initialize();
+
+    const EntityStore& entities = frenzy.getEntities();
+    ASSERT_EQ(entities.countKind(EntityKind::FOOD), 500u);
+    EXPECT_EQ(frenzy.getEvents().size(), 500u);
+    for (const Position& position : entities.getPositions())
+    {
+        EXPECT_EQ(frenzy.getBoard().getCellType(position), CellType::FOOD);
+    }
+    EXPECT_EQ(frenzy.getBoard().getEmptyCellCount(), 38u * 38u - 3u - 500u);
+
+    // Make sure there is food right in front of the snake and find its value
+    const Position next = frenzy.getSnake().getHead() + Position(1, 0);
+    frenzy.spawnEntity(EntityKind::FOOD, next, 7);
+    int value = 0;
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        if (entities.getPositions()[i] == next)
+        {
+            value = entities.getValues()[i];
+        }
+    }
+    ASSERT_GT(value, 0);
+
+    // Eating it scores its value and keeps at least the food count on the board
+    ASSERT_TRUE(frenzy.update());
+    EXPECT_EQ(frenzy.getScore(), value);
+    EXPECT_GE(entities.countKind(EntityKind::FOOD), 500u);
+    EXPECT_EQ(frenzy.getBoard().getCellType(next), CellType::SNAKE);
+}
+
+// Test that a food count larger than the board fills every free cell
+TEST_F(GameTest, FoodCountLimitedByBoard)
+{
+    game.setFoodCount(5000);
+    game.initialize();
+    EXPECT_EQ(game.getEntities().countKind(EntityKind::FOOD), 8u * 8u - 3u);
+    EXPECT_EQ(game.getBoard().getEmptyCellCount(), 0u);
+    EXPECT_FALSE(game.isGameOver());
+}
@@ -72,4 +72,52 @@ TEST_F(InputHandlerTest, Reset)
     inputHandler.reset();
     EXPECT_EQ(inputHandler.getInput(), Direction::RIGHT);
     EXPECT_FALSE(inputHandler.isQuitRequested());
-}
\ No newline at end of file
+}
+
+// Test that direction keys are queued in order with their timestamps
+TEST_F(InputHandlerTest, QueuesTurnsInOrder)
+{
+    const auto pressedAt = InputHandler::Clock::now();
+    inputHandler.processKeyPress(119, pressedAt); // W (UP)
+    inputHandler.processKeyPress(97);             // A (LEFT)
+    EXPECT_EQ(inputHandler.getQueuedCount(), 2u);
+    EXPECT_EQ(inputHandler.getInput(), Direction::LEFT);
+
+    InputHandler::DirectionEvent turn{};
+    ASSERT_TRUE(inputHandler.takeTurn(Direction::RIGHT, turn));
+    EXPECT_EQ(turn.direction, Direction::UP);
+    EXPECT_EQ(turn.timestamp, pressedAt);
+
+    ASSERT_TRUE(inputHandler.takeTurn(Direction::UP, turn));
+    EXPECT_EQ(turn.direction, Direction::LEFT);
+    EXPECT_FALSE(inputHandler.takeTurn(Direction::LEFT, turn));
+}
+
+// Test that repeats are merged, reversals rejected and overflow dropped
+TEST_F(InputHandlerTest, CountsMergedAndDroppedInputs)
+{
+    inputHandler.processKeyPress(119); // W (UP)
+    inputHandler.processKeyPress(119); // W again, merged
+    EXPECT_EQ(inputHandler.getQueuedCount(), 1u);
+    EXPECT_EQ(inputHandler.getMergedCount(), 1u);
+
+    // Moving down, UP is a reversal and RIGHT a real turn
+    inputHandler.processKeyPress(100); // D (RIGHT)
+    InputHandler::DirectionEvent turn{};
+    ASSERT_TRUE(inputHandler.takeTurn(Direction::DOWN, turn));
+    EXPECT_EQ(turn.direction, Direction::RIGHT);
+    EXPECT_EQ(inputHandler.getDroppedCount(), 1u);
+
+    // Cycle W, A, S (no repeats to merge) until the queue overflows
+    const int keys[] = {119, 97, 115};
+    for (size_t i = 0; i < InputHandler::QUEUE_SIZE + 2; ++i)
+    {
+        inputHandler.processKeyPress(keys[i % 3]);
+    }
+    EXPECT_EQ(inputHandler.getQueuedCount(), InputHandler::QUEUE_SIZE);
+    EXPECT_EQ(inputHandler.getDroppedCount(), 3u);
+
+    inputHandler.reset();
+    EXPECT_EQ(inputHandler.getQueuedCount(), 0u);
+    EXPECT_EQ(inputHandler.getDroppedCount(), 0u);
+}
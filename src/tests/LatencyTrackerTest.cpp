@@ -0,0 +1,97 @@
+#include "game/LatencyTracker.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+namespace
+{
+LatencyTracker::Clock::time_point at(int milliseconds)
+{
+    return LatencyTracker::Clock::time_point(std::chrono::milliseconds(milliseconds));
+}
+} // namespace
+
+// Test that a sample completes only when a frame is presented
+TEST(LatencyTrackerTest, CompletesSamplesOnPresent)
+{
+    LatencyTracker tracker;
+    EXPECT_LT(tracker.getPercentile(LatencyTracker::Stage::INPUT_TO_DISPLAY, 50.0f), 0.0f);
+
+    tracker.recordConsumed(at(100), 7, at(110));
+    EXPECT_EQ(tracker.getSampleCount(), 0u);
+
+    tracker.markPresented(at(125));
+    ASSERT_EQ(tracker.getSampleCount(), 1u);
+    const LatencyTracker::Sample sample = tracker.getSamples()[0];
+    EXPECT_EQ(sample.tick, 7u);
+    EXPECT_FLOAT_EQ(sample.inputToTick, 10.0f);
+    EXPECT_FLOAT_EQ(sample.inputToDisplay, 25.0f);
+
+    // Later frames don't count the same input again
+    tracker.markPresented(at(140));
+    EXPECT_EQ(tracker.getSampleCount(), 1u);
+}
+
+// Test that a frame older than the consuming tick doesn't complete the sample
+TEST(LatencyTrackerTest, WaitsForFrameOfConsumingTick)
+{
+    LatencyTracker tracker;
+    tracker.recordConsumed(at(100), 7, at(110));
+    tracker.recordConsumed(at(120), 8, at(130));
+
+    // A render thread still showing tick 6, then tick 7
+    tracker.markPresented(6, at(115));
+    EXPECT_EQ(tracker.getSampleCount(), 0u);
+    tracker.markPresented(7, at(135));
+    ASSERT_EQ(tracker.getSampleCount(), 1u);
+    EXPECT_EQ(tracker.getSamples()[0].tick, 7u);
+    EXPECT_FLOAT_EQ(tracker.getSamples()[0].inputToDisplay, 35.0f);
+
+    // Tick 8 is still pending until discarded
+    tracker.discardPending();
+    tracker.markPresented(9, at(150));
+    EXPECT_EQ(tracker.getSampleCount(), 1u);
+}
+
+// Test nearest-rank percentiles over both stages
+TEST(LatencyTrackerTest, Percentiles)
+{
+    LatencyTracker tracker;
+    for (int i = 1; i <= 100; ++i)
+    {
+        tracker.recordConsumed(at(0), i, at(i));
+        tracker.markPresented(at(2 * i));
+    }
+
+    using Stage = LatencyTracker::Stage;
+    EXPECT_FLOAT_EQ(tracker.getPercentile(Stage::INPUT_TO_TICK, 50.0f), 50.0f);
+    EXPECT_FLOAT_EQ(tracker.getPercentile(Stage::INPUT_TO_TICK, 99.0f), 99.0f);
+    EXPECT_FLOAT_EQ(tracker.getPercentile(Stage::INPUT_TO_DISPLAY, 95.0f), 190.0f);
+    EXPECT_FLOAT_EQ(tracker.getPercentile(Stage::INPUT_TO_DISPLAY, 100.0f), 200.0f);
+    EXPECT_FLOAT_EQ(tracker.getPercentile(Stage::INPUT_TO_DISPLAY, 0.0f), 2.0f);
+
+    EXPECT_NE(tracker.formatSummary().find("p95 190.0"), std::string::npos);
+    EXPECT_NE(tracker.formatReport().find("input to tick: p50 50.00 ms"), std::string::npos);
+}
+
+// Test that only the most recent samples are kept
+TEST(LatencyTrackerTest, KeepsRecentSamples)
+{
+    LatencyTracker tracker;
+    const size_t extra = 10;
+    for (size_t i = 0; i < LatencyTracker::MAX_SAMPLES + extra; ++i)
+    {
+        tracker.recordConsumed(at(0), i, at(1));
+        tracker.markPresented(at(2));
+    }
+    EXPECT_EQ(tracker.getSampleCount(), LatencyTracker::MAX_SAMPLES);
+    EXPECT_EQ(tracker.getTotalSampleCount(), LatencyTracker::MAX_SAMPLES + extra);
+
+    const std::vector<LatencyTracker::Sample> samples = tracker.getSamples();
+    EXPECT_EQ(samples.front().tick, extra);
+    EXPECT_EQ(samples.back().tick, LatencyTracker::MAX_SAMPLES + extra - 1);
+
+    tracker.reset();
+    EXPECT_EQ(tracker.getSampleCount(), 0u);
+    EXPECT_EQ(tracker.formatSummary(), "Latency: no turns yet");
+}
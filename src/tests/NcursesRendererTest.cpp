@@ -0,0 +1,108 @@
+#include "renderer/NcursesRenderer.h"
+#include "game/Game.h"
+#include <curses.h>
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+// Frames are composed without touching the terminal until initialize() is called
+class NcursesRendererTest : public ::testing::Test
+{
+  protected:
+    NcursesRenderer renderer;
+
+    void SetUp() override
+    {
+        renderer.resize(80, 24);
+    }
+
+    // Find the first cell showing a character, or (-1, -1)
+    Position find(char character) const
+    {
+        const TerminalCellBuffer& cells = renderer.getCellBuffer();
+        for (int y = 0; y < cells.getHeight(); ++y)
+        {
+            for (int x = 0; x < cells.getWidth(); ++x)
+            {
+                if (cells.getCell(x, y).character == character)
+                {
+                    return Position(x, y);
+                }
+            }
+        }
+        return Position(-1, -1);
+    }
+};
+
+// Test key translation
+TEST_F(NcursesRendererTest, TranslateKey)
+{
+    EXPECT_EQ(NcursesRenderer::translateKey(KEY_UP), Input::UP);
+    EXPECT_EQ(NcursesRenderer::translateKey('s'), Input::DOWN);
+    EXPECT_EQ(NcursesRenderer::translateKey(KEY_LEFT), Input::LEFT);
+    EXPECT_EQ(NcursesRenderer::translateKey('D'), Input::RIGHT);
+    EXPECT_EQ(NcursesRenderer::translateKey('\n'), Input::SELECT);
+    EXPECT_EQ(NcursesRenderer::translateKey(' '), Input::SELECT);
+    EXPECT_EQ(NcursesRenderer::translateKey(27), Input::BACK);
+    EXPECT_EQ(NcursesRenderer::translateKey('p'), Input::PAUSE);
+    EXPECT_EQ(NcursesRenderer::translateKey('q'), Input::QUIT);
+    EXPECT_EQ(NcursesRenderer::translateKey('x'), Input::NONE);
+}
+
+// Test composing a gameplay frame
+TEST_F(NcursesRendererTest, ComposesGame)
+{
+    Game game(20, 15, 3);
+    game.initialize();
+    renderer.render(game);
+
+    // Board centered, two columns per cell, below the score line
+    const int originX = (80 - 20 * 2) / 2;
+    const int originY = 1 + (22 - 15) / 2;
+    const TerminalCellBuffer& cells = renderer.getCellBuffer();
+    EXPECT_EQ(cells.getCell(originX, originY).character, '#');
+    EXPECT_EQ(cells.getCell(originX + 1, originY).character, '#');
+
+    const Position head = game.getSnake().getHead();
+    EXPECT_EQ(cells.getCell(originX + head.x * 2, originY + head.y).character, '@');
+
+    const Position food = game.getFood().getPosition();
+    EXPECT_EQ(cells.getCell(originX + food.x * 2, originY + food.y).character, '*');
+
+    EXPECT_EQ(cells.getCell(0, 0).character, 'S'); // "Score: 0"
+}
+
+// Test that a board larger than the terminal scrolls to keep the head in view
+TEST_F(NcursesRendererTest, LargeBoardFollowsHead)
+{
+    Game game(200, 100, 3);
+    game.initialize();
+    renderer.render(game);
+
+    EXPECT_NE(find('@').x, -1);
+}
+
+// Test composing a menu
+TEST_F(NcursesRendererTest, ComposesMenu)
+{
+    renderer.renderMenu("Main Menu", {"Start Game", "Exit"}, 1, "↑/↓ to move");
+
+    const Position marker = find('>');
+    ASSERT_NE(marker.x, -1);
+    EXPECT_EQ(renderer.getCellBuffer().getCell(marker.x + 2, marker.y).character, 'E');
+    EXPECT_EQ(renderer.getCellBuffer().getCell(marker.x, marker.y).colorPair,
+              TerminalComposer::HIGHLIGHT_COLOR);
+    EXPECT_NE(find('^').x, -1);
+}
+
+// Test that an uninitialized renderer neither draws nor reports input
+TEST_F(NcursesRendererTest, UninitializedIsHeadless)
+{
+    renderer.renderMenu("Title", {"Item"}, 0);
+    EXPECT_EQ(renderer.getLastChangedCellCount(), 0u);
+
+    Input input = Input::UP;
+    EXPECT_TRUE(renderer.handleEvents(input));
+    EXPECT_EQ(input, Input::NONE);
+    EXPECT_TRUE(renderer.isWindowOpen());
+}
@@ -0,0 +1,62 @@
+#include "renderer/ParticleSystem.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+// Test that particles fly out, fade and die
+TEST(ParticleSystemTest, BurstLifecycle)
+{
+    ParticleSystem particles(64);
+    EXPECT_EQ(particles.emitBurst(5.0f, 5.0f, 16, 0xFFFFFFFFu, 4.0f, 0.5f), 16u);
+    EXPECT_EQ(particles.getLiveCount(), 16u);
+
+    particles.update(0.1f);
+    RenderCommandBuffer commands;
+    particles.appendCommands(commands);
+    ASSERT_EQ(commands.getCommands().size(), 16u);
+    for (const RenderCommand& command : commands.getCommands())
+    {
+        EXPECT_EQ(command.type, RenderCommand::Type::PARTICLE);
+        EXPECT_LT(command.color >> 24, 0xFFu); // Fading
+        EXPECT_FALSE(command.x == 5.0f && command.y == 5.0f);
+    }
+
+    // Lifetimes are at most the requested one
+    particles.update(0.5f);
+    EXPECT_EQ(particles.getLiveCount(), 0u);
+}
+
+// Test that emitting never goes past the capacity
+TEST(ParticleSystemTest, RespectsCapacity)
+{
+    ParticleSystem particles(10);
+    EXPECT_EQ(particles.emitBurst(0.0f, 0.0f, 8, 0xFFFFFFFFu, 1.0f, 1.0f), 8u);
+    EXPECT_EQ(particles.emitBurst(0.0f, 0.0f, 8, 0xFFFFFFFFu, 1.0f, 1.0f), 2u);
+    EXPECT_EQ(particles.getLiveCount(), 10u);
+
+    particles.clear();
+    EXPECT_EQ(particles.getLiveCount(), 0u);
+}
+
+// Test that slow frames shrink the budget and fast frames restore it
+TEST(ParticleSystemTest, BudgetFollowsFrameTime)
+{
+    ParticleSystem particles(256);
+    particles.setTargetFrameTime(0.02f);
+    EXPECT_EQ(particles.getBudget(), 256u);
+
+    for (int i = 0; i < 40; ++i)
+    {
+        particles.update(0.05f);
+    }
+    const size_t reduced = particles.getBudget();
+    EXPECT_LT(reduced, 256u);
+    EXPECT_GE(reduced, 256u / 16);
+    EXPECT_LE(particles.emitBurst(0.0f, 0.0f, 256, 0xFFFFFFFFu, 1.0f, 1.0f), reduced);
+
+    for (int i = 0; i < 400; ++i)
+    {
+        particles.update(0.01f);
+    }
+    EXPECT_EQ(particles.getBudget(), 256u);
+}
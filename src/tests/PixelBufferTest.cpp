@@ -0,0 +1,88 @@
+#include "renderer/PixelBuffer.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace GreedySnake;
+
+// Test the RGBA byte order of packed colors
+TEST(PixelBufferTest, PackColorByteOrder)
+{
+    const uint32_t color = PixelBuffer::packColor(1, 2, 3, 4);
+    EXPECT_EQ(color & 0xFF, 1u);
+    EXPECT_EQ((color >> 8) & 0xFF, 2u);
+    EXPECT_EQ((color >> 16) & 0xFF, 3u);
+    EXPECT_EQ((color >> 24) & 0xFF, 4u);
+}
+
+// Test span fills of every length around the SIMD width
+TEST(PixelBufferTest, FillSpan)
+{
+    for (size_t count = 0; count <= 13; ++count)
+    {
+        std::vector<uint32_t> span(16, 0);
+        PixelBuffer::fillSpan(span.data(), count, 7);
+        for (size_t i = 0; i < span.size(); ++i)
+        {
+            EXPECT_EQ(span[i], i < count ? 7u : 0u) << "count " << count << " index " << i;
+        }
+    }
+}
+
+// Test rectangle fills with clipping
+TEST(PixelBufferTest, FillRectClips)
+{
+    PixelBuffer buffer(8, 6);
+    buffer.clear(0);
+    buffer.fillRect(-2, 4, 4, 5, 9);
+
+    EXPECT_EQ(buffer.getPixel(0, 4), 9u);
+    EXPECT_EQ(buffer.getPixel(1, 5), 9u);
+    EXPECT_EQ(buffer.getPixel(2, 4), 0u);
+    EXPECT_EQ(buffer.getPixel(0, 3), 0u);
+
+    // Entirely outside
+    buffer.fillRect(10, 10, 3, 3, 5);
+    for (uint32_t pixel : buffer.getPixels())
+    {
+        EXPECT_NE(pixel, 5u);
+    }
+}
+
+// Test drawing text with the built-in font
+TEST(PixelBufferTest, DrawText)
+{
+    PixelBuffer buffer(32, 16);
+    buffer.clear(0);
+
+    EXPECT_EQ(PixelBuffer::getTextWidth("10", 2), 14);
+    EXPECT_EQ(PixelBuffer::getTextHeight(2), 10);
+
+    // '1' has its top row in the middle column only
+    buffer.drawText(0, 0, "1", 2, 1);
+    EXPECT_EQ(buffer.getPixel(0, 0), 0u);
+    EXPECT_EQ(buffer.getPixel(2, 0), 1u);
+    EXPECT_EQ(buffer.getPixel(3, 1), 1u);
+    EXPECT_EQ(buffer.getPixel(4, 0), 0u);
+
+    // Bottom row of '1' spans all three columns
+    EXPECT_EQ(buffer.getPixel(0, 9), 1u);
+    EXPECT_EQ(buffer.getPixel(5, 9), 1u);
+}
+
+// Test circle fills cover pixel centers inside the radius only
+TEST(PixelBufferTest, FillCircle)
+{
+    PixelBuffer buffer(10, 10);
+    buffer.clear(0);
+    buffer.fillCircle(5.0f, 5.0f, 3.0f, 4);
+
+    EXPECT_EQ(buffer.getPixel(5, 5), 4u);
+    EXPECT_EQ(buffer.getPixel(2, 4), 4u);
+    EXPECT_EQ(buffer.getPixel(7, 5), 4u);
+    EXPECT_EQ(buffer.getPixel(2, 2), 0u); // Corner of the bounding box
+    EXPECT_EQ(buffer.getPixel(8, 5), 0u);
+
+    // Clipped at the image edge
+    buffer.fillCircle(0.0f, 0.0f, 2.0f, 6);
+    EXPECT_EQ(buffer.getPixel(0, 0), 6u);
+}
@@ -0,0 +1,20 @@
+#include "utils/QueueBenchmark.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+// Test that both variants deliver every item in order
+TEST(QueueBenchmarkTest, TransfersAllItems)
+{
+    const uint64_t itemCount = 50000;
+
+    const QueueBenchmark::Result spsc = QueueBenchmark::runSpscQueue(itemCount);
+    EXPECT_EQ(spsc.itemCount, itemCount);
+    EXPECT_TRUE(spsc.inOrder);
+    EXPECT_GT(spsc.seconds, 0.0);
+
+    const QueueBenchmark::Result locked = QueueBenchmark::runMutexDeque(itemCount);
+    EXPECT_EQ(locked.itemCount, itemCount);
+    EXPECT_TRUE(locked.inOrder);
+    EXPECT_GT(locked.seconds, 0.0);
+}
@@ -0,0 +1,91 @@
+#include "renderer/RenderCommandBuffer.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+// Test recording commands in drawing order
+TEST(RenderCommandBufferTest, RecordsCommands)
+{
+    RenderCommandBuffer buffer;
+    EXPECT_FALSE(buffer.hasBoard());
+
+    buffer.setBoard(20, 15, 3.5f, 4.5f);
+    buffer.addRect(0.0f, 0.0f, 20.0f, 1.0f, 1);
+    buffer.addCircle(2.5f, 3.5f, 0.4f, 2);
+    buffer.addSprite(SpriteId::SNAKE_HEAD, 3.0f, 4.0f, 1.0f, 1.0f, 3);
+    buffer.addText("Score: 0", TextStyle::HUD, TextAnchor::TOP_LEFT, 0.0f, 4);
+
+    EXPECT_TRUE(buffer.hasBoard());
+    EXPECT_EQ(buffer.getBoardWidth(), 20);
+    EXPECT_EQ(buffer.getBoardHeight(), 15);
+    EXPECT_FLOAT_EQ(buffer.getFocusX(), 3.5f);
+    EXPECT_FLOAT_EQ(buffer.getFocusY(), 4.5f);
+
+    const std::vector<RenderCommand>& commands = buffer.getCommands();
+    ASSERT_EQ(commands.size(), 4u);
+    EXPECT_EQ(commands[0].type, RenderCommand::Type::RECT);
+    EXPECT_EQ(commands[1].type, RenderCommand::Type::CIRCLE);
+    EXPECT_FLOAT_EQ(commands[1].width, 0.4f);
+    EXPECT_EQ(commands[2].type, RenderCommand::Type::SPRITE);
+    EXPECT_EQ(static_cast<SpriteId>(commands[2].style), SpriteId::SNAKE_HEAD);
+    EXPECT_EQ(commands[3].type, RenderCommand::Type::TEXT);
+    EXPECT_EQ(static_cast<TextStyle>(commands[3].style), TextStyle::HUD);
+    EXPECT_EQ(buffer.getText(commands[3]), "Score: 0");
+    EXPECT_EQ(commands[3].color, 4u);
+}
+
+// Test that clearing keeps storage so the next frame does not allocate
+TEST(RenderCommandBufferTest, ClearReusesStorage)
+{
+    RenderCommandBuffer buffer;
+    buffer.setBoard(10, 10, 0.0f, 0.0f);
+    buffer.addText("A long enough line to need a heap allocation",
+                   TextStyle::ITEM,
+                   TextAnchor::TOP_CENTER,
+                   1.0f,
+                   0);
+    const RenderCommand* commandStorage = buffer.getCommands().data();
+    const char* textStorage = buffer.getText(buffer.getCommands()[0]).data();
+
+    buffer.clear();
+    EXPECT_FALSE(buffer.hasBoard());
+    EXPECT_TRUE(buffer.getCommands().empty());
+
+    buffer.addText("Shorter line, same buffer", TextStyle::ITEM, TextAnchor::TOP_CENTER, 1.0f, 0);
+    EXPECT_EQ(buffer.getCommands().data(), commandStorage);
+    EXPECT_EQ(buffer.getText(buffer.getCommands()[0]).data(), textStorage);
+    EXPECT_EQ(buffer.getText(buffer.getCommands()[0]), "Shorter line, same buffer");
+}
+
+// Test that prefixed text is joined in the pooled string
+TEST(RenderCommandBufferTest, PrefixedText)
+{
+    RenderCommandBuffer buffer;
+    const std::string item = "Start Game";
+    buffer.addText("> ", item, TextStyle::SELECTED_ITEM, TextAnchor::TOP_CENTER, 3.0f, 0);
+    ASSERT_EQ(buffer.getCommands().size(), 1u);
+    EXPECT_EQ(buffer.getText(buffer.getCommands()[0]), "> Start Game");
+    EXPECT_EQ(buffer.getCommands()[0].style, static_cast<uint8_t>(TextStyle::SELECTED_ITEM));
+}
+
+// Test copying a frame between buffers
+TEST(RenderCommandBufferTest, CopyFrom)
+{
+    RenderCommandBuffer source;
+    source.setBoard(5, 6, 1.0f, 2.0f);
+    source.setTick(42);
+    source.addText("Title", TextStyle::TITLE, TextAnchor::TOP_CENTER, 0.0f, 1);
+    source.addText("Item", TextStyle::ITEM, TextAnchor::TOP_CENTER, 2.5f, 2);
+
+    RenderCommandBuffer copy;
+    copy.addText("Stale", TextStyle::HINT, TextAnchor::CENTER, 0.0f, 3);
+    copy.copyFrom(source);
+
+    ASSERT_EQ(copy.getCommands().size(), 2u);
+    EXPECT_EQ(copy.getBoardWidth(), 5);
+    EXPECT_EQ(copy.getBoardHeight(), 6);
+    EXPECT_EQ(copy.getTick(), 42u);
+    EXPECT_EQ(copy.getText(copy.getCommands()[0]), "Title");
+    EXPECT_EQ(copy.getText(copy.getCommands()[1]), "Item");
+    EXPECT_FLOAT_EQ(copy.getCommands()[1].y, 2.5f);
+}
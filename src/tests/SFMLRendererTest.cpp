@@ -61,4 +61,36 @@ TEST_F(SFMLRendererTest, CoordinateMapping)
     EXPECT_GT(screenPos.y, 0);
     EXPECT_LT(screenPos.x, renderer.getWindowWidth());
     EXPECT_LT(screenPos.y, renderer.getWindowHeight());
-}
\ No newline at end of file
+}
+
+// Test camera configuration
+TEST_F(SFMLRendererTest, CameraMode)
+{
+    // Large boards switch to the follow camera automatically by default
+    EXPECT_EQ(renderer.getCameraMode(), SFMLRenderer::CameraMode::AUTO);
+
+    renderer.setCameraMode(SFMLRenderer::CameraMode::FOLLOW_HEAD);
+    EXPECT_EQ(renderer.getCameraMode(), SFMLRenderer::CameraMode::FOLLOW_HEAD);
+}
+
+// Test that only cells inside a view are considered visible
+TEST_F(SFMLRendererTest, VisibleCellCulling)
+{
+    const float cellSize = 10.0f;
+
+    // A 100x50 pixel view in the middle of a 100x100 board
+    sf::View view(sf::FloatRect(200.0f, 300.0f, 100.0f, 50.0f));
+    sf::IntRect cells = SFMLRenderer::computeVisibleCells(view, cellSize, 100, 100);
+    EXPECT_EQ(cells.left, 20);
+    EXPECT_EQ(cells.top, 30);
+    EXPECT_EQ(cells.width, 11); // Includes the partially visible edge cell
+    EXPECT_EQ(cells.height, 6);
+
+    // Views hanging over the board edges are clamped to the board
+    sf::View cornerView(sf::FloatRect(-50.0f, -50.0f, 100.0f, 100.0f));
+    cells = SFMLRenderer::computeVisibleCells(cornerView, cellSize, 100, 100);
+    EXPECT_EQ(cells.left, 0);
+    EXPECT_EQ(cells.top, 0);
+    EXPECT_EQ(cells.width, 6);
+    EXPECT_EQ(cells.height, 6);
+}
@@ -138,4 +138,24 @@ TEST_F(SnakeTest, Reset)
     EXPECT_EQ(defaultSnake.getHead(), Position(5, 5));
     EXPECT_EQ(defaultSnake.getBody().size(), 3);
     EXPECT_EQ(defaultSnake.getCurrentDirection(), Direction::RIGHT);
-}
\ No newline at end of file
+}
+
+// Test tracking of the previous head and tail for interpolation
+TEST_F(SnakeTest, PreviousEnds)
+{
+    // Before any move the previous ends are the current ends
+    EXPECT_EQ(defaultSnake.getPreviousHead(), Position(5, 5));
+    EXPECT_EQ(defaultSnake.getPreviousTail(), Position(3, 5));
+
+    // A normal move shifts both ends by one cell
+    defaultSnake.move();
+    EXPECT_EQ(defaultSnake.getPreviousHead(), Position(5, 5));
+    EXPECT_EQ(defaultSnake.getPreviousTail(), Position(3, 5));
+    EXPECT_EQ(defaultSnake.getBody().back(), Position(4, 5));
+
+    // When growing, the tail stays where it was
+    defaultSnake.grow();
+    defaultSnake.move();
+    EXPECT_EQ(defaultSnake.getPreviousHead(), Position(6, 5));
+    EXPECT_EQ(defaultSnake.getPreviousTail(), defaultSnake.getBody().back());
+}
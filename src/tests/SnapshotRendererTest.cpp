@@ -0,0 +1,97 @@
+#include "renderer/SnapshotRenderer.h"
+#include "game/Game.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+class SnapshotRendererTest : public ::testing::Test
+{
+  protected:
+    Game game{10, 10, 3};
+    RenderSnapshotBuffer buffer;
+    SnapshotRenderer renderer{buffer};
+
+    void SetUp() override
+    {
+        game.initialize();
+    }
+};
+
+// Test capturing a gameplay frame
+TEST_F(SnapshotRendererTest, CapturesGame)
+{
+    renderer.render(game);
+
+    ASSERT_TRUE(buffer.update());
+    const RenderSnapshot& snapshot = buffer.getReadBuffer();
+
+    EXPECT_EQ(snapshot.kind, RenderSnapshot::Kind::GAME);
+    EXPECT_EQ(snapshot.boardWidth, 10);
+    EXPECT_EQ(snapshot.boardHeight, 10);
+    EXPECT_EQ(snapshot.snakeCells, game.getSnake().getBody());
+    ASSERT_EQ(snapshot.foodCells.size(), 1u);
+    EXPECT_EQ(snapshot.foodCells[0], game.getFood().getPosition());
+    EXPECT_TRUE(snapshot.obstacleCells.empty());
+    EXPECT_EQ(snapshot.score, 0);
+    EXPECT_FALSE(snapshot.gameOver);
+    EXPECT_FALSE(snapshot.paused);
+}
+
+// Test that a snapshot is unaffected by later game changes
+TEST_F(SnapshotRendererTest, SnapshotIsIndependentOfGame)
+{
+    renderer.render(game);
+    ASSERT_TRUE(buffer.update());
+    Position capturedHead = buffer.getReadBuffer().snakeCells.front();
+
+    game.update();
+    EXPECT_NE(game.getSnake().getHead(), capturedHead);
+    EXPECT_EQ(buffer.getReadBuffer().snakeCells.front(), capturedHead);
+}
+
+// Test capturing a menu frame
+TEST_F(SnapshotRendererTest, CapturesMenu)
+{
+    renderer.renderMenu("Title", {"One", "Two"}, 1, "Help");
+
+    ASSERT_TRUE(buffer.update());
+    const RenderSnapshot& snapshot = buffer.getReadBuffer();
+
+    EXPECT_EQ(snapshot.kind, RenderSnapshot::Kind::MENU);
+    EXPECT_EQ(snapshot.title, "Title");
+    ASSERT_EQ(snapshot.items.size(), 2u);
+    EXPECT_EQ(snapshot.items[1], "Two");
+    EXPECT_EQ(snapshot.selectedIndex, 1u);
+    EXPECT_EQ(snapshot.instructions, "Help");
+}
+
+// Test capturing an interpolated gameplay frame
+TEST_F(SnapshotRendererTest, CapturesInterpolation)
+{
+    game.update();
+    renderer.renderInterpolated(game, 0.25f);
+
+    ASSERT_TRUE(buffer.update());
+    const RenderSnapshot& snapshot = buffer.getReadBuffer();
+
+    EXPECT_FLOAT_EQ(snapshot.interpolationAlpha, 0.25f);
+    EXPECT_EQ(snapshot.previousHead, game.getSnake().getPreviousHead());
+    EXPECT_EQ(snapshot.previousTail, game.getSnake().getPreviousTail());
+}
+
+// Test capturing a frame that was already laid out
+TEST_F(SnapshotRendererTest, CapturesCommands)
+{
+    RenderCommandBuffer commands;
+    commands.setBoard(10, 10, 5.5f, 5.5f);
+    commands.addText("Score: 3", TextStyle::HUD, TextAnchor::TOP_LEFT, 0.0f, 0);
+    renderer.renderCommands(commands);
+
+    ASSERT_TRUE(buffer.update());
+    const RenderSnapshot& snapshot = buffer.getReadBuffer();
+
+    EXPECT_EQ(snapshot.kind, RenderSnapshot::Kind::COMMANDS);
+    EXPECT_EQ(snapshot.commands.getBoardWidth(), 10);
+    ASSERT_EQ(snapshot.commands.getCommands().size(), 1u);
+    EXPECT_EQ(snapshot.commands.getText(snapshot.commands.getCommands()[0]), "Score: 3");
+}
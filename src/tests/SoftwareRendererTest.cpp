@@ -0,0 +1,86 @@
+#include "renderer/SoftwareRenderer.h"
+#include "game/Game.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+class SoftwareRendererTest : public ::testing::Test
+{
+  protected:
+    Game game{20, 20, 3};
+
+    void SetUp() override
+    {
+        game.initialize();
+    }
+
+    // Center pixel of a board cell for a board that fills a square frame without HUD
+    static uint32_t cellPixel(const SoftwareRenderer& renderer, const Position& cell, int cells)
+    {
+        const PixelBuffer& frame = renderer.getFrame();
+        const float cellSize = static_cast<float>(frame.getWidth()) / cells;
+        return frame.getPixel(static_cast<int>((cell.x + 0.5f) * cellSize),
+                              static_cast<int>((cell.y + 0.5f) * cellSize));
+    }
+};
+
+// Test the default agent-sized output
+TEST_F(SoftwareRendererTest, DefaultResolution)
+{
+    SoftwareRenderer renderer;
+    EXPECT_TRUE(renderer.initialize());
+    EXPECT_EQ(renderer.getFrame().getWidth(), 84);
+    EXPECT_EQ(renderer.getFrame().getHeight(), 84);
+    EXPECT_EQ(renderer.getFrame().getPixels().size(), 84u * 84u);
+}
+
+// Test that board elements land in their cells
+TEST_F(SoftwareRendererTest, RasterizesBoard)
+{
+    SoftwareRenderer renderer(200, 200);
+    renderer.setHudEnabled(false);
+    renderer.initialize();
+    renderer.render(game);
+
+    EXPECT_EQ(renderer.getFrameCount(), 1u);
+    EXPECT_EQ(cellPixel(renderer, Position(0, 0), 20), PixelBuffer::packColor(100, 100, 100));
+    EXPECT_EQ(cellPixel(renderer, Position(19, 7), 20), PixelBuffer::packColor(100, 100, 100));
+    EXPECT_EQ(cellPixel(renderer, game.getSnake().getHead(), 20),
+              PixelBuffer::packColor(0, 255, 0));
+    EXPECT_EQ(cellPixel(renderer, game.getFood().getPosition(), 20),
+              PixelBuffer::packColor(255, 0, 0));
+}
+
+// Test that identical states produce identical frames at any resolution
+TEST_F(SoftwareRendererTest, DeterministicFrames)
+{
+    SoftwareRenderer first(84, 84);
+    SoftwareRenderer second(640, 480);
+    second.setResolution(84, 84);
+
+    first.render(game);
+    second.render(game);
+    EXPECT_EQ(first.getFrame().getPixels(), second.getFrame().getPixels());
+
+    // Rendering again without changes is stable
+    first.render(game);
+    EXPECT_EQ(first.getFrame().getPixels(), second.getFrame().getPixels());
+}
+
+// Test menus and the HUD draw text
+TEST_F(SoftwareRendererTest, DrawsText)
+{
+    SoftwareRenderer renderer(640, 480);
+    renderer.renderMenu("Main Menu", {"Start Game", "Exit"}, 0, "↑/↓ to move");
+
+    size_t highlighted = 0;
+    for (uint32_t pixel : renderer.getFrame().getPixels())
+    {
+        highlighted += pixel == PixelBuffer::packColor(255, 255, 0) ? 1 : 0;
+    }
+    EXPECT_GT(highlighted, 0u);
+
+    Input input = Input::UP;
+    EXPECT_TRUE(renderer.handleEvents(input));
+    EXPECT_EQ(input, Input::NONE);
+}
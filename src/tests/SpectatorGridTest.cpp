@@ -0,0 +1,56 @@
+#include "renderer/SpectatorGrid.h"
+#include "game/Game.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace GreedySnake;
+
+// Test grid shapes for typical batch sizes
+TEST(SpectatorGridTest, GridShape)
+{
+    EXPECT_EQ(SpectatorGrid::computeGridShape(0), sf::Vector2u(0, 0));
+    EXPECT_EQ(SpectatorGrid::computeGridShape(1), sf::Vector2u(1, 1));
+    EXPECT_EQ(SpectatorGrid::computeGridShape(3), sf::Vector2u(2, 2));
+    EXPECT_EQ(SpectatorGrid::computeGridShape(16), sf::Vector2u(4, 4));
+    EXPECT_EQ(SpectatorGrid::computeGridShape(20), sf::Vector2u(5, 4));
+    EXPECT_EQ(SpectatorGrid::computeGridShape(64), sf::Vector2u(8, 8));
+}
+
+// Test that tiles partition the grid area
+TEST(SpectatorGridTest, TileRects)
+{
+    SpectatorGrid grid(800.0f, 600.0f);
+
+    sf::FloatRect first = grid.getTileRect(0, 4);
+    EXPECT_FLOAT_EQ(first.left, 0.0f);
+    EXPECT_FLOAT_EQ(first.top, 0.0f);
+    EXPECT_FLOAT_EQ(first.width, 400.0f);
+    EXPECT_FLOAT_EQ(first.height, 300.0f);
+
+    sf::FloatRect last = grid.getTileRect(3, 4);
+    EXPECT_FLOAT_EQ(last.left, 400.0f);
+    EXPECT_FLOAT_EQ(last.top, 300.0f);
+}
+
+// Test that geometry for many games is batched into one vertex array
+TEST(SpectatorGridTest, BuildBatchesAllGames)
+{
+    std::vector<Game> games(64); // 20x20 boards, snakes of length 3
+    std::vector<const Game*> gamePointers;
+    for (auto& game : games)
+    {
+        game.initialize();
+        gamePointers.push_back(&game);
+    }
+
+    SpectatorGrid grid(800.0f, 600.0f);
+    grid.build(gamePointers);
+
+    // Per board: background, four wall strips, food and the snake cells
+    const size_t quadsPerGame = 1 + 4 + 1 + 3;
+    EXPECT_EQ(grid.getVertices().getVertexCount(), 64 * quadsPerGame * 4);
+
+    // Rebuilding replaces the geometry rather than appending to it
+    grid.build(gamePointers);
+    EXPECT_EQ(grid.getVertices().getVertexCount(), 64 * quadsPerGame * 4);
+}
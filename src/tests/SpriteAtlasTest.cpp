@@ -0,0 +1,56 @@
+#include "renderer/SpriteAtlas.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+// Test the layout and contents of the generated atlas
+TEST(SpriteAtlasTest, GeneratesDefaultTiles)
+{
+    const int tileSize = 16;
+    const PixelBuffer pixels = SpriteAtlas::generateDefaultPixels(tileSize);
+    ASSERT_EQ(pixels.getWidth(), tileSize * SpriteAtlas::TILE_COUNT);
+    ASSERT_EQ(pixels.getHeight(), tileSize);
+
+    // Center pixel of each tile
+    auto center = [&](SpriteId sprite) {
+        return pixels.getPixel(static_cast<int>(sprite) * tileSize + tileSize / 2, tileSize / 2);
+    };
+    EXPECT_EQ(center(SpriteId::SNAKE_HEAD), PixelBuffer::packColor(0, 255, 0));
+    EXPECT_EQ(center(SpriteId::SNAKE_BODY), PixelBuffer::packColor(0, 180, 0));
+    EXPECT_EQ(center(SpriteId::FOOD), PixelBuffer::packColor(255, 0, 0));
+    EXPECT_EQ(center(SpriteId::WALL), PixelBuffer::packColor(100, 100, 100));
+    EXPECT_EQ(center(SpriteId::BACKGROUND), PixelBuffer::packColor(0, 32, 48));
+
+    // Round sprites leave their corners transparent
+    EXPECT_EQ(pixels.getPixel(0, 0), PixelBuffer::packColor(0, 0, 0, 0));
+    EXPECT_EQ(pixels.getPixel(static_cast<int>(SpriteId::FOOD) * tileSize, 0),
+              PixelBuffer::packColor(0, 0, 0, 0));
+}
+
+// Test that tile rectangles follow the sprite order
+TEST(SpriteAtlasTest, TileRects)
+{
+    SpriteAtlas atlas;
+    EXPECT_EQ(atlas.getTileSize(), 0);
+    ASSERT_TRUE(atlas.createDefault());
+    EXPECT_EQ(atlas.getTileSize(), SpriteAtlas::DEFAULT_TILE_SIZE);
+
+    const sf::FloatRect wall = atlas.getTileRect(SpriteId::WALL);
+    EXPECT_FLOAT_EQ(wall.left, 3.0f * SpriteAtlas::DEFAULT_TILE_SIZE);
+    EXPECT_FLOAT_EQ(wall.top, 0.0f);
+    EXPECT_FLOAT_EQ(wall.width, SpriteAtlas::DEFAULT_TILE_SIZE);
+    EXPECT_FLOAT_EQ(wall.height, SpriteAtlas::DEFAULT_TILE_SIZE);
+}
+
+// Test that images without a full row of square tiles are rejected
+TEST(SpriteAtlasTest, RejectsMalformedImages)
+{
+    SpriteAtlas atlas;
+    ASSERT_TRUE(atlas.createFromImage(SpriteAtlas::generateDefaultImage(8)));
+    EXPECT_EQ(atlas.getTileSize(), 8);
+
+    sf::Image tooNarrow;
+    tooNarrow.create(16, 16, sf::Color::Black);
+    EXPECT_FALSE(atlas.createFromImage(tooNarrow));
+    EXPECT_EQ(atlas.getTileSize(), 8);
+}
@@ -0,0 +1,72 @@
+#include "renderer/SpriteBatch.h"
+#include <gtest/gtest.h>
+
+using namespace GreedySnake;
+
+class SpriteBatchTest : public ::testing::Test
+{
+  protected:
+    SpriteAtlas atlas;
+    SpriteBatch batch;
+    RenderCommandBuffer commands;
+
+    void SetUp() override
+    {
+        atlas.createDefault();
+        commands.setBoard(4, 3, 2.0f, 1.5f);
+    }
+};
+
+// Test that every visible cell gets a background quad
+TEST_F(SpriteBatchTest, BackgroundCoversVisibleCells)
+{
+    batch.build(commands, atlas, sf::Vector2f(0.0f, 0.0f), 10.0f, sf::IntRect(0, 0, 4, 3));
+    EXPECT_EQ(batch.getQuadCount(), 12u);
+
+    batch.build(commands, atlas, sf::Vector2f(0.0f, 0.0f), 10.0f, sf::IntRect(1, 1, 2, 1));
+    EXPECT_EQ(batch.getQuadCount(), 2u);
+}
+
+// Test that rectangles are tiled one wall quad per visible cell
+TEST_F(SpriteBatchTest, TilesRectangles)
+{
+    commands.addRect(0.0f, 0.0f, 4.0f, 1.0f, 0);
+    batch.build(commands, atlas, sf::Vector2f(0.0f, 0.0f), 10.0f, sf::IntRect(0, 0, 2, 3));
+
+    // 6 background cells plus the 2 visible cells of the wall strip
+    ASSERT_EQ(batch.getQuadCount(), 8u);
+    const sf::VertexArray& vertices = batch.getVertices();
+    const sf::Vertex& wallCorner = vertices[6 * 4];
+    EXPECT_FLOAT_EQ(wallCorner.position.x, 0.0f);
+    EXPECT_FLOAT_EQ(wallCorner.position.y, 0.0f);
+
+    // Texture coordinates stay inside the wall tile
+    const sf::FloatRect wallTile = atlas.getTileRect(SpriteId::WALL);
+    EXPECT_GT(wallCorner.texCoords.x, wallTile.left);
+    EXPECT_LT(vertices[6 * 4 + 2].texCoords.x, wallTile.left + wallTile.width);
+}
+
+// Test sprite placement and culling
+TEST_F(SpriteBatchTest, PlacesAndCullsSprites)
+{
+    commands.addSprite(SpriteId::SNAKE_HEAD, 1.0f, 2.0f, 1.0f, 1.0f, 0);
+    commands.addSprite(SpriteId::SNAKE_BODY, 40.0f, 40.0f, 1.0f, 1.0f, 0); // Far outside
+    commands.addCircle(3.5f, 0.5f, SpriteAtlas::FOOD_RADIUS, 0);
+    commands.addText("Score: 0", TextStyle::HUD, TextAnchor::TOP_LEFT, 0.0f, 0);
+    batch.build(commands, atlas, sf::Vector2f(5.0f, 7.0f), 10.0f, sf::IntRect(0, 0, 4, 3));
+
+    // 12 background cells, the head and the food
+    ASSERT_EQ(batch.getQuadCount(), 14u);
+    const sf::VertexArray& vertices = batch.getVertices();
+
+    const sf::Vertex& head = vertices[12 * 4];
+    EXPECT_FLOAT_EQ(head.position.x, 15.0f);
+    EXPECT_FLOAT_EQ(head.position.y, 27.0f);
+    EXPECT_LT(head.texCoords.x, atlas.getTileRect(SpriteId::SNAKE_BODY).left);
+
+    // The food quad covers its whole cell
+    const sf::Vertex& food = vertices[13 * 4];
+    EXPECT_FLOAT_EQ(food.position.x, 35.0f);
+    EXPECT_FLOAT_EQ(food.position.y, 7.0f);
+    EXPECT_FLOAT_EQ(vertices[13 * 4 + 2].position.x, 45.0f);
+}
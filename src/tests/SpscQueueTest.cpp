@@ -0,0 +1,97 @@
+#include "utils/SpscQueue.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace GreedySnake;
+
+// Test that an empty queue has nothing to pop
+TEST(SpscQueueTest, InitialState)
+{
+    SpscQueue<int, 4> queue;
+    int value = -1;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.size(), 0u);
+    EXPECT_FALSE(queue.pop(value));
+    EXPECT_EQ(value, -1);
+    EXPECT_EQ(queue.capacity(), 4u);
+}
+
+// Test that items come out in push order and a full queue rejects more
+TEST(SpscQueueTest, FifoAndFull)
+{
+    SpscQueue<int, 4> queue;
+    for (int i = 1; i <= 4; ++i)
+    {
+        EXPECT_TRUE(queue.push(i));
+    }
+    EXPECT_FALSE(queue.push(5));
+    EXPECT_EQ(queue.size(), 4u);
+
+    int value = 0;
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, 1);
+
+    // The freed slot can be used again
+    EXPECT_TRUE(queue.push(5));
+    for (int expected = 2; expected <= 5; ++expected)
+    {
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, expected);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+// Test many laps around the ring
+TEST(SpscQueueTest, WrapsAround)
+{
+    SpscQueue<int, 8> queue;
+    int value = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(queue.push(i));
+        ASSERT_TRUE(queue.push(i + 1000));
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, i);
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, i + 1000);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+// Test concurrent use: every item arrives exactly once and in order
+TEST(SpscQueueTest, ConcurrentTransfer)
+{
+    SpscQueue<int, 16> queue;
+    const int itemCount = 200000;
+
+    std::thread producer([&]() {
+        for (int i = 0; i < itemCount; ++i)
+        {
+            while (!queue.push(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // Keep draining after a mismatch so the producer can finish and be joined
+    int received = 0;
+    int outOfOrder = 0;
+    int value = 0;
+    while (received < itemCount)
+    {
+        if (queue.pop(value))
+        {
+            outOfOrder += value != received ? 1 : 0;
+            ++received;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    EXPECT_EQ(outOfOrder, 0);
+    EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,72 @@
+#include "game/StartupTimer.h"
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace GreedySnake;
+
+class StartupTimerTest : public ::testing::Test
+{
+  protected:
+    StartupTimer timer;
+
+    void SetUp() override
+    {
+        timer.setLoggingEnabled(false);
+    }
+};
+
+// Test that phases are recorded with their duration and offset from startup
+TEST_F(StartupTimerTest, RecordsPhases)
+{
+    const auto begin = StartupTimer::Clock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    timer.recordPhase("fonts", begin);
+
+    const std::vector<StartupTimer::Phase> phases = timer.getPhases();
+    ASSERT_EQ(phases.size(), 1u);
+    EXPECT_EQ(phases[0].name, "fonts");
+    EXPECT_GE(phases[0].duration, 5.0f);
+    EXPECT_GE(phases[0].startTime, 0.0f);
+}
+
+// Test that only the first frame counts
+TEST_F(StartupTimerTest, FirstFrameIsRecordedOnce)
+{
+    EXPECT_FALSE(timer.hasFirstFrame());
+    EXPECT_LT(timer.getTimeToFirstFrame(), 0.0f);
+
+    timer.markFirstFrame();
+    ASSERT_TRUE(timer.hasFirstFrame());
+    const float firstFrame = timer.getTimeToFirstFrame();
+    EXPECT_GE(firstFrame, 0.0f);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    timer.markFirstFrame();
+    EXPECT_FLOAT_EQ(timer.getTimeToFirstFrame(), firstFrame);
+
+    // Starting over forgets everything
+    timer.reset();
+    EXPECT_FALSE(timer.hasFirstFrame());
+    EXPECT_TRUE(timer.getPhases().empty());
+}
+
+// Test recording from several loader threads at once
+TEST_F(StartupTimerTest, RecordsFromThreads)
+{
+    std::vector<std::thread> loaders;
+    for (int i = 0; i < 4; ++i)
+    {
+        loaders.emplace_back([this]() {
+            for (int j = 0; j < 25; ++j)
+            {
+                timer.recordPhase("phase", StartupTimer::Clock::now());
+            }
+        });
+    }
+    for (std::thread& loader : loaders)
+    {
+        loader.join();
+    }
+
+    EXPECT_EQ(timer.getPhases().size(), 100u);
+}
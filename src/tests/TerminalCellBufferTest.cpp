@@ -0,0 +1,105 @@
+#include "renderer/TerminalCellBuffer.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace GreedySnake;
+
+namespace
+{
+struct EmittedCell
+{
+    int x;
+    int y;
+    char character;
+};
+
+std::vector<EmittedCell> flushAll(TerminalCellBuffer& buffer)
+{
+    std::vector<EmittedCell> emitted;
+    buffer.flush([&emitted](int x, int y, const TerminalCell& cell) {
+        emitted.push_back({x, y, cell.character});
+    });
+    return emitted;
+}
+} // namespace
+
+// Test that the first flush after a resize emits every cell
+TEST(TerminalCellBufferTest, FirstFlushEmitsEverything)
+{
+    TerminalCellBuffer buffer;
+    buffer.resize(10, 4);
+
+    EXPECT_EQ(buffer.getWidth(), 10);
+    EXPECT_EQ(buffer.getHeight(), 4);
+    EXPECT_EQ(flushAll(buffer).size(), 40u);
+
+    // Nothing changed since
+    EXPECT_TRUE(flushAll(buffer).empty());
+}
+
+// Test that only changed cells are emitted
+TEST(TerminalCellBufferTest, EmitsOnlyChangedCells)
+{
+    TerminalCellBuffer buffer;
+    buffer.resize(10, 4);
+    flushAll(buffer);
+
+    TerminalCell cell;
+    cell.character = '@';
+    buffer.clear();
+    buffer.setCell(3, 2, cell);
+
+    std::vector<EmittedCell> emitted = flushAll(buffer);
+    ASSERT_EQ(emitted.size(), 1u);
+    EXPECT_EQ(emitted[0].x, 3);
+    EXPECT_EQ(emitted[0].y, 2);
+    EXPECT_EQ(emitted[0].character, '@');
+
+    // Redrawing the same frame emits nothing
+    buffer.clear();
+    buffer.setCell(3, 2, cell);
+    EXPECT_TRUE(flushAll(buffer).empty());
+
+    // Moving the cell emits the old position (blanked) and the new one
+    buffer.clear();
+    buffer.setCell(4, 2, cell);
+    EXPECT_EQ(flushAll(buffer).size(), 2u);
+
+    // A color change alone counts as a change
+    cell.colorPair = 2;
+    buffer.clear();
+    buffer.setCell(4, 2, cell);
+    EXPECT_EQ(flushAll(buffer).size(), 1u);
+}
+
+// Test that invalidate forces a full redraw
+TEST(TerminalCellBufferTest, InvalidateForcesFullRedraw)
+{
+    TerminalCellBuffer buffer;
+    buffer.resize(5, 5);
+    flushAll(buffer);
+
+    buffer.invalidate();
+    EXPECT_EQ(flushAll(buffer).size(), 25u);
+    EXPECT_TRUE(flushAll(buffer).empty());
+}
+
+// Test text drawing with clipping and UTF-8 symbol mapping
+TEST(TerminalCellBufferTest, DrawText)
+{
+    TerminalCellBuffer buffer;
+    buffer.resize(6, 2);
+
+    EXPECT_EQ(buffer.drawText(4, 0, "abc"), 3);
+    EXPECT_EQ(buffer.getCell(4, 0).character, 'a');
+    EXPECT_EQ(buffer.getCell(5, 0).character, 'b');
+    EXPECT_EQ(buffer.getCell(6, 0).character, ' '); // Clipped
+
+    buffer.drawText(0, 1, "↑/↓ é");
+    EXPECT_EQ(buffer.getCell(0, 1).character, '^');
+    EXPECT_EQ(buffer.getCell(1, 1).character, '/');
+    EXPECT_EQ(buffer.getCell(2, 1).character, 'v');
+    EXPECT_EQ(buffer.getCell(4, 1).character, '?');
+
+    EXPECT_EQ(TerminalCellBuffer::getTextWidth("↑/↓ to move"), 11);
+}
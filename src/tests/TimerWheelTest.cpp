@@ -0,0 +1,205 @@
+#include "game/TimerWheel.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace GreedySnake;
+
+namespace
+{
+// Records the tick each timer fired at
+struct FiredLog
+{
+    TimerWheel* wheel = nullptr;
+    std::vector<uint64_t> ticks;
+    std::vector<TimerWheel::TimerId> ids;
+};
+
+void recordFired(void* context, TimerWheel::TimerId id)
+{
+    auto* log = static_cast<FiredLog*>(context);
+    log->ticks.push_back(log->wheel->getCurrentTick());
+    log->ids.push_back(id);
+}
+
+void advanceTo(TimerWheel& wheel, uint64_t tick)
+{
+    while (wheel.getCurrentTick() < tick)
+    {
+        wheel.advance();
+    }
+}
+} // namespace
+
+// Test that timers fire exactly at their tick, across every level boundary
+TEST(TimerWheelTest, FiresAtExactTick)
+{
+    TimerWheel wheel;
+    FiredLog log;
+    log.wheel = &wheel;
+
+    // Start off a level boundary so cascades happen mid-delay
+    advanceTo(wheel, 37);
+
+    const std::vector<uint64_t> delays = {1, 2, 63, 64, 65, 127, 4095, 4096, 4097, 300000};
+    for (uint64_t delay : delays)
+    {
+        EXPECT_NE(wheel.schedule(delay, recordFired, &log), TimerWheel::INVALID_TIMER);
+    }
+    EXPECT_EQ(wheel.getPendingCount(), delays.size());
+
+    advanceTo(wheel, 37 + 300000);
+    ASSERT_EQ(log.ticks.size(), delays.size());
+    for (size_t i = 0; i < delays.size(); ++i)
+    {
+        EXPECT_EQ(log.ticks[i], 37 + delays[i]);
+    }
+    EXPECT_EQ(wheel.getPendingCount(), 0u);
+}
+
+// Test that timers due together fire in scheduling order
+TEST(TimerWheelTest, SameTickInScheduleOrder)
+{
+    TimerWheel wheel;
+    FiredLog log;
+    log.wheel = &wheel;
+
+    const TimerWheel::TimerId late = wheel.schedule(100, recordFired, &log);
+    wheel.advance();
+    const TimerWheel::TimerId early = wheel.schedule(99, recordFired, &log);
+
+    advanceTo(wheel, 100);
+    ASSERT_EQ(log.ids.size(), 2u);
+    EXPECT_EQ(log.ids[0], late);
+    EXPECT_EQ(log.ids[1], early);
+}
+
+// Test cancelling, including stale and reused handles
+TEST(TimerWheelTest, Cancel)
+{
+    TimerWheel wheel;
+    FiredLog log;
+    log.wheel = &wheel;
+
+    const TimerWheel::TimerId cancelled = wheel.schedule(5000, recordFired, &log);
+    const TimerWheel::TimerId kept = wheel.schedule(10, recordFired, &log);
+    EXPECT_TRUE(wheel.cancel(cancelled));
+    EXPECT_FALSE(wheel.cancel(cancelled));
+    EXPECT_FALSE(wheel.cancel(TimerWheel::INVALID_TIMER));
+
+    // The freed slot gets a new handle; the old one must not cancel it
+    const TimerWheel::TimerId reused = wheel.schedule(20, recordFired, &log);
+    EXPECT_NE(reused, cancelled);
+    EXPECT_FALSE(wheel.cancel(cancelled));
+
+    advanceTo(wheel, 6000);
+    ASSERT_EQ(log.ids.size(), 2u);
+    EXPECT_EQ(log.ids[0], kept);
+    EXPECT_EQ(log.ids[1], reused);
+    EXPECT_FALSE(wheel.cancel(kept));
+}
+
+// A handle stays stale after its node has been reused more often than 16 bits can count
+TEST(TimerWheelTest, StaleHandlesAfterManyReuses)
+{
+    TimerWheel wheel(1);
+    FiredLog log;
+    log.wheel = &wheel;
+
+    const TimerWheel::TimerId first = wheel.schedule(10, recordFired, &log);
+    ASSERT_TRUE(wheel.cancel(first));
+    for (int i = 0; i < 0x10000 - 1; ++i)
+    {
+        wheel.cancel(wheel.schedule(10, recordFired, &log));
+    }
+
+    const TimerWheel::TimerId latest = wheel.schedule(10, recordFired, &log);
+    ASSERT_NE(latest, TimerWheel::INVALID_TIMER);
+    EXPECT_FALSE(wheel.cancel(first));
+    EXPECT_EQ(wheel.getPendingCount(), 1u);
+    EXPECT_TRUE(wheel.cancel(latest));
+}
+
+// Test that a full pool rejects timers instead of allocating
+TEST(TimerWheelTest, CapacityIsFixed)
+{
+    TimerWheel wheel(3);
+    FiredLog log;
+    log.wheel = &wheel;
+    EXPECT_EQ(wheel.getCapacity(), 3u);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_NE(wheel.schedule(1, recordFired, &log), TimerWheel::INVALID_TIMER);
+    }
+    EXPECT_EQ(wheel.schedule(1, recordFired, &log), TimerWheel::INVALID_TIMER);
+
+    wheel.advance();
+    EXPECT_EQ(log.ticks.size(), 3u);
+    EXPECT_NE(wheel.schedule(1, recordFired, &log), TimerWheel::INVALID_TIMER);
+}
+
+// Test that resizing cancels pending timers and changes the pool size
+TEST(TimerWheelTest, Resize)
+{
+    TimerWheel wheel(2);
+    FiredLog log;
+    log.wheel = &wheel;
+    const TimerWheel::TimerId pending = wheel.schedule(1, recordFired, &log);
+    wheel.advance();
+    wheel.schedule(5, recordFired, &log);
+
+    wheel.resize(4);
+    EXPECT_EQ(wheel.getCapacity(), 4u);
+    EXPECT_EQ(wheel.getPendingCount(), 0u);
+    EXPECT_EQ(wheel.getCurrentTick(), 0u);
+    EXPECT_FALSE(wheel.cancel(pending));
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_NE(wheel.schedule(1, recordFired, &log), TimerWheel::INVALID_TIMER);
+    }
+    advanceTo(wheel, 10);
+    EXPECT_EQ(log.ticks.size(), 5u);
+}
+
+namespace
+{
+// Reschedules itself every 3 ticks and cancels its partner the first time
+struct Repeater
+{
+    TimerWheel* wheel = nullptr;
+    TimerWheel::TimerId partner = TimerWheel::INVALID_TIMER;
+    int fired = 0;
+};
+
+void repeat(void* context, TimerWheel::TimerId)
+{
+    auto* repeater = static_cast<Repeater*>(context);
+    ++repeater->fired;
+    repeater->wheel->cancel(repeater->partner);
+    repeater->wheel->schedule(3, repeat, repeater);
+}
+} // namespace
+
+// Test that callbacks can schedule and cancel timers, even ones due in the same tick
+TEST(TimerWheelTest, CallbacksScheduleAndCancel)
+{
+    TimerWheel wheel;
+    FiredLog log;
+    log.wheel = &wheel;
+    Repeater repeater;
+    repeater.wheel = &wheel;
+
+    wheel.schedule(3, repeat, &repeater);
+    repeater.partner = wheel.schedule(3, recordFired, &log);
+
+    advanceTo(wheel, 30);
+    EXPECT_EQ(repeater.fired, 10);
+    EXPECT_TRUE(log.ticks.empty());
+    EXPECT_EQ(wheel.getPendingCount(), 1u);
+
+    wheel.clear();
+    EXPECT_EQ(wheel.getPendingCount(), 0u);
+    EXPECT_EQ(wheel.getCurrentTick(), 0u);
+    advanceTo(wheel, 10);
+    EXPECT_EQ(repeater.fired, 10);
+}
@@ -0,0 +1,97 @@
+#include "utils/TripleBuffer.h"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace GreedySnake;
+
+// Test that nothing is read before anything was published
+TEST(TripleBufferTest, InitialState)
+{
+    TripleBuffer<int> buffer;
+    EXPECT_FALSE(buffer.hasNewData());
+    EXPECT_FALSE(buffer.update());
+}
+
+// Test publishing and consuming a single value
+TEST(TripleBufferTest, PublishAndConsume)
+{
+    TripleBuffer<int> buffer;
+
+    buffer.getWriteBuffer() = 42;
+    buffer.publish();
+
+    EXPECT_TRUE(buffer.hasNewData());
+    EXPECT_TRUE(buffer.update());
+    EXPECT_EQ(buffer.getReadBuffer(), 42);
+
+    // The value stays readable until something newer arrives
+    EXPECT_FALSE(buffer.update());
+    EXPECT_EQ(buffer.getReadBuffer(), 42);
+}
+
+// Test that the consumer only sees the latest value
+TEST(TripleBufferTest, LatestValueWins)
+{
+    TripleBuffer<int> buffer;
+
+    for (int i = 1; i <= 5; ++i)
+    {
+        buffer.getWriteBuffer() = i;
+        buffer.publish();
+    }
+
+    EXPECT_TRUE(buffer.update());
+    EXPECT_EQ(buffer.getReadBuffer(), 5);
+}
+
+// Test that the producer never writes into the slot being read
+TEST(TripleBufferTest, WriteSlotIsNeverReadSlot)
+{
+    TripleBuffer<int> buffer;
+
+    buffer.getWriteBuffer() = 1;
+    buffer.publish();
+    buffer.update();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_NE(&buffer.getWriteBuffer(), &buffer.getReadBuffer());
+        buffer.getWriteBuffer() = i;
+        buffer.publish();
+        if (i % 3 == 0)
+        {
+            buffer.update();
+        }
+    }
+}
+
+// Test concurrent use: values seen by the consumer never go backwards
+TEST(TripleBufferTest, ConcurrentMonotonicValues)
+{
+    TripleBuffer<int> buffer;
+    std::atomic<bool> done(false);
+    const int lastValue = 100000;
+
+    std::thread producer([&]() {
+        for (int i = 1; i <= lastValue; ++i)
+        {
+            buffer.getWriteBuffer() = i;
+            buffer.publish();
+        }
+        done = true;
+    });
+
+    int lastSeen = 0;
+    while (!done || buffer.hasNewData())
+    {
+        if (buffer.update())
+        {
+            EXPECT_GT(buffer.getReadBuffer(), lastSeen);
+            lastSeen = buffer.getReadBuffer();
+        }
+    }
+
+    producer.join();
+    EXPECT_EQ(lastSeen, lastValue);
+}
@@ -1,7 +1,12 @@
+#include "menu/GameOverState.h"
+#include "menu/GamePlayState.h"
 #include "menu/GameState.h"
 #include "menu/GameStateManager.h"
 #include "renderer/Renderer.h"
+#include <atomic>
+#include <chrono>
 #include <gtest/gtest.h>
+#include <thread>
 
 using namespace GreedySnake;
 
@@ -38,8 +43,13 @@ class MockRenderer : public Renderer
     {
         lastMenuTitle = title;
     }
+    void renderCommands(const RenderCommandBuffer& commands) override
+    {
+        ++commandFrames;
+    }
 
     std::string lastMenuTitle;
+    int commandFrames = 0;
 };
 
 // Mock GameState implementation for testing
@@ -170,4 +180,254 @@ TEST_F(GameStateTest, RenderState)
 
     manager.render(renderer);
     EXPECT_TRUE(statePtr->renderCalled);
-}
\ No newline at end of file
+}
+
+// State that records the inputs it receives and closes itself on BACK
+class RecordingGameState : public GameState
+{
+  public:
+    explicit RecordingGameState(GameStateManager* manager) : manager(manager)
+    {
+    }
+
+    void enter() override
+    {
+    }
+    void exit() override
+    {
+    }
+    void processInput(Input input) override
+    {
+        processInput(input, InputClock::now());
+    }
+    void processInput(Input input, InputClock::time_point timestamp) override
+    {
+        received.push_back(InputEvent{input, timestamp});
+        if (input == Input::BACK)
+        {
+            manager->popState();
+        }
+    }
+    void update(float deltaTime) override
+    {
+    }
+    void render(Renderer& renderer) override
+    {
+    }
+
+    GameStateManager* manager;
+    std::vector<InputEvent> received;
+};
+
+TEST_F(GameStateTest, ProcessInputBatchInOrder)
+{
+    GameStateManager manager;
+    auto lower = std::make_unique<RecordingGameState>(&manager);
+    auto upper = std::make_unique<RecordingGameState>(&manager);
+    RecordingGameState* lowerPtr = lower.get();
+    manager.pushState(std::move(lower));
+    manager.pushState(std::move(upper));
+
+    // The upper state closes on BACK; the inputs after it reach the state below
+    const InputClock::time_point start = InputClock::now();
+    InputBatch inputs;
+    inputs.add(Input::UP, start);
+    inputs.add(Input::BACK, start + std::chrono::milliseconds(1));
+    inputs.add(Input::LEFT, start + std::chrono::milliseconds(2));
+    inputs.add(Input::SELECT, start + std::chrono::milliseconds(3));
+    manager.processInput(inputs);
+
+    ASSERT_EQ(lowerPtr->received.size(), 2u);
+    EXPECT_EQ(lowerPtr->received[0].input, Input::LEFT);
+    EXPECT_EQ(lowerPtr->received[0].timestamp, start + std::chrono::milliseconds(2));
+    EXPECT_EQ(lowerPtr->received[1].input, Input::SELECT);
+
+    // Closing the last state ends the batch
+    inputs.clear();
+    inputs.add(Input::BACK);
+    inputs.add(Input::UP);
+    manager.processInput(inputs);
+    EXPECT_FALSE(manager.hasActiveState());
+}
+
+TEST_F(GameStateTest, InputBatchDropsOverflow)
+{
+    InputBatch inputs;
+    for (size_t i = 0; i < InputBatch::CAPACITY; ++i)
+    {
+        EXPECT_TRUE(inputs.add(Input::DOWN));
+    }
+    EXPECT_FALSE(inputs.add(Input::UP));
+    EXPECT_EQ(inputs.size(), InputBatch::CAPACITY);
+    EXPECT_EQ(inputs.getDroppedCount(), 1u);
+
+    inputs.clear();
+    EXPECT_TRUE(inputs.empty());
+    EXPECT_EQ(inputs.getDroppedCount(), 1u);
+}
+
+// State that lets the manager keep it for reuse
+class ReusableGameState : public MockGameState
+{
+  public:
+    explicit ReusableGameState(int* constructed)
+    {
+        ++*constructed;
+    }
+    void reset(int* reused)
+    {
+        ++*reused;
+    }
+    [[nodiscard]] bool isReusable() const override
+    {
+        return true;
+    }
+};
+
+TEST_F(GameStateTest, ReusesRetiredStates)
+{
+    GameStateManager manager;
+    int constructed = 0;
+    int reused = 0;
+
+    manager.changeToPooledState<ReusableGameState>(&constructed);
+    ASSERT_TRUE(manager.hasActiveState());
+    EXPECT_EQ(constructed, 1);
+
+    // Leaving keeps the state; the next change enters the same object again with the new args
+    manager.pushState(std::make_unique<MockGameState>());
+    manager.changeToPooledState<ReusableGameState>(&reused);
+    EXPECT_EQ(constructed, 1);
+    EXPECT_EQ(reused, 1);
+    EXPECT_EQ(manager.getPooledStateCount(), 0u);
+
+    // Non-reusable states are destroyed
+    manager.popState();
+    EXPECT_EQ(manager.getPooledStateCount(), 1u);
+    manager.pushState(std::make_unique<MockGameState>());
+    manager.popState();
+    EXPECT_EQ(manager.getPooledStateCount(), 1u);
+
+    manager.pushPooledState<ReusableGameState>(&reused);
+    EXPECT_EQ(constructed, 1);
+    EXPECT_EQ(reused, 2);
+    EXPECT_EQ(manager.getPooledStateCount(), 0u);
+}
+
+// Play Again replaces the game over screen from inside its own menu callback
+TEST_F(GameStateTest, PlayAgainFromGameOver)
+{
+    GameStateManager manager;
+    manager.changeToPooledState<GamePlayState>(&manager, manager.getSettings());
+    manager.finishTransition();
+    manager.pushState(std::make_unique<GameOverState>(&manager, 3));
+    ASSERT_LT(manager.getTimeUntilTick(), 0.0f);
+
+    // The first item is Play Again; the retired game state is entered again
+    manager.processInput(Input::SELECT);
+    manager.finishTransition();
+    EXPECT_TRUE(manager.hasActiveState());
+    EXPECT_EQ(manager.getPooledStateCount(), 0u);
+    EXPECT_GE(manager.getTimeUntilTick(), 0.0f);
+}
+
+TEST_F(GameStateTest, DefaultSettingsWithoutOwner)
+{
+    GameStateManager manager;
+    GameSettings* settings = manager.getSettings();
+    ASSERT_NE(settings, nullptr);
+    EXPECT_EQ(manager.getSettings(), settings);
+}
+
+// Mock state whose preparation waits until the test releases it
+class PreparingGameState : public MockGameState
+{
+  public:
+    explicit PreparingGameState(std::atomic<bool>* release) : release(release)
+    {
+    }
+    [[nodiscard]] bool hasPreparation() const override
+    {
+        return true;
+    }
+    void prepare() override
+    {
+        while (!*release)
+        {
+            std::this_thread::yield();
+        }
+        prepared = true;
+    }
+
+    std::atomic<bool>* release;
+    std::atomic<bool> prepared{false};
+};
+
+TEST_F(GameStateTest, PreparesStatesOffTheLoop)
+{
+    GameStateManager manager;
+    MockRenderer renderer;
+    std::atomic<bool> release(false);
+
+    auto lower = std::make_unique<MockGameState>();
+    MockGameState* lowerState = lower.get();
+    manager.pushState(std::move(lower));
+
+    auto next = std::make_unique<PreparingGameState>(&release);
+    PreparingGameState* nextState = next.get();
+    manager.pushState(std::move(next));
+
+    // Nothing is entered yet and the current state is frozen
+    EXPECT_TRUE(manager.isTransitionPending());
+    EXPECT_TRUE(manager.hasActiveState());
+    EXPECT_LT(manager.getTimeUntilTick(), 0.0f);
+    manager.processInput(Input::UP);
+    manager.update(0.05f);
+    manager.render(renderer);
+    EXPECT_FALSE(nextState->enterCalled);
+    EXPECT_FALSE(lowerState->processInputCalled);
+    EXPECT_FALSE(lowerState->updateCalled);
+    EXPECT_FALSE(lowerState->renderCalled);
+
+    // The last frame stays on screen briefly, then a loading frame is drawn
+    EXPECT_EQ(renderer.commandFrames, 0);
+    manager.update(0.1f);
+    manager.render(renderer);
+    EXPECT_EQ(renderer.commandFrames, 1);
+
+    release = true;
+    for (int i = 0; i < 1000 && manager.isTransitionPending(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        manager.update(0.0f);
+    }
+    ASSERT_FALSE(manager.isTransitionPending());
+    EXPECT_TRUE(nextState->prepared);
+    EXPECT_TRUE(nextState->enterCalled);
+    EXPECT_TRUE(nextState->updateCalled);
+    EXPECT_FALSE(lowerState->exitCalled);
+
+    manager.render(renderer);
+    EXPECT_TRUE(nextState->renderCalled);
+}
+
+TEST_F(GameStateTest, NextTransitionFinishesPendingOne)
+{
+    GameStateManager manager;
+    std::atomic<bool> release(true);
+
+    auto prepared = std::make_unique<PreparingGameState>(&release);
+    PreparingGameState* preparedState = prepared.get();
+    manager.changeState(std::move(prepared));
+
+    // States without a preparation are entered right away, after the pending one
+    auto plain = std::make_unique<MockGameState>();
+    MockGameState* plainState = plain.get();
+    manager.pushState(std::move(plain));
+    EXPECT_FALSE(manager.isTransitionPending());
+    EXPECT_TRUE(preparedState->enterCalled);
+    EXPECT_TRUE(plainState->enterCalled);
+
+    manager.popState();
+    EXPECT_TRUE(manager.hasActiveState());
+}
@@ -271,4 +271,32 @@ TEST(MenuTest, InputHandlingForSettings)
     // Test toggle again
     EXPECT_TRUE(menu.handleInput(Input::SELECT));
     EXPECT_FALSE(toggleValue);
-}
\ No newline at end of file
+}
+
+// Test that display strings are cached and only reformatted after a change
+TEST(MenuTest, CachesDisplayStrings)
+{
+    Menu menu;
+    auto sliderItem = menu.addItem<SliderMenuItem>("Speed", 1, 10, 5);
+    auto toggleItem = menu.addItem<ToggleMenuItem>("Walls", false);
+    EXPECT_EQ(sliderItem->getKind(), MenuItem::Kind::SLIDER);
+    EXPECT_EQ(toggleItem->getKind(), MenuItem::Kind::TOGGLE);
+
+    const std::vector<std::string>& strings = menu.getDisplayStrings();
+    ASSERT_EQ(strings.size(), 2u);
+    EXPECT_EQ(strings[0], "Speed: 5");
+    EXPECT_EQ(strings[1], "Walls: Off");
+    EXPECT_FALSE(sliderItem->isDisplayDirty());
+
+    // Unchanged items keep the same storage from call to call
+    const char* sliderText = strings[0].data();
+    EXPECT_EQ(&menu.getDisplayStrings(), &strings);
+    EXPECT_EQ(menu.getDisplayStrings()[0].data(), sliderText);
+
+    // A value change only marks its own item
+    menu.handleInput(Input::RIGHT);
+    EXPECT_TRUE(sliderItem->isDisplayDirty());
+    EXPECT_FALSE(toggleItem->isDisplayDirty());
+    EXPECT_EQ(menu.getDisplayStrings()[0], "Speed: 6");
+    EXPECT_EQ(menu.getMenuItems(), std::vector<std::string>({"Speed: 6", "Walls: Off"}));
+}
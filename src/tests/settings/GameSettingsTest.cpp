@@ -29,6 +29,7 @@ TEST_F(GameSettingsTest, DefaultSettings)
     EXPECT_EQ(5, settings.getGameSpeed());
     EXPECT_EQ(20, settings.getBoardWidth());
     EXPECT_EQ(20, settings.getBoardHeight());
+    EXPECT_EQ(1, settings.getFoodCount());
     EXPECT_TRUE(settings.hasBorders());
     EXPECT_TRUE(settings.isSoundEnabled());
 }
@@ -84,6 +85,12 @@ TEST_F(GameSettingsTest, BoundaryValues)
 
     settings.setBoardHeight(5);               // Too small
     EXPECT_EQ(10, settings.getBoardHeight()); // Should be clamped to min
+
+    // Test food count limits
+    settings.setFoodCount(0);
+    EXPECT_EQ(1, settings.getFoodCount());
+    settings.setFoodCount(9000);
+    EXPECT_EQ(5000, settings.getFoodCount());
 }
 
 TEST_F(GameSettingsTest, SaveAndLoadSettings)
@@ -94,6 +101,7 @@ TEST_F(GameSettingsTest, SaveAndLoadSettings)
     settings.setGameSpeed(7);
     settings.setBoardWidth(25);
     settings.setBoardHeight(30);
+    settings.setFoodCount(250);
     settings.setBorders(false);
     settings.setSoundEnabled(false);
 
@@ -110,6 +118,7 @@ TEST_F(GameSettingsTest, SaveAndLoadSettings)
     EXPECT_EQ(settings.getGameSpeed(), loadedSettings.getGameSpeed());
     EXPECT_EQ(settings.getBoardWidth(), loadedSettings.getBoardWidth());
     EXPECT_EQ(settings.getBoardHeight(), loadedSettings.getBoardHeight());
+    EXPECT_EQ(settings.getFoodCount(), loadedSettings.getFoodCount());
     EXPECT_EQ(settings.hasBorders(), loadedSettings.hasBorders());
     EXPECT_EQ(settings.isSoundEnabled(), loadedSettings.isSoundEnabled());
 }
@@ -0,0 +1,124 @@
+#include "utils/QueueBenchmark.h"
+#include "utils/SpscQueue.h"
+#include <chrono>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+namespace GreedySnake
+{
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Push 0..itemCount-1 on a producer thread while the calling thread pops and checks them
+template <typename TryPush, typename TryPop>
+QueueBenchmark::Result transfer(uint64_t itemCount, TryPush tryPush, TryPop tryPop)
+{
+    QueueBenchmark::Result result;
+    uint64_t fullWaits = 0; // Producer-local so the two threads share nothing but the queue
+    const auto begin = Clock::now();
+
+    std::thread producer([&]() {
+        for (uint64_t value = 0; value < itemCount; ++value)
+        {
+            while (!tryPush(value))
+            {
+                ++fullWaits;
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint64_t value = 0;
+    while (result.itemCount < itemCount)
+    {
+        if (!tryPop(value))
+        {
+            ++result.emptyWaits;
+            std::this_thread::yield();
+            continue;
+        }
+        if (value != result.itemCount)
+        {
+            result.inOrder = false;
+        }
+        ++result.itemCount;
+    }
+
+    producer.join();
+    result.fullWaits = fullWaits;
+    result.seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    return result;
+}
+
+void printResult(const char* name, const QueueBenchmark::Result& result)
+{
+    const double rate = result.seconds > 0.0 ? result.itemCount / result.seconds : 0.0;
+    std::cout << std::left << std::setw(12) << name << std::right << std::fixed
+              << std::setprecision(1) << std::setw(10) << rate / 1e6 << " M items/s, "
+              << std::setprecision(3) << result.seconds << " s, " << result.fullWaits
+              << " full / " << result.emptyWaits << " empty waits"
+              << (result.inOrder ? "" : ", OUT OF ORDER") << std::endl;
+}
+} // namespace
+
+QueueBenchmark::Result QueueBenchmark::runSpscQueue(uint64_t itemCount)
+{
+    SpscQueue<uint64_t, QUEUE_CAPACITY> queue;
+    return transfer(
+        itemCount,
+        [&](uint64_t value) { return queue.push(value); },
+        [&](uint64_t& value) { return queue.pop(value); });
+}
+
+QueueBenchmark::Result QueueBenchmark::runMutexDeque(uint64_t itemCount)
+{
+    std::mutex mutex;
+    std::deque<uint64_t> queue;
+    return transfer(
+        itemCount,
+        [&](uint64_t value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (queue.size() == QUEUE_CAPACITY)
+            {
+                return false;
+            }
+            queue.push_back(value);
+            return true;
+        },
+        [&](uint64_t& value) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (queue.empty())
+            {
+                return false;
+            }
+            value = queue.front();
+            queue.pop_front();
+            return true;
+        });
+}
+
+bool QueueBenchmark::run(uint64_t itemCount)
+{
+    std::cout << "Transferring " << itemCount << " items between two threads (capacity "
+              << QUEUE_CAPACITY << ")" << std::endl;
+
+    const Result spsc = runSpscQueue(itemCount);
+    printResult("SpscQueue", spsc);
+
+    const Result locked = runMutexDeque(itemCount);
+    printResult("mutex+deque", locked);
+
+    if (spsc.seconds > 0.0)
+    {
+        std::cout << "SpscQueue speedup: " << std::setprecision(2)
+                  << locked.seconds / spsc.seconds << "x" << std::endl;
+    }
+    return spsc.inOrder && locked.inOrder;
+}
+
+} // namespace GreedySnake
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Contention benchmark for handing items from one thread to another
+ *
+ * A producer thread pushes a sequence of numbers that a consumer thread pops
+ * and checks, once through SpscQueue and once through a std::deque guarded by
+ * a mutex. Both queues hold at most QUEUE_CAPACITY items and both sides spin
+ * (yielding) while the queue is full or empty, so the difference is the cost
+ * of the handoff itself.
+ */
+class QueueBenchmark
+{
+  public:
+    static constexpr size_t QUEUE_CAPACITY = 1024;
+
+    /**
+     * @brief Outcome of one producer/consumer run
+     */
+    struct Result
+    {
+        uint64_t itemCount = 0;  // Items that reached the consumer
+        double seconds = 0.0;    // Wall time from the first push to the last pop
+        bool inOrder = true;     // Every item arrived exactly once, in push order
+        uint64_t fullWaits = 0;  // Times the producer found the queue full
+        uint64_t emptyWaits = 0; // Times the consumer found the queue empty
+    };
+
+    /**
+     * @brief Transfer items through the lock-free SpscQueue
+     * @param itemCount Number of items to transfer
+     * @return Timing and consistency of the run
+     */
+    static Result runSpscQueue(uint64_t itemCount);
+
+    /**
+     * @brief Transfer items through a mutex-protected std::deque
+     * @param itemCount Number of items to transfer
+     * @return Timing and consistency of the run
+     */
+    static Result runMutexDeque(uint64_t itemCount);
+
+    /**
+     * @brief Run both variants and print their throughput
+     * @param itemCount Number of items each variant transfers
+     * @return True if both variants delivered every item in order
+     */
+    static bool run(uint64_t itemCount);
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Lock-free bounded queue between exactly one producer and one consumer thread
+ *
+ * Items are copied into a fixed ring of slots, so pushing and popping never
+ * allocate or wait. Each side owns one index on its own cache line and keeps
+ * a cached copy of the other side's index, reading the shared atomic only when
+ * the cache says the queue looks full (producer) or empty (consumer).
+ *
+ * @tparam T Item type (slots are reused, not reconstructed)
+ * @tparam Capacity Number of slots, a power of two
+ */
+template <typename T, std::size_t Capacity> class SpscQueue
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscQueue capacity must be a power of two");
+
+  public:
+    SpscQueue() : slots{}, head(0), cachedTail(0), tail(0), cachedHead(0)
+    {
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Append an item (producer thread only)
+     * @param item Item to copy into the queue
+     * @return False if the queue is full; the item is not queued
+     */
+    bool push(const T& item)
+    {
+        const std::size_t position = head.load(std::memory_order_relaxed);
+        if (position - cachedTail == Capacity)
+        {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (position - cachedTail == Capacity)
+            {
+                return false;
+            }
+        }
+
+        slots[position & INDEX_MASK] = item;
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest item (consumer thread only)
+     * @param item Receives the item
+     * @return False if the queue is empty
+     */
+    bool pop(T& item)
+    {
+        const std::size_t position = tail.load(std::memory_order_relaxed);
+        if (position == cachedHead)
+        {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (position == cachedHead)
+            {
+                return false;
+            }
+        }
+
+        item = slots[position & INDEX_MASK];
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Get the number of queued items
+     *
+     * Exact on either thread when the other is idle; otherwise a snapshot.
+     *
+     * @return Items pushed but not yet popped
+     */
+    [[nodiscard]] std::size_t size() const
+    {
+        const std::size_t consumed = tail.load(std::memory_order_acquire);
+        return head.load(std::memory_order_acquire) - consumed;
+    }
+
+    /**
+     * @brief Check whether the queue holds no items
+     * @return True if size() is zero
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Get the number of slots
+     * @return Capacity
+     */
+    [[nodiscard]] static constexpr std::size_t capacity()
+    {
+        return Capacity;
+    }
+
+  private:
+    static constexpr std::size_t INDEX_MASK = Capacity - 1;
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    std::array<T, Capacity> slots;
+
+    // Producer side: next position to write, and the last tail it saw
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head;
+    std::size_t cachedTail;
+
+    // Consumer side: next position to read, and the last head it saw
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail;
+    std::size_t cachedHead;
+};
+
+} // namespace GreedySnake
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace GreedySnake
+{
+
+/**
+ * @brief Lock-free triple buffer for handing the latest value from one thread to another
+ *
+ * One producer writes into a private back slot and publishes it; one consumer
+ * picks up the most recently published slot. Publishing and consuming only swap
+ * slot indices through a single atomic, so neither side ever waits for the other.
+ * Intermediate values are dropped if the producer outpaces the consumer.
+ *
+ * @tparam T Value type stored in each slot (slots are reused, not reconstructed)
+ */
+template <typename T> class TripleBuffer
+{
+  public:
+    TripleBuffer() : middle(1), backIndex(0), frontIndex(2)
+    {
+    }
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * @brief Get the slot owned by the producer
+     * @return Reference to the back slot, to be filled before publish()
+     */
+    T& getWriteBuffer()
+    {
+        return buffers[backIndex];
+    }
+
+    /**
+     * @brief Publish the back slot, making it the latest value for the consumer
+     */
+    void publish()
+    {
+        std::uint8_t previous = middle.exchange(static_cast<std::uint8_t>(backIndex | DIRTY_FLAG),
+                                                std::memory_order_acq_rel);
+        backIndex = previous & INDEX_MASK;
+    }
+
+    /**
+     * @brief Take ownership of the latest published slot, if there is a new one
+     * @return True if the read buffer changed since the last call
+     */
+    bool update()
+    {
+        if ((middle.load(std::memory_order_relaxed) & DIRTY_FLAG) == 0)
+        {
+            return false;
+        }
+
+        std::uint8_t previous = middle.exchange(frontIndex, std::memory_order_acq_rel);
+        frontIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @brief Get the slot owned by the consumer
+     * @return Reference to the most recently consumed value
+     */
+    [[nodiscard]] const T& getReadBuffer() const
+    {
+        return buffers[frontIndex];
+    }
+
+    /**
+     * @brief Check whether a value was published that the consumer has not taken yet
+     * @return True if update() would return true
+     */
+    [[nodiscard]] bool hasNewData() const
+    {
+        return (middle.load(std::memory_order_acquire) & DIRTY_FLAG) != 0;
+    }
+
+  private:
+    static constexpr std::uint8_t INDEX_MASK = 0x3;
+    static constexpr std::uint8_t DIRTY_FLAG = 0x4;
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    std::array<T, 3> buffers;
+
+    // Shared slot index plus dirty flag, the only state touched by both threads
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint8_t> middle;
+
+    // Producer-owned and consumer-owned indices live on separate cache lines
+    alignas(CACHE_LINE_SIZE) std::uint8_t backIndex;
+    alignas(CACHE_LINE_SIZE) std::uint8_t frontIndex;
+};
+
+} // namespace GreedySnake